@@ -0,0 +1,232 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Latency of the library's host-side work: rocfft_plan_create and
+// the dispatch in rocfft_execute, for problems that take each of the
+// main plan schemes.
+//
+// By default the library runs on its recording device runtime, so no
+// GPU is needed and execute times exclude the kernels themselves.
+// Set ROCFFT_DEVICE_RUNTIME=hip to measure against a real device.
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <string>
+#include <vector>
+
+#include "rocfft.h"
+
+struct BenchProblem
+{
+    std::string           name;
+    rocfft_transform_type type;
+    rocfft_precision      precision;
+    std::vector<size_t>   lengths;
+    size_t                batch;
+    // complex data planar rather than interleaved
+    bool planar = false;
+};
+
+static const std::vector<BenchProblem> bench_problems = {
+    // single-kernel Stockham
+    {"1D_small", rocfft_transform_type_complex_forward, rocfft_precision_single, {4096}, 1},
+    // short lengths whose transforms per block follow the batch
+    {"1D_short", rocfft_transform_type_complex_forward, rocfft_precision_single, {64}, 1},
+    {"1D_short_batched",
+     rocfft_transform_type_complex_forward,
+     rocfft_precision_single,
+     {64},
+     1 << 20},
+    // large 1D, split into column and row passes
+    {"1D_large", rocfft_transform_type_complex_forward, rocfft_precision_single, {1 << 22}, 1},
+    // Bluestein for a prime length
+    {"1D_prime", rocfft_transform_type_complex_forward, rocfft_precision_double, {8191}, 1},
+    {"2D_single", rocfft_transform_type_complex_forward, rocfft_precision_single, {64, 64}, 1},
+    {"2D", rocfft_transform_type_complex_forward, rocfft_precision_single, {4096, 4096}, 1},
+    {"3D", rocfft_transform_type_complex_forward, rocfft_precision_single, {200, 200, 200}, 1},
+    // power-of-two sizes that transpose through padded temp buffers
+    {"2D_pow2", rocfft_transform_type_complex_forward, rocfft_precision_single, {1024, 1024}, 1},
+    {"2D_pow2_large",
+     rocfft_transform_type_complex_forward,
+     rocfft_precision_single,
+     {2048, 2048},
+     1},
+    {"3D_pow2",
+     rocfft_transform_type_complex_forward,
+     rocfft_precision_single,
+     {1024, 1024, 4},
+     1},
+    {"real_1D", rocfft_transform_type_real_forward, rocfft_precision_single, {4096}, 64},
+    {"real_3D", rocfft_transform_type_real_forward, rocfft_precision_double, {128, 128, 128}, 1},
+    // planar counterparts of the above, which should run as fast
+    {"2D_planar",
+     rocfft_transform_type_complex_forward,
+     rocfft_precision_single,
+     {4096, 4096},
+     1,
+     true},
+    {"real_1D_planar",
+     rocfft_transform_type_real_forward,
+     rocfft_precision_single,
+     {4096},
+     64,
+     true},
+    {"real_3D_planar",
+     rocfft_transform_type_real_forward,
+     rocfft_precision_double,
+     {128, 128, 128},
+     1,
+     true},
+};
+
+static rocfft_plan create_plan(const BenchProblem& problem)
+{
+    rocfft_plan_description desc = nullptr;
+    if(problem.planar)
+    {
+        const bool real = problem.type == rocfft_transform_type_real_forward;
+        rocfft_plan_description_create(&desc);
+        rocfft_plan_description_set_data_layout(
+            desc,
+            real ? rocfft_array_type_real : rocfft_array_type_complex_planar,
+            real ? rocfft_array_type_hermitian_planar : rocfft_array_type_complex_planar,
+            nullptr,
+            nullptr,
+            0,
+            nullptr,
+            0,
+            0,
+            nullptr,
+            0);
+    }
+
+    rocfft_plan plan   = nullptr;
+    const auto  status = rocfft_plan_create(&plan,
+                                           rocfft_placement_notinplace,
+                                           problem.type,
+                                           problem.precision,
+                                           problem.lengths.size(),
+                                           problem.lengths.data(),
+                                           problem.batch,
+                                           desc);
+    if(desc)
+        rocfft_plan_description_destroy(desc);
+    return status == rocfft_status_success ? plan : nullptr;
+}
+
+static void bench_plan_create(benchmark::State& state, const BenchProblem& problem)
+{
+    for(auto _ : state)
+    {
+        auto plan = create_plan(problem);
+        if(!plan)
+        {
+            state.SkipWithError("rocfft_plan_create failed");
+            break;
+        }
+        rocfft_plan_destroy(plan);
+    }
+}
+
+static void bench_execute(benchmark::State& state, const BenchProblem& problem)
+{
+    auto plan = create_plan(problem);
+    if(!plan)
+    {
+        state.SkipWithError("rocfft_plan_create failed");
+        return;
+    }
+
+    size_t workBufferSize = 0;
+    rocfft_plan_get_work_buffer_size(plan, &workBufferSize);
+
+    // room for complex input and output, however the plan reads them
+    size_t elements = problem.batch;
+    for(auto len : problem.lengths)
+        elements *= len;
+    const size_t bytes = 2 * elements * (problem.precision == rocfft_precision_double ? 8 : 4);
+
+    // the recording runtime never touches transform buffers, so
+    // untouched host memory will do
+    const char* runtime   = getenv("ROCFFT_DEVICE_RUNTIME");
+    const bool  recording = runtime && strcmp(runtime, "record") == 0;
+    auto        alloc     = [recording](size_t size) -> void* {
+        void* buf = nullptr;
+        if(recording)
+            return malloc(size);
+        return hipMalloc(&buf, size) == hipSuccess ? buf : nullptr;
+    };
+    auto release = [recording](void* buf) {
+        if(recording)
+            free(buf);
+        else if(buf)
+            (void)hipFree(buf);
+    };
+
+    // planar data has its real and imaginary parts in separate buffers
+    void* in[2]  = {alloc(bytes), problem.planar ? alloc(bytes) : nullptr};
+    void* out[2] = {alloc(bytes), problem.planar ? alloc(bytes) : nullptr};
+    void* work   = workBufferSize ? alloc(workBufferSize) : nullptr;
+
+    rocfft_execution_info info = nullptr;
+    rocfft_execution_info_create(&info);
+    if(workBufferSize)
+        rocfft_execution_info_set_work_buffer(info, work, workBufferSize);
+
+    if(!in[0] || !out[0] || (problem.planar && (!in[1] || !out[1]))
+       || (workBufferSize && !work))
+        state.SkipWithError("buffer allocation failed");
+    else
+    {
+        for(auto _ : state)
+            rocfft_execute(plan, in, out, info);
+        if(!recording)
+            (void)hipDeviceSynchronize();
+    }
+
+    rocfft_execution_info_destroy(info);
+    for(auto buf : {in[0], in[1], out[0], out[1], work})
+        release(buf);
+    rocfft_plan_destroy(plan);
+}
+
+int main(int argc, char** argv)
+{
+    // the runtime is chosen on the library's first device call
+    setenv("ROCFFT_DEVICE_RUNTIME", "record", 0);
+    rocfft_setup();
+
+    for(const auto& problem : bench_problems)
+    {
+        benchmark::RegisterBenchmark(
+            ("plan_create/" + problem.name).c_str(), bench_plan_create, problem)
+            ->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("execute/" + problem.name).c_str(), bench_execute, problem)
+            ->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    rocfft_cleanup();
+    return 0;
+}
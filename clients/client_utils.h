@@ -1959,6 +1959,9 @@ inline Tsize var_size(const rocfft_precision precision, const rocfft_array_type
     case rocfft_precision_double:
         var_size = sizeof(double);
         break;
+    case rocfft_precision_half:
+        var_size = sizeof(_Float16);
+        break;
     }
     switch(type)
     {
@@ -1972,6 +1975,41 @@ inline Tsize var_size(const rocfft_precision precision, const rocfft_array_type
     return var_size;
 }
 
+// Half-precision transforms are checked against a single-precision
+// reference.  Return the precision of the host-side reference data.
+inline rocfft_precision reference_precision(const rocfft_precision precision)
+{
+    return precision == rocfft_precision_half ? rocfft_precision_single : precision;
+}
+
+// Convert each buffer elementwise from Tin to Tout.  Real, interleaved
+// and planar data are all flat arrays of reals, so the layout is
+// unchanged.
+template <typename Tout, typename Tin, typename Allocator>
+inline std::vector<std::vector<char, Allocator>>
+    convert_buffer(const std::vector<std::vector<char, Allocator>>& input)
+{
+    std::vector<std::vector<char, Allocator>> output(input.size());
+    for(size_t b = 0; b < input.size(); ++b)
+    {
+        const size_t count = input[b].size() / sizeof(Tin);
+        output[b].resize(count * sizeof(Tout));
+        auto in  = reinterpret_cast<const Tin*>(input[b].data());
+        auto out = reinterpret_cast<Tout*>(output[b].data());
+        for(size_t i = 0; i < count; ++i)
+            out[i] = static_cast<Tout>(in[i]);
+    }
+    return output;
+}
+
+// Round single-precision data to the nearest half-precision values, so
+// the reference transform sees exactly the input given to rocFFT.
+template <typename Allocator>
+inline void round_to_half(std::vector<std::vector<char, Allocator>>& buffer)
+{
+    buffer = convert_buffer<float, _Float16>(convert_buffer<_Float16, float>(buffer));
+}
+
 // Given a data type and precision, the distance between batches, and the batch size,
 // return the required buffer size(s).
 template <typename Tsize>
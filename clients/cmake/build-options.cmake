@@ -24,3 +24,7 @@ endif( )
 if( NOT BUILD_CLIENTS_SAMPLES )
   option( BUILD_CLIENTS_SAMPLES "Build rocFFT samples" OFF )
 endif( )
+
+if( NOT BUILD_CLIENTS_BENCHMARKS )
+  option( BUILD_CLIENTS_BENCHMARKS "Build rocFFT host-side benchmarks" OFF )
+endif( )
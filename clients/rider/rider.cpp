@@ -80,6 +80,7 @@ int main(int argc, char* argv[])
         ("ntrial,N", po::value<int>(&ntrial)->default_value(1), "Trial size for the problem")
         ("notInPlace,o", "Not in-place FFT transform (default: in-place)")
         ("double", "Double precision transform (default: single)")
+        ("half", "Half precision transform (default: single)")
         ("transformType,t", po::value<rocfft_transform_type>(&transformType)
          ->default_value(rocfft_transform_type_complex_forward),
          "Type of transform:\n0) complex forward\n1) complex inverse\n2) real "
@@ -133,8 +134,10 @@ int main(int argc, char* argv[])
 
     const rocfft_result_placement place
         = vm.count("notInPlace") ? rocfft_placement_notinplace : rocfft_placement_inplace;
-    const rocfft_precision precision
-        = vm.count("double") ? rocfft_precision_double : rocfft_precision_single;
+    const rocfft_precision precision = vm.count("half")
+                                           ? rocfft_precision_half
+                                           : vm.count("double") ? rocfft_precision_double
+                                                                : rocfft_precision_single;
 
     if(vm.count("notInPlace"))
     {
@@ -307,15 +310,20 @@ int main(int argc, char* argv[])
                     "rocfft_execution_info_set_work_buffer failed");
     }
 
-    // Input data:
-    const auto input = compute_input(precision, itype, length, istride, idist, nbatch);
+    // Input data; half-precision input is generated in single precision
+    // and then converted.
+    const auto host_precision = reference_precision(precision);
+    auto       input = compute_input(host_precision, itype, length, istride, idist, nbatch);
 
     if(verbose > 1)
     {
         std::cout << "GPU input:\n";
-        printbuffer(precision, itype, input, ilength, istride, nbatch, idist);
+        printbuffer(host_precision, itype, input, ilength, istride, nbatch, idist);
     }
 
+    if(precision == rocfft_precision_half)
+        input = convert_buffer<_Float16, float>(input);
+
     // GPU input and output buffers:
     auto               ibuffer_sizes = buffer_sizes(precision, itype, idist, nbatch);
     std::vector<void*> ibuffer(ibuffer_sizes.size());
@@ -385,8 +393,10 @@ int main(int argc, char* argv[])
                 hipMemcpy(
                     output[idx].data(), obuffer[idx], output[idx].size(), hipMemcpyDeviceToHost);
             }
+            if(precision == rocfft_precision_half)
+                output = convert_buffer<float, _Float16>(output);
             std::cout << "GPU output:\n";
-            printbuffer(precision, otype, output, olength, ostride, nbatch, odist);
+            printbuffer(host_precision, otype, output, olength, ostride, nbatch, odist);
         }
     }
 
@@ -93,8 +93,10 @@ std::string gpu_params(const std::vector<size_t>&    gpu_ilength_cm,
     ss << "\t" << array_type_name(itype) << " -> " << array_type_name(otype) << "\n";
     if(precision == rocfft_precision_single)
         ss << "\tsingle-precision\n";
-    else
+    else if(precision == rocfft_precision_double)
         ss << "\tdouble-precision\n";
+    else
+        ss << "\thalf-precision\n";
     return ss.str();
 }
 
@@ -119,6 +121,9 @@ void rocfft_transform(const std::vector<size_t>&
                       const VectorNorms&                                         cpu_output_norm,
                       std::thread*                                               cpu_output_thread)
 {
+    // Precision of the CPU input and reference output:
+    const auto cpu_precision = reference_precision(precision);
+
     // Set up GPU computation:
 
     if(place == rocfft_placement_inplace)
@@ -328,14 +333,14 @@ void rocfft_transform(const std::vector<size_t>&
 
     // Formatted input data:
     auto gpu_input = allocate_host_buffer<fftwAllocator<char>>(
-        precision, itype, length, gpu_istride, gpu_idist, nbatch);
+        cpu_precision, itype, length, gpu_istride, gpu_idist, nbatch);
 
     // Copy from contiguous_input to input.
     copy_buffers(cpu_input_copy,
                  gpu_input,
                  ilength,
                  nbatch,
-                 precision,
+                 cpu_precision,
                  cpu_itype,
                  cpu_istride,
                  cpu_idist,
@@ -346,14 +351,17 @@ void rocfft_transform(const std::vector<size_t>&
     if(verbose > 4)
     {
         std::cout << "GPU input:\n";
-        printbuffer(precision, itype, gpu_input, ilength, gpu_istride, nbatch, gpu_idist);
+        printbuffer(cpu_precision, itype, gpu_input, ilength, gpu_istride, nbatch, gpu_idist);
     }
     if(verbose > 5)
     {
         std::cout << "flat GPU input:\n";
-        printbuffer_flat(precision, itype, gpu_input, gpu_idist);
+        printbuffer_flat(cpu_precision, itype, gpu_input, gpu_idist);
     }
 
+    if(precision == rocfft_precision_half)
+        gpu_input = convert_buffer<_Float16, float>(gpu_input);
+
     // GPU input and output buffers:
     auto                ibuffer_sizes = buffer_sizes(precision, itype, gpu_idist, nbatch);
     std::vector<gpubuf> ibuffer(ibuffer_sizes.size());
@@ -438,21 +446,25 @@ void rocfft_transform(const std::vector<size_t>&
         EXPECT_TRUE(hip_status == hipSuccess) << "hipMemcpy failure";
     }
 
+    if(precision == rocfft_precision_half)
+        gpu_output = convert_buffer<float, _Float16>(gpu_output);
+
     if(verbose > 2)
     {
         std::cout << "GPU output:\n";
-        printbuffer(precision, otype, gpu_output, olength, gpu_ostride, nbatch, gpu_odist);
+        printbuffer(cpu_precision, otype, gpu_output, olength, gpu_ostride, nbatch, gpu_odist);
     }
     if(verbose > 5)
     {
         std::cout << "flat GPU output:\n";
-        printbuffer_flat(precision, otype, gpu_output, gpu_odist);
+        printbuffer_flat(cpu_precision, otype, gpu_output, gpu_odist);
     }
 
     // Compute the Linfinity and L2 norm of the GPU output:
     VectorNorms gpu_norm;
     std::thread normthread([&]() {
-        gpu_norm = norm(gpu_output, olength, nbatch, precision, otype, gpu_ostride, gpu_odist);
+        gpu_norm
+            = norm(gpu_output, olength, nbatch, cpu_precision, otype, gpu_ostride, gpu_odist);
     });
     if(cpu_output_thread && cpu_output_thread->joinable())
         cpu_output_thread->join();
@@ -466,7 +478,7 @@ void rocfft_transform(const std::vector<size_t>&
                          gpu_output,
                          olength,
                          nbatch,
-                         precision,
+                         cpu_precision,
                          cpu_otype,
                          cpu_ostride,
                          cpu_odist,
@@ -614,16 +626,20 @@ TEST_P(accuracy_test, vs_fftw)
 
     const size_t nbatch = *std::max_element(batch_range.begin(), batch_range.end());
 
+    const auto cpu_precision = reference_precision(precision);
+
     // Generate the data:
     auto cpu_input = compute_input<fftwAllocator<char>>(
-        precision, cpu_itype, length, cpu_istride, cpu_idist, nbatch);
+        cpu_precision, cpu_itype, length, cpu_istride, cpu_idist, nbatch);
+    if(precision == rocfft_precision_half)
+        round_to_half(cpu_input);
     auto cpu_input_copy = cpu_input; // copy of input (might get overwritten by FFTW).
 
     // Compute the Linfinity and L2 norm of the CPU output:
     VectorNorms cpu_input_norm;
     std::thread cpu_input_norm_thread([&]() {
         cpu_input_norm
-            = norm(cpu_input, ilength, nbatch, precision, cpu_itype, cpu_istride, cpu_idist);
+            = norm(cpu_input, ilength, nbatch, cpu_precision, cpu_itype, cpu_istride, cpu_idist);
         if(verbose > 2)
         {
             std::cout << "CPU Input Linf norm:  " << cpu_input_norm.l_inf << "\n";
@@ -633,7 +649,7 @@ TEST_P(accuracy_test, vs_fftw)
     if(verbose > 3)
     {
         std::cout << "CPU input:\n";
-        printbuffer(precision, cpu_itype, cpu_input, ilength, cpu_istride, nbatch, cpu_idist);
+        printbuffer(cpu_precision, cpu_itype, cpu_input, ilength, cpu_istride, nbatch, cpu_idist);
     }
 
     // FFTW computation
@@ -647,12 +663,12 @@ TEST_P(accuracy_test, vs_fftw)
                                      nbatch,
                                      cpu_idist,
                                      cpu_odist,
-                                     precision,
+                                     cpu_precision,
                                      transformType,
                                      cpu_input);
         // Compute the Linfinity and L2 norm of the CPU output:
         cpu_output_norm
-            = norm(cpu_output, olength, nbatch, precision, cpu_otype, cpu_ostride, cpu_odist);
+            = norm(cpu_output, olength, nbatch, cpu_precision, cpu_otype, cpu_ostride, cpu_odist);
         if(verbose > 2)
         {
             std::cout << "CPU Output Linf norm: " << cpu_output_norm.l_inf << "\n";
@@ -661,7 +677,8 @@ TEST_P(accuracy_test, vs_fftw)
         if(verbose > 3)
         {
             std::cout << "CPU output:\n";
-            printbuffer(precision, cpu_otype, cpu_output, olength, cpu_ostride, nbatch, cpu_odist);
+            printbuffer(
+                cpu_precision, cpu_otype, cpu_output, olength, cpu_ostride, nbatch, cpu_odist);
         }
     });
     // clean up threads if transform throws
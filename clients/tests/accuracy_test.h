@@ -82,8 +82,10 @@ inline void print_params(const std::vector<size_t>&    length,
         std::cout << "out-of-place\n";
     if(precision == rocfft_precision_single)
         std::cout << "single-precision\n";
-    else
+    else if(precision == rocfft_precision_double)
         std::cout << "double-precision\n";
+    else
+        std::cout << "half-precision\n";
     switch(transformType)
     {
     case rocfft_transform_type_complex_forward:
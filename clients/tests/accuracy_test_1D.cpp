@@ -314,6 +314,52 @@ INSTANTIATE_TEST_SUITE_P(mix_1D_real_inverse,
                                             ValuesIn(precision_range),
                                             ::testing::Values(rocfft_transform_type_real_inverse),
                                             ::testing::Values(place_range)));
+// large 1D sizes split into SBCC/SBRC lengths other than the hand-tuned
+// 64, 81, 100, 128 and 256 (e.g. 8000 = 80 x 100, 27000 = 150 x 180),
+// and 12000 (100 x 120), which takes the CS_L1D_CRT split instead
+static std::vector<size_t> block_range
+    = {6561, 8000, 9000, 10000, 12000, 15552, 18000, 20000, 21600, 27000, 36000, 43200, 50000};
+
+static std::vector<std::vector<size_t>> vblock_range = {block_range};
+INSTANTIATE_TEST_SUITE_P(
+    block_1D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range_1D),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    block_1D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range_1D),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(block_1D_real_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(block_1D_real_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_inverse),
+                                            ::testing::Values(place_range)));
+
 // NB:
 // We have known non-unit strides issues for 1D:
 // - C2C middle size(for instance, single precision, 8192)
@@ -336,3 +382,101 @@ INSTANTIATE_TEST_SUITE_P(
                        ValuesIn(precision_range),
                        ::testing::Values(rocfft_transform_type_complex_forward),
                        ::testing::Values(place_range)));
+
+// Half-precision transforms are checked against a single-precision
+// reference.  Lengths cover single kernels, large 1D decompositions
+// and Bluestein, whose padded intermediates must not overflow fp16.
+static std::vector<size_t> half_range
+    = {4,    8,     16,    32, 64, 128, 256,  512,   1024,  2048, 4096,
+       8192, 16384, 65536, 3,  9,  27,  81,   243,   6561,  5,    25,
+       125,  625,   15625, 7,  49, 343, 8191, 10007, 65537};
+static std::vector<std::vector<size_t>> vhalf_range = {half_range};
+INSTANTIATE_TEST_SUITE_P(half_1D_complex_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vhalf_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_half),
+                                            ::testing::Values(rocfft_transform_type_complex_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(half_1D_complex_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vhalf_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_half),
+                                            ::testing::Values(rocfft_transform_type_complex_inverse),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(half_1D_real_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vhalf_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_half),
+                                            ::testing::Values(rocfft_transform_type_real_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(half_1D_real_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vhalf_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_half),
+                                            ::testing::Values(rocfft_transform_type_real_inverse),
+                                            ::testing::Values(place_range)));
+
+// Large 1D lengths on either side of the switch from TwiddleTableLarge
+// lookups to in-kernel sincospi twiddles (LargeTwiddleSincos): 65536 and
+// below read the table, larger single-precision lengths compute the
+// twiddles.  Each computed twiddle is within about 2 ulp of exact,
+// independent of length, so these must meet the same
+// sqrt(log2(N)) * epsilon relative L2 bound as every other size.
+static std::vector<size_t> large_twiddle_range
+    = {65536, 131072, 196608, 177147, 390625, 1048576, 16777216};
+static std::vector<std::vector<size_t>> vlarge_twiddle_range = {large_twiddle_range};
+INSTANTIATE_TEST_SUITE_P(large_twiddle_1D_complex_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vlarge_twiddle_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_single),
+                                            ::testing::Values(rocfft_transform_type_complex_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(large_twiddle_1D_complex_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vlarge_twiddle_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_1D),
+                                            ::testing::Values(rocfft_precision_single),
+                                            ::testing::Values(rocfft_transform_type_complex_inverse),
+                                            ::testing::Values(place_range)));
+
+// 1D lengths beyond Large1DThreshold squared, planned as several levels
+// of block column kernels, each leaving its rows to a large 1D plan
+// (see div1DLarge).
+static std::vector<size_t>              multilevel_range       = {6291456, 8388608, 33554432};
+static std::vector<std::vector<size_t>> vmultilevel_range      = {multilevel_range};
+const static std::vector<size_t>        batch_range_multilevel = {1};
+INSTANTIATE_TEST_SUITE_P(multilevel_1D_complex_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vmultilevel_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_multilevel),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_complex_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(multilevel_1D_complex_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(generate_lengths(vmultilevel_range)),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range_multilevel),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_complex_inverse),
+                                            ::testing::Values(place_range)));
@@ -249,6 +249,30 @@ INSTANTIATE_TEST_SUITE_P(mix_2D_real_inverse,
                                             ::testing::Values(rocfft_transform_type_real_inverse),
                                             ::testing::Values(place_range)));
 
+// length[1] uses SBCC lengths other than the hand-tuned 64, 81, 100,
+// 128 and 256 when CS_2D_RC is chosen
+static std::vector<std::vector<size_t>> vblock_range = {{96, 150, 240, 500}, {80, 120, 180, 300}};
+INSTANTIATE_TEST_SUITE_P(
+    block_2D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    block_2D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(generate_lengths(vblock_range)),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+
 // test length-1 on one dimension against a variety of non-1 lengths
 static std::vector<std::vector<size_t>> vlen1_range = {{1}, {4, 8, 8192, 3, 27, 7, 11, 5000, 8000}};
 INSTANTIATE_TEST_SUITE_P(
@@ -331,3 +355,47 @@ INSTANTIATE_TEST_SUITE_P(len1_swap_2D_real_inverse,
                                             ValuesIn(precision_range),
                                             ::testing::Values(rocfft_transform_type_real_inverse),
                                             ::testing::Values(place_range)));
+
+// Sizes whose transposed intermediates have their 512 or 1024 element
+// rows padded in the temp buffer (2D RTRT and real 2D), also with
+// strided user data around them.
+static std::vector<std::vector<size_t>> padded_2D_range        = {{1024, 512}, {1024, 1024}};
+static std::vector<std::vector<size_t>> padded_2D_stride_range = {{1}, {3}};
+INSTANTIATE_TEST_SUITE_P(
+    padded_2D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(padded_2D_range),
+                       ::testing::Values(padded_2D_stride_range),
+                       ::testing::Values(padded_2D_stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    padded_2D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(padded_2D_range),
+                       ::testing::Values(padded_2D_stride_range),
+                       ::testing::Values(padded_2D_stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(padded_2D_real_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(padded_2D_range),
+                                            ::testing::Values(padded_2D_stride_range),
+                                            ::testing::Values(padded_2D_stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(padded_2D_real_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(padded_2D_range),
+                                            ::testing::Values(padded_2D_stride_range),
+                                            ::testing::Values(padded_2D_stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_inverse),
+                                            ::testing::Values(place_range)));
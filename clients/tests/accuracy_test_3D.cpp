@@ -247,3 +247,96 @@ INSTANTIATE_TEST_SUITE_P(mix_3D_real_inverse,
                                             ValuesIn(precision_range),
                                             ::testing::Values(rocfft_transform_type_real_inverse),
                                             ::testing::Values(place_range)));
+
+// Fused single-kernel 3D sizes outside the ranges above, and 3D_RC
+// plans (a 2D FFT followed by SBCC columns along the outermost
+// dimension).  The 3D_RC lengths with a short middle dimension run the
+// 2D FFT as RTRT, which writes the output buffer out-of-place.
+static std::vector<std::vector<size_t>> single_3D_range = {{64, 4, 4}, {4, 64, 4}, {4, 4, 64}};
+static std::vector<std::vector<size_t>> rc_3D_range
+    = {{64, 128, 128}, {64, 7, 64}, {64, 7, 128}, {64, 11, 256}};
+INSTANTIATE_TEST_SUITE_P(
+    single_3D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(single_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    single_3D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(single_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    rc_3D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rc_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    rc_3D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(rc_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+
+// Sizes whose transposed intermediates have their 512 or 1024 element
+// rows or planes padded in the temp buffer: 3D TRTRTR, and 3D RTRT
+// around a short 2D FFT.  Real 3D transforms of these sizes keep their
+// intermediates packed.
+static std::vector<std::vector<size_t>> padded_3D_range
+    = {{1024, 7, 512}, {512, 64, 7}, {512, 8, 8}};
+INSTANTIATE_TEST_SUITE_P(
+    padded_3D_complex_forward,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(padded_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_forward),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(
+    padded_3D_complex_inverse,
+    accuracy_test,
+    ::testing::Combine(ValuesIn(padded_3D_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(stride_range),
+                       ::testing::Values(batch_range),
+                       ValuesIn(precision_range),
+                       ::testing::Values(rocfft_transform_type_complex_inverse),
+                       ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(padded_3D_real_forward,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(padded_3D_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_forward),
+                                            ::testing::Values(place_range)));
+INSTANTIATE_TEST_SUITE_P(padded_3D_real_inverse,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(padded_3D_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ::testing::Values(rocfft_transform_type_real_inverse),
+                                            ::testing::Values(place_range)));
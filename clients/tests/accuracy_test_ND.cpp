@@ -0,0 +1,83 @@
+// Copyright (c) 2026 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "accuracy_test.h"
+#include "rocfft.h"
+
+using ::testing::ValuesIn;
+
+// Plans of rank 4 to 8.  Packed data runs a 3D plan over the lowest
+// three dimensions batched over the higher ones, followed by columns
+// along each higher dimension.
+static std::vector<std::vector<size_t>> nd_range = {{2, 4, 4, 64},
+                                                    {4, 4, 4, 4, 4},
+                                                    {2, 4, 2, 4, 2, 4},
+                                                    {2, 2, 2, 2, 2, 2, 4},
+                                                    {2, 2, 2, 2, 2, 2, 2, 8}};
+
+static std::vector<std::vector<size_t>> stride_range = {{1}};
+
+// Row-major strides that leave the outermost dimension next to the
+// innermost one and pad the others, so that the data is not packed and
+// the distance is not the outermost length times its stride.
+static std::vector<std::vector<size_t>> nd_layout_4D_range        = {{2, 4, 4, 8}};
+static std::vector<std::vector<size_t>> nd_layout_4D_stride_range = {{8, 80, 400, 1}};
+static std::vector<std::vector<size_t>> nd_layout_6D_range        = {{2, 2, 3, 4, 2, 8}};
+static std::vector<std::vector<size_t>> nd_layout_6D_stride_range = {{8, 412, 136, 34, 17, 1}};
+
+static const std::vector<rocfft_transform_type> nd_type_range
+    = {rocfft_transform_type_complex_forward,
+       rocfft_transform_type_complex_inverse,
+       rocfft_transform_type_real_forward,
+       rocfft_transform_type_real_inverse};
+
+INSTANTIATE_TEST_SUITE_P(nd,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(nd_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ValuesIn(nd_type_range),
+                                            ::testing::Values(place_range)));
+
+INSTANTIATE_TEST_SUITE_P(nd_layout_4D,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(nd_layout_4D_range),
+                                            ::testing::Values(nd_layout_4D_stride_range),
+                                            ::testing::Values(nd_layout_4D_stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ValuesIn(nd_type_range),
+                                            ::testing::Values(place_range)));
+
+INSTANTIATE_TEST_SUITE_P(nd_layout_6D,
+                         accuracy_test,
+                         ::testing::Combine(ValuesIn(nd_layout_6D_range),
+                                            ::testing::Values(nd_layout_6D_stride_range),
+                                            ::testing::Values(nd_layout_6D_stride_range),
+                                            ::testing::Values(batch_range),
+                                            ValuesIn(precision_range),
+                                            ValuesIn(nd_type_range),
+                                            ::testing::Values(place_range)));
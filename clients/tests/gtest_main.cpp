@@ -80,6 +80,7 @@ int main(int argc, char* argv[])
          "forward\n3) real inverse")
         ("notInPlace,o", "Not in-place FFT transform (default: in-place)")
         ("double", "Double precision transform (default: single)")
+        ("half", "Half precision transform (default: single)")
         ( "itype", po::value<rocfft_array_type>(&itype)
           ->default_value(rocfft_array_type_unset),
           "Array type of input data:\n0) interleaved\n1) planar\n2) real\n3) "
@@ -110,6 +111,8 @@ int main(int argc, char* argv[])
     }
     place     = vm.count("notInPlace") ? rocfft_placement_notinplace : rocfft_placement_inplace;
     precision = vm.count("double") ? rocfft_precision_double : rocfft_precision_single;
+    if(vm.count("half"))
+        precision = rocfft_precision_half;
 
     verbose = vm["verbose"].as<int>();
 
@@ -231,14 +234,19 @@ TEST(manual, vs_fftw)
     const auto cpu_odist
         = set_odist(rocfft_placement_notinplace, transformType, length, cpu_ostride);
     auto cpu_otype = contiguous_otype(transformType);
+
+    const auto cpu_precision = reference_precision(precision);
+
     // Generate the data:
     auto cpu_input = compute_input<fftwAllocator<char>>(
-        precision, cpu_itype, length, cpu_istride, cpu_idist, nbatch);
+        cpu_precision, cpu_itype, length, cpu_istride, cpu_idist, nbatch);
+    if(precision == rocfft_precision_half)
+        round_to_half(cpu_input);
     auto cpu_input_copy = cpu_input; // copy of input (might get overwritten by FFTW).
 
     // Compute the Linfinity and L2 norm of the CPU output:
     auto cpu_input_norm
-        = norm(cpu_input, ilength, nbatch, precision, cpu_itype, cpu_istride, cpu_idist);
+        = norm(cpu_input, ilength, nbatch, cpu_precision, cpu_itype, cpu_istride, cpu_idist);
     if(verbose > 2)
     {
         std::cout << "CPU Input Linf norm:  " << cpu_input_norm.l_inf << "\n";
@@ -250,7 +258,7 @@ TEST(manual, vs_fftw)
     if(verbose > 3)
     {
         std::cout << "CPU input:\n";
-        printbuffer(precision, cpu_itype, cpu_input, ilength, cpu_istride, nbatch, cpu_idist);
+        printbuffer(cpu_precision, cpu_itype, cpu_input, ilength, cpu_istride, nbatch, cpu_idist);
     }
 
     // FFTW computation
@@ -261,13 +269,13 @@ TEST(manual, vs_fftw)
                                       nbatch,
                                       cpu_idist,
                                       cpu_odist,
-                                      precision,
+                                      cpu_precision,
                                       transformType,
                                       cpu_input);
 
     // Compute the Linfinity and L2 norm of the CPU output:
     auto cpu_output_norm
-        = norm(cpu_output, olength, nbatch, precision, cpu_otype, cpu_ostride, cpu_odist);
+        = norm(cpu_output, olength, nbatch, cpu_precision, cpu_otype, cpu_ostride, cpu_odist);
     if(verbose > 2)
     {
         std::cout << "CPU Output Linf norm: " << cpu_output_norm.l_inf << "\n";
@@ -276,7 +284,7 @@ TEST(manual, vs_fftw)
     if(verbose > 3)
     {
         std::cout << "CPU output:\n";
-        printbuffer(precision, cpu_otype, cpu_output, olength, cpu_ostride, nbatch, cpu_odist);
+        printbuffer(cpu_precision, cpu_otype, cpu_output, olength, cpu_ostride, nbatch, cpu_odist);
     }
     ASSERT_TRUE(std::isfinite(cpu_output_norm.l_inf));
     ASSERT_TRUE(std::isfinite(cpu_output_norm.l_2));
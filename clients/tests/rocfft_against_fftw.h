@@ -279,6 +279,10 @@ inline double type_epsilon(const rocfft_precision precision)
     case rocfft_precision_double:
         return type_epsilon<double>();
         break;
+    case rocfft_precision_half:
+        // fp16 storage with fp32 arithmetic: the error is dominated by
+        // rounding to fp16 between kernels, about its unit roundoff
+        return 5e-4;
     default:
         throw std::runtime_error("Invalid precision");
         return 0.0;
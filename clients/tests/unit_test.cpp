@@ -18,15 +18,21 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include "gpubuf.h"
 #include "hip/hip_runtime_api.h"
 #include "hip/hip_vector_types.h"
 #include "private.h"
 #include "rocfft.h"
+#include <atomic>
 #include <boost/scope_exit.hpp>
+#include <chrono>
+#include <cmath>
+#include <complex>
 #include <condition_variable>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <mutex>
+#include <random>
 #include <regex>
 #include <thread>
 #include <vector>
@@ -264,3 +270,1002 @@ TEST(rocfft_UnitTest, log_multithreading)
         ASSERT_TRUE(res) << "line contains invalid content: " << line;
     }
 }
+
+// Host backend plans run on host memory: the forward transform of a
+// shifted impulse is a pure twiddle, and the inverse brings it back
+TEST(rocfft_UnitTest, host_backend)
+{
+    rocfft_setup();
+
+    // pow2, Bluestein and large 1D plans all go through different kernels
+    for(size_t length : {64, 1000, 8191, 131072})
+    {
+        rocfft_plan_description desc = nullptr;
+        ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_description_set_backend(desc, rocfft_backend_host),
+                  rocfft_status_success);
+
+        rocfft_plan fwd = nullptr, inv = nullptr;
+        ASSERT_EQ(rocfft_plan_create(&fwd,
+                                     rocfft_placement_inplace,
+                                     rocfft_transform_type_complex_forward,
+                                     rocfft_precision_double,
+                                     1,
+                                     &length,
+                                     1,
+                                     desc),
+                  rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_create(&inv,
+                                     rocfft_placement_inplace,
+                                     rocfft_transform_type_complex_inverse,
+                                     rocfft_precision_double,
+                                     1,
+                                     &length,
+                                     1,
+                                     desc),
+                  rocfft_status_success);
+
+        size_t fwd_work = 0, inv_work = 0;
+        rocfft_plan_get_work_buffer_size(fwd, &fwd_work);
+        rocfft_plan_get_work_buffer_size(inv, &inv_work);
+        std::vector<char> work(std::max(fwd_work, inv_work));
+
+        rocfft_execution_info info = nullptr;
+        ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+        rocfft_execution_info_set_work_buffer(info, work.data(), work.size());
+
+        std::vector<std::complex<double>> data(length);
+        data[1]   = 1.0;
+        void* buf = data.data();
+
+        ASSERT_EQ(rocfft_execute(fwd, &buf, nullptr, info), rocfft_status_success);
+        double err = 0.0;
+        for(size_t k = 0; k < length; ++k)
+            err = std::max(err, std::abs(data[k] - std::polar(1.0, -2.0 * M_PI * k / length)));
+        EXPECT_LT(err, 1e-10) << "length " << length;
+
+        ASSERT_EQ(rocfft_execute(inv, &buf, nullptr, info), rocfft_status_success);
+        err = 0.0;
+        for(size_t k = 0; k < length; ++k)
+            err = std::max(err, std::abs(data[k] - (k == 1 ? double(length) : 0.0)));
+        EXPECT_LT(err, 1e-10 * length) << "length " << length;
+
+        rocfft_execution_info_destroy(info);
+        rocfft_plan_destroy(fwd);
+        rocfft_plan_destroy(inv);
+        rocfft_plan_description_destroy(desc);
+    }
+
+    rocfft_cleanup();
+}
+
+// Generated kernels use vector loads and stores, and stage the input of
+// small batched transforms in LDS, only when data is unit stride,
+// contiguous and suitably aligned.  Buffers that start one element past
+// an aligned address, odd distances and partial work groups must take
+// the scalar path and still give the right answer.
+TEST(rocfft_UnitTest, unaligned_buffers)
+{
+    rocfft_setup();
+
+    typedef std::complex<double> complex_t;
+    const size_t                 batch  = 67;
+    const size_t                 stride = 1;
+
+    for(size_t length : {8, 16, 64, 100, 1000})
+    {
+        // direct DFT of each transform as the reference
+        std::vector<complex_t> twiddles(length);
+        for(size_t k = 0; k < length; ++k)
+            twiddles[k] = std::polar(1.0, -2.0 * M_PI * k / length);
+
+        for(size_t pad : {0, 1})
+        {
+            for(size_t offset : {0, 1})
+            {
+                for(auto place : {rocfft_placement_notinplace, rocfft_placement_inplace})
+                {
+                    const size_t dist  = length + pad;
+                    const size_t count = batch * dist + offset;
+                    const size_t bytes = count * sizeof(complex_t);
+
+                    rocfft_plan_description desc = nullptr;
+                    ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+                    ASSERT_EQ(rocfft_plan_description_set_data_layout(
+                                  desc,
+                                  rocfft_array_type_complex_interleaved,
+                                  rocfft_array_type_complex_interleaved,
+                                  nullptr,
+                                  nullptr,
+                                  1,
+                                  &stride,
+                                  dist,
+                                  1,
+                                  &stride,
+                                  dist),
+                              rocfft_status_success);
+
+                    rocfft_plan plan = nullptr;
+                    ASSERT_EQ(rocfft_plan_create(&plan,
+                                                 place,
+                                                 rocfft_transform_type_complex_forward,
+                                                 rocfft_precision_double,
+                                                 1,
+                                                 &length,
+                                                 batch,
+                                                 desc),
+                              rocfft_status_success);
+
+                    rocfft_execution_info info = nullptr;
+                    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+                    size_t workSize = 0;
+                    ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &workSize),
+                              rocfft_status_success);
+                    gpubuf work;
+                    if(workSize)
+                    {
+                        ASSERT_EQ(work.alloc(workSize), hipSuccess);
+                        ASSERT_EQ(rocfft_execution_info_set_work_buffer(
+                                      info, work.data(), workSize),
+                                  rocfft_status_success);
+                    }
+
+                    std::vector<complex_t>                 input(count);
+                    std::mt19937                           gen(length + pad + offset);
+                    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+                    for(auto& x : input)
+                        x = complex_t(unit(gen), unit(gen));
+
+                    gpubuf_t<complex_t> inBuf, outBuf;
+                    ASSERT_EQ(inBuf.alloc(bytes), hipSuccess);
+                    ASSERT_EQ(hipMemcpy(inBuf.data(), input.data(), bytes, hipMemcpyHostToDevice),
+                              hipSuccess);
+                    if(place == rocfft_placement_notinplace)
+                        ASSERT_EQ(outBuf.alloc(bytes), hipSuccess);
+
+                    void* in  = inBuf.data() + offset;
+                    void* out = place == rocfft_placement_inplace ? in : outBuf.data() + offset;
+                    ASSERT_EQ(rocfft_execute(plan,
+                                             &in,
+                                             place == rocfft_placement_inplace ? nullptr : &out,
+                                             info),
+                              rocfft_status_success);
+                    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+                    std::vector<complex_t> output(count);
+                    ASSERT_EQ(hipMemcpy(output.data(),
+                                        static_cast<complex_t*>(out) - offset,
+                                        bytes,
+                                        hipMemcpyDeviceToHost),
+                              hipSuccess);
+
+                    double err = 0.0;
+                    for(size_t b = 0; b < batch; ++b)
+                    {
+                        const complex_t* x = input.data() + offset + b * dist;
+                        const complex_t* y = output.data() + offset + b * dist;
+                        for(size_t k = 0; k < length; ++k)
+                        {
+                            complex_t sum = 0.0;
+                            for(size_t j = 0; j < length; ++j)
+                                sum += x[j] * twiddles[(j * k) % length];
+                            err = std::max(err, std::abs(sum - y[k]));
+                        }
+                    }
+                    EXPECT_LT(err, 1e-12 * length)
+                        << "length " << length << " dist " << dist << " offset " << offset
+                        << (place == rocfft_placement_inplace ? " in-place" : " out-of-place");
+
+                    rocfft_execution_info_destroy(info);
+                    rocfft_plan_destroy(plan);
+                    rocfft_plan_description_destroy(desc);
+                }
+            }
+        }
+    }
+
+    rocfft_cleanup();
+}
+
+// A hybrid plan gives each side at least one quantum of the batch, so
+// both throughputs are measured and the host's share is learned even
+// from a split that has drifted to one side.
+TEST(rocfft_UnitTest, hybrid_backend_split)
+{
+    rocfft_setup();
+
+    const size_t length = 256;
+    const size_t batch  = 128;
+    // quantum of 2 transforms
+    const double minShare = 2.0 / batch;
+
+    rocfft_plan_description desc = nullptr;
+    ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_backend(desc, rocfft_backend_hybrid),
+              rocfft_status_success);
+
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_inplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_double,
+                                 1,
+                                 &length,
+                                 batch,
+                                 desc),
+              rocfft_status_success);
+
+    std::complex<double>* data = nullptr;
+    ASSERT_EQ(hipMallocManaged(reinterpret_cast<void**>(&data),
+                               length * batch * sizeof(std::complex<double>)),
+              hipSuccess);
+
+    for(double share : {0.0, 1.0, 0.125})
+    {
+        ASSERT_EQ(rocfft_plan_set_hybrid_share_internal(plan, share), rocfft_status_success);
+
+        // an impulse at a different index in each transform
+        std::fill(data, data + length * batch, 0.0);
+        for(size_t b = 0; b < batch; ++b)
+            data[b * length + b % length] = 1.0;
+
+        void* buf = data;
+        ASSERT_EQ(rocfft_execute(plan, &buf, nullptr, nullptr), rocfft_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+        double err = 0.0;
+        for(size_t b = 0; b < batch; ++b)
+            for(size_t k = 0; k < length; ++k)
+            {
+                const auto expect = std::polar(1.0, -2.0 * M_PI * k * (b % length) / length);
+                err               = std::max(err, std::abs(data[b * length + k] - expect));
+            }
+        EXPECT_LT(err, 1e-10) << "initial share " << share;
+
+        double learned = -1.0;
+        ASSERT_EQ(rocfft_plan_get_hybrid_share_internal(plan, &learned), rocfft_status_success);
+        EXPECT_GE(learned, minShare) << "initial share " << share;
+        EXPECT_LE(learned, 1.0 - minShare) << "initial share " << share;
+    }
+
+    hipFree(data);
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+    rocfft_cleanup();
+}
+
+// Execute a forward transform of 'batch' transforms of 'length' points
+// with coalescing on, on a stream of its own, between copies in and out
+// enqueued on that stream.  Transforms are 'in_dist' apart in the input
+// and contiguous in the output.  Checks the result against a direct
+// DFT and returns in 'seconds' the time rocfft_execute took.
+static void coalesced_execute(size_t      length,
+                              size_t      batch,
+                              size_t      in_dist,
+                              size_t      seed,
+                              size_t      max_count,
+                              size_t      max_wait_us,
+                              double&     seconds,
+                              hipStream_t shared_stream = nullptr)
+{
+    typedef std::complex<double> complex_t;
+    const size_t                 stride   = 1;
+    const size_t                 inCount  = (batch - 1) * in_dist + length;
+    const size_t                 outCount = batch * length;
+
+    rocfft_plan_description desc = nullptr;
+    ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_data_layout(desc,
+                                                      rocfft_array_type_complex_interleaved,
+                                                      rocfft_array_type_complex_interleaved,
+                                                      nullptr,
+                                                      nullptr,
+                                                      1,
+                                                      &stride,
+                                                      in_dist,
+                                                      1,
+                                                      &stride,
+                                                      length),
+              rocfft_status_success);
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 rocfft_placement_notinplace,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_double,
+                                 1,
+                                 &length,
+                                 batch,
+                                 desc),
+              rocfft_status_success);
+
+    hipStream_t stream = shared_stream;
+    if(!shared_stream)
+        ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    rocfft_execution_info info = nullptr;
+    ASSERT_EQ(rocfft_execution_info_create(&info), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_stream(info, stream), rocfft_status_success);
+    ASSERT_EQ(rocfft_execution_info_set_coalescing(info, max_count, max_wait_us),
+              rocfft_status_success);
+
+    std::vector<complex_t>                 input(inCount), output(outCount);
+    std::mt19937                           gen(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    for(auto& x : input)
+        x = complex_t(unit(gen), unit(gen));
+
+    gpubuf_t<complex_t> inBuf, outBuf;
+    ASSERT_EQ(inBuf.alloc(inCount * sizeof(complex_t)), hipSuccess);
+    ASSERT_EQ(outBuf.alloc(outCount * sizeof(complex_t)), hipSuccess);
+    ASSERT_EQ(hipMemcpyAsync(inBuf.data(),
+                             input.data(),
+                             inCount * sizeof(complex_t),
+                             hipMemcpyHostToDevice,
+                             stream),
+              hipSuccess);
+
+    void*      in    = inBuf.data();
+    void*      out   = outBuf.data();
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(rocfft_execute(plan, &in, &out, info), rocfft_status_success);
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(hipMemcpyAsync(output.data(),
+                             outBuf.data(),
+                             outCount * sizeof(complex_t),
+                             hipMemcpyDeviceToHost,
+                             stream),
+              hipSuccess);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+    double err = 0.0;
+    for(size_t b = 0; b < batch; ++b)
+        for(size_t k = 0; k < length; ++k)
+        {
+            complex_t sum = 0.0;
+            for(size_t j = 0; j < length; ++j)
+                sum += input[b * in_dist + j] * std::polar(1.0, -2.0 * M_PI * j * k / length);
+            err = std::max(err, std::abs(output[b * length + k] - sum));
+        }
+    EXPECT_LT(err, 1e-10 * length) << "length " << length << " seed " << seed;
+
+    rocfft_execution_info_destroy(info);
+    if(!shared_stream)
+        hipStreamDestroy(stream);
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+}
+
+// Executions of one plan from several threads form one batch, which
+// starts as soon as max_count of them have joined
+TEST(rocfft_UnitTest, coalesce_grouping)
+{
+    rocfft_setup();
+
+    const size_t             threads = 4;
+    std::vector<double>      seconds(threads);
+    std::vector<std::thread> pool;
+    for(size_t t = 0; t < threads; ++t)
+        pool.emplace_back(
+            [&, t]() { coalesced_execute(64, 1, 64, t, threads, 10000000, seconds[t]); });
+    for(auto& th : pool)
+        th.join();
+    for(size_t t = 0; t < threads; ++t)
+        EXPECT_LT(seconds[t], 5.0) << "thread " << t;
+
+    rocfft_cleanup();
+}
+
+// An execution nobody joins runs alone once the window closes
+TEST(rocfft_UnitTest, coalesce_timeout)
+{
+    rocfft_setup();
+
+    double seconds = 0.0;
+    coalesced_execute(64, 1, 64, 0, 4, 100000, seconds);
+    EXPECT_GE(seconds, 0.09);
+
+    rocfft_cleanup();
+}
+
+// Executions of plans with different parameters never share a batch,
+// and plans whose batch of transforms overlap in memory are not
+// coalesced at all
+TEST(rocfft_UnitTest, coalesce_mismatch)
+{
+    rocfft_setup();
+
+    double      seconds[2] = {};
+    std::thread other([&]() { coalesced_execute(64, 1, 64, 0, 2, 200000, seconds[0]); });
+    coalesced_execute(128, 1, 128, 1, 2, 200000, seconds[1]);
+    other.join();
+    EXPECT_GE(seconds[0], 0.19);
+    EXPECT_GE(seconds[1], 0.19);
+
+    double overlapped = 0.0;
+    coalesced_execute(64, 2, 32, 2, 4, 10000000, overlapped);
+    EXPECT_LT(overlapped, 5.0);
+
+    rocfft_cleanup();
+}
+
+// Run a double-precision forward plan on a batch of separately
+// allocated transforms and compare each with a direct DFT
+static void pointer_array_execute(size_t                  length,
+                                  size_t                  batch,
+                                  rocfft_result_placement place,
+                                  rocfft_array_type       type)
+{
+    typedef std::complex<double> complex_t;
+    const bool                   planar = type == rocfft_array_type_complex_planar;
+    const size_t                 planes = planar ? 2 : 1;
+    const size_t                 bytes  = length * sizeof(complex_t) / planes;
+    const size_t                 stride = 1;
+
+    rocfft_plan_description desc = nullptr;
+    ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_data_layout(
+                  desc, type, type, nullptr, nullptr, 1, &stride, length, 1, &stride, length),
+              rocfft_status_success);
+    rocfft_plan plan = nullptr;
+    ASSERT_EQ(rocfft_plan_create(&plan,
+                                 place,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_double,
+                                 1,
+                                 &length,
+                                 batch,
+                                 desc),
+              rocfft_status_success);
+
+    std::vector<complex_t>                 input(batch * length);
+    std::mt19937                           gen(length + batch);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    for(auto& x : input)
+        x = complex_t(unit(gen), unit(gen));
+
+    // each transform, and each of its planes, in a buffer of its own
+    const bool          inplace = place == rocfft_placement_inplace;
+    std::vector<gpubuf> inBufs(batch * planes), outBufs(inplace ? 0 : batch * planes);
+    std::vector<void*>  inPtrs[2], outPtrs[2];
+    for(size_t p = 0; p < planes; ++p)
+    {
+        for(size_t b = 0; b < batch; ++b)
+        {
+            gpubuf& inBuf = inBufs[p * batch + b];
+            ASSERT_EQ(inBuf.alloc(bytes), hipSuccess);
+            std::vector<double> plane(planar ? length : 2 * length);
+            for(size_t j = 0; j < length; ++j)
+            {
+                const complex_t x = input[b * length + j];
+                if(planar)
+                    plane[j] = p == 0 ? x.real() : x.imag();
+                else
+                {
+                    plane[2 * j]     = x.real();
+                    plane[2 * j + 1] = x.imag();
+                }
+            }
+            ASSERT_EQ(hipMemcpy(inBuf.data(), plane.data(), bytes, hipMemcpyHostToDevice),
+                      hipSuccess);
+            inPtrs[p].push_back(inBuf.data());
+            if(!inplace)
+            {
+                gpubuf& outBuf = outBufs[p * batch + b];
+                ASSERT_EQ(outBuf.alloc(bytes), hipSuccess);
+                outPtrs[p].push_back(outBuf.data());
+            }
+        }
+    }
+
+    // device arrays of the pointers, one per plane
+    gpubuf inTables[2], outTables[2];
+    void** in[2]  = {};
+    void** out[2] = {};
+    for(size_t p = 0; p < planes; ++p)
+    {
+        ASSERT_EQ(inTables[p].alloc(batch * sizeof(void*)), hipSuccess);
+        ASSERT_EQ(hipMemcpy(inTables[p].data(),
+                            inPtrs[p].data(),
+                            batch * sizeof(void*),
+                            hipMemcpyHostToDevice),
+                  hipSuccess);
+        in[p] = static_cast<void**>(inTables[p].data());
+        if(!inplace)
+        {
+            ASSERT_EQ(outTables[p].alloc(batch * sizeof(void*)), hipSuccess);
+            ASSERT_EQ(hipMemcpy(outTables[p].data(),
+                                outPtrs[p].data(),
+                                batch * sizeof(void*),
+                                hipMemcpyHostToDevice),
+                      hipSuccess);
+            out[p] = static_cast<void**>(outTables[p].data());
+        }
+    }
+
+    ASSERT_EQ(rocfft_execute_pointer_array(plan, in, inplace ? nullptr : out, nullptr),
+              rocfft_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    double err = 0.0;
+    for(size_t b = 0; b < batch; ++b)
+    {
+        std::vector<double> plane[2];
+        for(size_t p = 0; p < planes; ++p)
+        {
+            plane[p].resize(planar ? length : 2 * length);
+            ASSERT_EQ(hipMemcpy(plane[p].data(),
+                                inplace ? inPtrs[p][b] : outPtrs[p][b],
+                                bytes,
+                                hipMemcpyDeviceToHost),
+                      hipSuccess);
+        }
+        for(size_t k = 0; k < length; ++k)
+        {
+            complex_t sum = 0.0;
+            for(size_t j = 0; j < length; ++j)
+                sum += input[b * length + j] * std::polar(1.0, -2.0 * M_PI * j * k / length);
+            const complex_t y = planar ? complex_t(plane[0][k], plane[1][k])
+                                       : complex_t(plane[0][2 * k], plane[0][2 * k + 1]);
+            err = std::max(err, std::abs(y - sum));
+        }
+    }
+    EXPECT_LT(err, 1e-10 * length) << "length " << length << " batch " << batch
+                                   << (inplace ? " in-place" : " out-of-place")
+                                   << (planar ? " planar" : " interleaved");
+
+    rocfft_plan_destroy(plan);
+    rocfft_plan_description_destroy(desc);
+}
+
+// Small 1D kernels index the pointer arrays by transform; plans of
+// several kernels, or that need a work buffer, stage the transforms
+TEST(rocfft_UnitTest, execute_pointer_array)
+{
+    rocfft_setup();
+
+    for(size_t length : {64, 100, 4096, 97})
+        for(auto place : {rocfft_placement_notinplace, rocfft_placement_inplace})
+            for(auto type : {rocfft_array_type_complex_interleaved,
+                             rocfft_array_type_complex_planar})
+                pointer_array_execute(length, 5, place, type);
+
+    rocfft_cleanup();
+}
+
+// One double-precision forward plan of a grouped execution, with its
+// buffers
+struct grouped_plan
+{
+    size_t                   length;
+    size_t                   batch;
+    size_t                   dist;
+    rocfft_array_type        type;
+    rocfft_result_placement  place;
+    rocfft_execution_backend backend = rocfft_backend_device;
+
+    rocfft_plan_description           desc = nullptr;
+    rocfft_plan                       plan = nullptr;
+    std::vector<std::complex<double>> input;
+    gpubuf                            inBufs[2], outBufs[2];
+    void*                             in[2]  = {};
+    void*                             out[2] = {};
+};
+
+// create the plan and its buffers, holding random input and zeroed
+// output
+static void grouped_plan_create(grouped_plan& g, size_t seed)
+{
+    const bool   planar = g.type == rocfft_array_type_complex_planar;
+    const size_t planes = planar ? 2 : 1;
+    const size_t count  = g.batch * g.dist;
+    const size_t bytes  = count * sizeof(std::complex<double>) / planes;
+    const size_t stride = 1;
+
+    ASSERT_EQ(rocfft_plan_description_create(&g.desc), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_data_layout(
+                  g.desc, g.type, g.type, nullptr, nullptr, 1, &stride, g.dist, 1, &stride, g.dist),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_description_set_backend(g.desc, g.backend), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_create(&g.plan,
+                                 g.place,
+                                 rocfft_transform_type_complex_forward,
+                                 rocfft_precision_double,
+                                 1,
+                                 &g.length,
+                                 g.batch,
+                                 g.desc),
+              rocfft_status_success);
+
+    g.input.resize(count);
+    std::mt19937                           gen(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    for(auto& x : g.input)
+        x = std::complex<double>(unit(gen), unit(gen));
+
+    std::vector<double> zero(2 * count, 0.0);
+    for(size_t p = 0; p < planes; ++p)
+    {
+        std::vector<double> plane(planar ? count : 2 * count);
+        for(size_t j = 0; j < count; ++j)
+        {
+            if(planar)
+                plane[j] = p == 0 ? g.input[j].real() : g.input[j].imag();
+            else
+            {
+                plane[2 * j]     = g.input[j].real();
+                plane[2 * j + 1] = g.input[j].imag();
+            }
+        }
+        ASSERT_EQ(g.inBufs[p].alloc(bytes), hipSuccess);
+        ASSERT_EQ(hipMemcpy(g.inBufs[p].data(), plane.data(), bytes, hipMemcpyHostToDevice),
+                  hipSuccess);
+        g.in[p] = g.inBufs[p].data();
+        if(g.place == rocfft_placement_notinplace)
+        {
+            ASSERT_EQ(g.outBufs[p].alloc(bytes), hipSuccess);
+            ASSERT_EQ(hipMemcpy(g.outBufs[p].data(), zero.data(), bytes, hipMemcpyHostToDevice),
+                      hipSuccess);
+            g.out[p] = g.outBufs[p].data();
+        }
+    }
+}
+
+// largest difference of the plan's output from a direct DFT of its
+// input, or from zero if 'ran' is false
+static double grouped_plan_error(const grouped_plan& g, bool ran)
+{
+    const bool   planar  = g.type == rocfft_array_type_complex_planar;
+    const size_t planes  = planar ? 2 : 1;
+    const size_t count   = g.batch * g.dist;
+    const size_t bytes   = count * sizeof(std::complex<double>) / planes;
+    const bool   inplace = g.place == rocfft_placement_inplace;
+
+    std::vector<double> plane[2];
+    for(size_t p = 0; p < planes; ++p)
+    {
+        plane[p].resize(planar ? count : 2 * count);
+        if(hipMemcpy(plane[p].data(), inplace ? g.in[p] : g.out[p], bytes, hipMemcpyDeviceToHost)
+           != hipSuccess)
+            return HUGE_VAL;
+    }
+
+    double err = 0.0;
+    for(size_t b = 0; b < g.batch; ++b)
+        for(size_t k = 0; k < g.length; ++k)
+        {
+            std::complex<double> sum = 0.0;
+            if(ran)
+                for(size_t j = 0; j < g.length; ++j)
+                    sum += g.input[b * g.dist + j]
+                           * std::polar(1.0, -2.0 * M_PI * j * k / g.length);
+            const size_t               i = b * g.dist + k;
+            const std::complex<double> y = planar ? std::complex<double>(plane[0][i], plane[1][i])
+                                                  : std::complex<double>(plane[0][2 * i],
+                                                                         plane[0][2 * i + 1]);
+            err = std::max(err, std::abs(y - sum));
+        }
+    return err;
+}
+
+// run the group and check its output; if given, 'launches' and
+// 'streams' receive how the group is scheduled
+static void grouped_execute(std::vector<grouped_plan>& group,
+                            rocfft_status              expected,
+                            size_t*                    launches = nullptr,
+                            size_t*                    streams  = nullptr)
+{
+    std::vector<rocfft_plan> plans;
+    std::vector<void**>      in, out;
+    for(size_t i = 0; i < group.size(); ++i)
+    {
+        grouped_plan_create(group[i], i);
+        plans.push_back(group[i].plan);
+        in.push_back(group[i].in);
+        out.push_back(group[i].out);
+    }
+
+    if(launches && streams)
+        ASSERT_EQ(rocfft_execute_grouped_schedule_internal(
+                      group.size(), plans.data(), launches, streams),
+                  rocfft_status_success);
+
+    ASSERT_EQ(
+        rocfft_execute_grouped(group.size(), plans.data(), in.data(), out.data(), nullptr),
+        expected);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    // nothing runs unless the whole group is valid
+    const bool ran = expected == rocfft_status_success;
+    for(const auto& g : group)
+    {
+        if(g.backend == rocfft_backend_host)
+            continue;
+        EXPECT_LT(grouped_plan_error(g, ran), 1e-10 * g.length)
+            << "length " << g.length << " batch " << g.batch << " dist " << g.dist;
+    }
+
+    for(auto& g : group)
+    {
+        rocfft_plan_destroy(g.plan);
+        rocfft_plan_description_destroy(g.desc);
+    }
+}
+
+// Plans of the same small kernel run as one launch whatever their batch
+// sizes and distances, alongside plans of other kernels
+TEST(rocfft_UnitTest, execute_grouped)
+{
+    rocfft_setup();
+
+    const auto interleaved = rocfft_array_type_complex_interleaved;
+    const auto planar      = rocfft_array_type_complex_planar;
+    const auto outplace    = rocfft_placement_notinplace;
+    const auto inplace     = rocfft_placement_inplace;
+
+    std::vector<grouped_plan> group(6);
+    group[0] = {64, 3, 64, interleaved, outplace};
+    group[1] = {64, 2, 70, interleaved, outplace};
+    group[2] = {64, 2, 64, planar, inplace};
+    group[3] = {100, 4, 100, interleaved, inplace};
+    group[4] = {4096, 2, 4096, interleaved, outplace};
+    group[5] = {97, 2, 97, interleaved, outplace};
+    grouped_execute(group, rocfft_status_success);
+
+    rocfft_cleanup();
+}
+
+// Small plans of different lengths, as in a ragged workload, run as
+// one launch per length, and those launches overlap on separate streams
+TEST(rocfft_UnitTest, execute_grouped_mixed_lengths)
+{
+    rocfft_setup();
+
+    const auto interleaved = rocfft_array_type_complex_interleaved;
+    const auto outplace    = rocfft_placement_notinplace;
+
+    std::vector<grouped_plan> group(4);
+    group[0] = {64, 200, 64, interleaved, outplace};
+    group[1] = {128, 150, 128, interleaved, outplace};
+    group[2] = {100, 80, 100, interleaved, outplace};
+    group[3] = {64, 50, 70, interleaved, outplace};
+
+    size_t launches = 0;
+    size_t streams  = 0;
+    grouped_execute(group, rocfft_status_success, &launches, &streams);
+    EXPECT_EQ(launches, 3);
+    EXPECT_EQ(streams, 3);
+
+    rocfft_cleanup();
+}
+
+// Executions on one stream of a plan that needs a work buffer still
+// coalesce: none holds the stream's work buffer while waiting for others
+TEST(rocfft_UnitTest, coalesce_shared_stream)
+{
+    rocfft_setup();
+
+    hipStream_t stream = nullptr;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+    const size_t             threads = 2;
+    std::vector<double>      seconds(threads);
+    std::vector<std::thread> pool;
+    for(size_t t = 0; t < threads; ++t)
+        pool.emplace_back([&, t]() {
+            coalesced_execute(97, 1, 97, t, threads, 10000000, seconds[t], stream);
+        });
+    for(auto& th : pool)
+        th.join();
+    for(size_t t = 0; t < threads; ++t)
+        EXPECT_LT(seconds[t], 5.0) << "thread " << t;
+
+    hipStreamDestroy(stream);
+    rocfft_cleanup();
+}
+
+// The library lends each stream one work buffer, grown as needed, to one
+// execution at a time
+TEST(rocfft_UnitTest, workspace_pool_reuse)
+{
+    rocfft_setup();
+
+    hipStream_t streams[2] = {};
+    for(auto& s : streams)
+        ASSERT_EQ(hipStreamCreate(&s), hipSuccess);
+
+    size_t before = 0;
+    ASSERT_EQ(rocfft_workspace_pool_get_count_internal(&before), rocfft_status_success);
+
+    void* lease = nullptr;
+    void* first = nullptr;
+    void* data  = nullptr;
+    ASSERT_EQ(rocfft_workspace_pool_borrow_internal(streams[0], 4096, &lease, &first),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_workspace_pool_return_internal(lease), rocfft_status_success);
+
+    // a smaller request on the same stream gets the same buffer
+    ASSERT_EQ(rocfft_workspace_pool_borrow_internal(streams[0], 1024, &lease, &data),
+              rocfft_status_success);
+    EXPECT_EQ(data, first);
+
+    // another thread on the stream waits for the lease to be returned
+    std::atomic<bool> borrowed(false);
+    void*             otherLease = nullptr;
+    void*             otherData  = nullptr;
+    std::thread       other([&]() {
+        EXPECT_EQ(rocfft_workspace_pool_borrow_internal(streams[0], 1024, &otherLease, &otherData),
+                  rocfft_status_success);
+        borrowed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(borrowed);
+    ASSERT_EQ(rocfft_workspace_pool_return_internal(lease), rocfft_status_success);
+    other.join();
+    EXPECT_TRUE(borrowed);
+    EXPECT_EQ(otherData, first);
+    ASSERT_EQ(rocfft_workspace_pool_return_internal(otherLease), rocfft_status_success);
+
+    // another stream has a buffer of its own
+    ASSERT_EQ(rocfft_workspace_pool_borrow_internal(streams[1], 1024, &lease, &data),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_workspace_pool_return_internal(lease), rocfft_status_success);
+    size_t after = 0;
+    ASSERT_EQ(rocfft_workspace_pool_get_count_internal(&after), rocfft_status_success);
+    EXPECT_EQ(after, before + 2);
+
+    for(auto s : streams)
+        hipStreamDestroy(s);
+    rocfft_cleanup();
+}
+
+// Releasing the pool, as rocfft_cleanup does, leaves a buffer on loan
+// usable until its lease is returned
+TEST(rocfft_UnitTest, workspace_pool_release_on_loan)
+{
+    rocfft_setup();
+
+    const size_t size  = 1 << 20;
+    void*        lease = nullptr;
+    void*        data  = nullptr;
+    ASSERT_EQ(rocfft_workspace_pool_borrow_internal(nullptr, size, &lease, &data),
+              rocfft_status_success);
+
+    rocfft_cleanup();
+    size_t count = 1;
+    ASSERT_EQ(rocfft_workspace_pool_get_count_internal(&count), rocfft_status_success);
+    EXPECT_EQ(count, 0);
+
+    std::vector<char> pattern(size, 0x5a), check(size);
+    ASSERT_EQ(hipMemcpy(data, pattern.data(), size, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(check.data(), data, size, hipMemcpyDeviceToHost), hipSuccess);
+    EXPECT_EQ(check, pattern);
+    ASSERT_EQ(rocfft_workspace_pool_return_internal(lease), rocfft_status_success);
+
+    rocfft_setup();
+    rocfft_cleanup();
+}
+
+// A group with an invalid plan runs none of its plans
+TEST(rocfft_UnitTest, execute_grouped_invalid)
+{
+    rocfft_setup();
+
+    std::vector<grouped_plan> group(2);
+    group[0] = {64, 2, 64, rocfft_array_type_complex_interleaved, rocfft_placement_notinplace};
+    group[1] = {64, 2, 64, rocfft_array_type_complex_interleaved, rocfft_placement_notinplace};
+    group[1].backend = rocfft_backend_host;
+    grouped_execute(group, rocfft_status_invalid_arg_value);
+
+    rocfft_plan plans[2] = {};
+    void*       buf      = nullptr;
+    void**      in[2]    = {&buf, &buf};
+    EXPECT_EQ(rocfft_execute_grouped(2, plans, in, in, nullptr), rocfft_status_invalid_arg_value);
+
+    rocfft_cleanup();
+}
+
+// The work size hipFFT reads from a plan's tree when the plan is made
+// matches the built plan's, and sizes with no tree fail before the
+// plan is built
+TEST(rocfft_UnitTest, estimate_work_buffer_size)
+{
+    rocfft_setup();
+
+    struct estimate_case
+    {
+        rocfft_transform_type type;
+        rocfft_precision      precision;
+        std::vector<size_t>   lengths;
+        size_t                batch;
+    };
+    const std::vector<estimate_case> cases = {
+        {rocfft_transform_type_complex_forward, rocfft_precision_single, {64}, 4},
+        {rocfft_transform_type_complex_forward, rocfft_precision_single, {97}, 3},
+        {rocfft_transform_type_complex_inverse, rocfft_precision_double, {4096}, 2},
+        {rocfft_transform_type_complex_forward, rocfft_precision_double, {6000}, 1},
+        {rocfft_transform_type_real_forward, rocfft_precision_single, {128, 64}, 2},
+        {rocfft_transform_type_real_inverse, rocfft_precision_double, {50, 40, 30}, 1},
+        {rocfft_transform_type_complex_forward, rocfft_precision_single, {32, 32, 32}, 1},
+        {rocfft_transform_type_complex_inverse, rocfft_precision_single, {4, 6, 8, 10}, 2},
+    };
+
+    for(const auto& c : cases)
+    {
+        SCOPED_TRACE(c.lengths.front());
+        rocfft_plan plan = nullptr;
+        ASSERT_EQ(rocfft_plan_allocate(&plan), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_describe_internal(plan,
+                                                rocfft_placement_notinplace,
+                                                c.type,
+                                                c.precision,
+                                                c.lengths.size(),
+                                                c.lengths.data(),
+                                                c.batch,
+                                                nullptr),
+                  rocfft_status_success);
+
+        size_t estimated = 0;
+        ASSERT_EQ(rocfft_plan_estimate_work_buffer_size_internal(plan, &estimated),
+                  rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_build_internal(plan), rocfft_status_success);
+        size_t built = 0;
+        ASSERT_EQ(rocfft_plan_get_work_buffer_size(plan, &built), rocfft_status_success);
+        EXPECT_EQ(estimated, built);
+
+        rocfft_plan_destroy(plan);
+    }
+
+    const size_t lengths[2] = {64, 0};
+    rocfft_plan  plan       = nullptr;
+    ASSERT_EQ(rocfft_plan_allocate(&plan), rocfft_status_success);
+    ASSERT_EQ(rocfft_plan_describe_internal(plan,
+                                            rocfft_placement_notinplace,
+                                            rocfft_transform_type_complex_forward,
+                                            rocfft_precision_single,
+                                            2,
+                                            lengths,
+                                            1,
+                                            nullptr),
+              rocfft_status_success);
+    size_t estimated = 0;
+    EXPECT_EQ(rocfft_plan_estimate_work_buffer_size_internal(plan, &estimated),
+              rocfft_status_invalid_dimensions);
+    EXPECT_NE(rocfft_plan_build_internal(plan), rocfft_status_success);
+    rocfft_plan_destroy(plan);
+
+    rocfft_cleanup();
+}
+
+TEST(rocfft_UnitTest, stockham_transforms_per_block_registered)
+{
+    const rocfft_precision precisions[]   = {rocfft_precision_single,
+                                           rocfft_precision_double,
+                                           rocfft_precision_half};
+    const size_t           counts[]       = {1, 1 << 20};
+    const size_t           computeUnits[] = {0, 1, 60, 120};
+
+    for(auto precision : precisions)
+    {
+        size_t kernels = 0;
+        for(size_t length = 1; length <= 8192; ++length)
+        {
+            for(auto count : counts)
+            {
+                for(auto cus : computeUnits)
+                {
+                    size_t transformsPerBlock = 0;
+                    auto   status = rocfft_stockham_transforms_per_block_internal(
+                        precision, length, count, cus, &transformsPerBlock);
+                    if(status == rocfft_status_invalid_dimensions)
+                        continue;
+                    ++kernels;
+                    EXPECT_EQ(status, rocfft_status_success)
+                        << "precision " << precision << " length " << length << " count "
+                        << count << " compute units " << cus << " transforms per block "
+                        << transformsPerBlock;
+                }
+            }
+        }
+        EXPECT_GT(kernels, 0);
+    }
+}
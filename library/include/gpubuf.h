@@ -3,9 +3,23 @@
 
 #include <hip/hip_runtime_api.h>
 
+// Allocates GPU buffers directly through HIP
+struct hip_allocator
+{
+    static hipError_t malloc(void** ptr, size_t size)
+    {
+        return hipMalloc(ptr, size);
+    }
+    static hipError_t free(void* ptr)
+    {
+        return hipFree(ptr);
+    }
+};
+
 // Simple RAII class for GPU buffers.  T is the type of pointer that
-// data() returns
-template <class T = void>
+// data() returns; Alloc provides static malloc and free functions
+// with the signatures of hipMalloc and hipFree.
+template <class T = void, class Alloc = hip_allocator>
 class gpubuf_t
 {
 public:
@@ -34,7 +48,7 @@ public:
     hipError_t alloc(const size_t size)
     {
         free();
-        auto ret = hipMalloc(&buf, size);
+        auto ret = Alloc::malloc(&buf, size);
         if(ret != hipSuccess)
             buf = nullptr;
         return ret;
@@ -44,7 +58,7 @@ public:
     {
         if(buf != nullptr)
         {
-            hipFree(buf);
+            Alloc::free(buf);
             buf = nullptr;
         }
     }
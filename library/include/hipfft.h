@@ -70,6 +70,18 @@ typedef enum hipfftType_t
     HIPFFT_Z2Z = 0x69 // Double-complex to double-complex (interleaved)
 } hipfftType;
 
+// Data types for the extensible (Xt) API.  Values match the
+// corresponding CUDA data types.
+typedef enum hipfftDataType_t
+{
+    HIPFFT_R_16F = 2, // Real half precision
+    HIPFFT_C_16F = 6, // Complex half precision (interleaved)
+    HIPFFT_R_32F = 0, // Real single precision
+    HIPFFT_C_32F = 4, // Complex single precision (interleaved)
+    HIPFFT_R_64F = 1, // Real double precision
+    HIPFFT_C_64F = 5 // Complex double precision (interleaved)
+} hipfftDataType;
+
 typedef enum hipfftLibraryPropertyType_t
 {
     HIPFFT_MAJOR_VERSION,
@@ -235,6 +247,23 @@ DLL_PUBLIC hipfftResult hipfftExecZ2D(hipfftHandle         plan,
                                       hipfftDoubleComplex* idata,
                                       hipfftDoubleReal*    odata);
 
+DLL_PUBLIC hipfftResult hipfftXtMakePlanMany(hipfftHandle   plan,
+                                             int            rank,
+                                             long long int* n,
+                                             long long int* inembed,
+                                             long long int  istride,
+                                             long long int  idist,
+                                             hipfftDataType inputtype,
+                                             long long int* onembed,
+                                             long long int  ostride,
+                                             long long int  odist,
+                                             hipfftDataType outputtype,
+                                             long long int  batch,
+                                             size_t*        workSize,
+                                             hipfftDataType executiontype);
+
+DLL_PUBLIC hipfftResult hipfftXtExec(hipfftHandle plan, void* input, void* output, int direction);
+
 // utility functions
 DLL_PUBLIC hipfftResult hipfftSetStream(hipfftHandle plan, hipStream_t stream);
 
@@ -83,6 +83,8 @@ typedef enum rocfft_precision_e
 {
     rocfft_precision_single,
     rocfft_precision_double,
+    /*! data stored as IEEE 754 binary16, computed in single precision */
+    rocfft_precision_half,
 } rocfft_precision;
 
 /*! @brief Result placement
@@ -116,6 +118,15 @@ typedef enum rocfft_execution_mode_e
     rocfft_exec_mode_blocking,
 } rocfft_execution_mode;
 
+/*! @brief Execution backend */
+typedef enum rocfft_execution_backend_e
+{
+    rocfft_backend_default,
+    rocfft_backend_device,
+    rocfft_backend_host,
+    rocfft_backend_hybrid,
+} rocfft_execution_backend;
+
 /*! @brief Library setup function, called once in program before start of
  * library use */
 ROCFFT_EXPORT rocfft_status rocfft_setup();
@@ -130,7 +141,7 @@ ROCFFT_EXPORT rocfft_status rocfft_cleanup();
  * This function
  *  takes many of the fundamental parameters needed to specify a transform. The
  * parameters are
- *  self explanatory. The dimensions parameter can take a value of 1,2 or 3. The
+ *  self explanatory. The dimensions parameter can take a value from 1 to 8. The
  * 'lengths' array specifies
  *  size of data in each dimension. Note that lengths[0] is the size of the
  * innermost dimension, lengths[1]
@@ -198,6 +209,72 @@ ROCFFT_EXPORT rocfft_status rocfft_execute(const rocfft_plan     plan,
                                            void*                 out_buffer[],
                                            rocfft_execution_info info);
 
+/*! @brief Execute an FFT plan on separately allocated transforms
+ *  @details Like rocfft_execute, except that each of the plan's batch of
+ * transforms has its own buffer instead of sitting a fixed distance from
+ * the previous one.  in_buffer and out_buffer are arrays (of size 1 for
+ * interleaved data, of size 2 for planar data) of device arrays, each of
+ * the plan's batch size, holding the device pointer of every transform's
+ * data.  Each transform is laid out with the plan's strides; its
+ * distances are ignored.
+ *
+ *  A plan computed by a single kernel (small 1D complex transforms)
+ * reads and writes each transform through the pointer arrays directly.
+ * For other plans, the transforms are gathered into, and scattered back
+ * out of, a staging buffer owned by the library, one kernel launch per
+ * plane.  Consecutive executions on the same stream of plans with the
+ * same parameters reuse that buffer and the batched plan built for it.
+ *
+ *  Plans set to run on the host backend are not supported.
+ *
+ *  @param[in] plan plan handle
+ *  @param[in,out] in_buffer array (of size 1 for interleaved data, of size 2
+ * for planar data) of device arrays of input buffers
+ *  @param[in,out] out_buffer array (of size 1 for interleaved data, of size 2
+ * for planar data) of device arrays of output buffers, can be nullptr for
+ * inplace result placement
+ *  @param[in] info execution info handle created by
+ * rocfft_execution_info_create
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execute_pointer_array(const rocfft_plan     plan,
+                                                         void**                in_buffer[],
+                                                         void**                out_buffer[],
+                                                         rocfft_execution_info info);
+
+/*! @brief Execute several FFT plans as one step
+ *  @details Runs a group of plans, each on its own buffers, as one step
+ * of the info's stream.  Plans computed by the same single kernel (small
+ * 1D complex transforms of one length, precision, direction, placement
+ * and layout, whatever their batch sizes and distances) run as one
+ * launch of it, which reads the address of each of their transforms
+ * from a table on the device.  Other plans, such as plans of other
+ * lengths or of several kernels, run on their own.  The launches are
+ * spread over up to eight streams of the library, which start when the
+ * info's stream reaches the call and which the info's stream waits for,
+ * so that launches of different lengths overlap on the device.  The
+ * library provides each plan's work buffer; the info's work buffer is
+ * not used.
+ *
+ *  Every plan is checked before any of them runs: if a plan is null or
+ * set to run on the host backend, or a buffer array is missing, nothing
+ * is run and rocfft_status_invalid_arg_value is returned.
+ *
+ *  @param[in] count number of plans
+ *  @param[in] plans array of count plan handles
+ *  @param[in,out] in_buffers array of count input buffer arrays, each as
+ * in_buffer would be passed to rocfft_execute for that plan
+ *  @param[in,out] out_buffers array of count output buffer arrays, each as
+ * out_buffer would be passed to rocfft_execute for that plan; can be
+ * nullptr if every plan has inplace result placement
+ *  @param[in] info execution info handle created by
+ * rocfft_execution_info_create
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execute_grouped(size_t                count,
+                                                   const rocfft_plan     plans[],
+                                                   void**                in_buffers[],
+                                                   void**                out_buffers[],
+                                                   rocfft_execution_info info);
+
 /*! @brief Destroy an FFT plan
  *  @details This API frees the plan. This function destructs a plan after it is
  * no longer needed.
@@ -266,6 +343,31 @@ ROCFFT_EXPORT rocfft_status
                                             const size_t*           out_strides,
                                             const size_t            out_distance);
 
+/*! @brief Set execution backend
+ *  @details This is one of plan description functions to specify
+ *  optional additional plan properties using the description handle.
+ *  This API selects where plans created from the description run.
+ *  Plans for rocfft_backend_host execute on host memory on the CPU,
+ *  using the same plan tree as the device backend; they allocate no
+ *  device memory, and their input, output and work buffers must be
+ *  host memory.  rocfft_backend_default selects the device.
+ *
+ *  Plans for rocfft_backend_hybrid split each execution along the
+ *  batch: the device transforms the first part of the batch while the
+ *  host transforms the rest, and rocfft_execute returns once both are
+ *  done.  The share given to the host is learned from the throughput
+ *  of each side in earlier executions of the plan; each side keeps at
+ *  least one transform, and at least 1/64 of larger batches, so that
+ *  both throughputs are measured on every execution.  Input and output
+ *  buffers must be accessible from both host and device, for example
+ *  memory from hipMallocManaged or hipHostMalloc; the work buffer is
+ *  only used by the device.  Plans with a batch of 1 run on the device.
+ *  @param[in, out] description description handle
+ *  @param[in] backend execution backend
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_plan_description_set_backend(
+    rocfft_plan_description description, const rocfft_execution_backend backend);
+
 /*! @brief Get library version string
  *
  * @param[in, out] buf buffer of version string
@@ -334,9 +436,15 @@ ROCFFT_EXPORT rocfft_status rocfft_execution_info_destroy(rocfft_execution_info
  * to rocfft_execute.
  *  When a non-zero value is obtained from rocfft_plan_get_work_buffer_size,
  * that means the library needs a work buffer
- *  to compute the transform. In this case, the user has to allocate the work
+ *  to compute the transform. In this case, the user can allocate the work
  * buffer and pass it to the library via this api.
  *
+ *  Otherwise the library lends the execution a work buffer from a pool
+ * that it keeps per device and stream.  Executions on the same stream
+ * share one buffer, sized to the largest of them, so device memory for
+ * work buffers grows with the number of streams rather than of plans.
+ * The pool is freed by rocfft_cleanup.
+ *
  *  @param[in] info execution info handle
  *  @param[in] work_buffer work buffer
  *  @param[in] size_in_bytes size of work buffer in bytes
@@ -373,6 +481,50 @@ ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_mode( rocfft_execution_inf
 ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info,
                                                              void*                 stream);
 
+/*! @brief Set execution backend in execution info
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  This API overrides the backend of the plan for executions using this info.
+ * rocfft_backend_default (the default) follows the plan.  A plan created for
+ * the device may run on the host; a plan created for the host has no device
+ * resources and cannot run on the device.  Only plans created for
+ * rocfft_backend_hybrid can be split between host and device; such a plan
+ * may also be run entirely on either one.
+ *  @param[in] info execution info handle
+ *  @param[in] backend execution backend
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_backend(
+    rocfft_execution_info info, const rocfft_execution_backend backend);
+
+/*! @brief Coalesce executions using this execution info into batches
+ *  @details This is one of the execution info functions to specify optional
+ * additional information to control execution.
+ *  When max_count is 2 or more, rocfft_execute with this info gathers the
+ * execution together with concurrent executions, from other threads, of
+ * plans with the same parameters and description, and runs them as one
+ * batched transform.  The batch starts once max_count executions have
+ * joined it, or max_wait_us microseconds after the first one did.  Inputs
+ * are copied into a staging buffer owned by the library and results copied
+ * back out, so each execution keeps its own buffers.
+ *
+ *  rocfft_execute returns once the batch it joined has been enqueued on
+ * the stream of the execution that started it, which may mean waiting up
+ * to max_wait_us.  Like an uncoalesced execution, it does not wait for the
+ * transform to finish: the batch starts after work already enqueued on
+ * each joined execution's stream, and work enqueued on those streams
+ * afterwards starts after the batch.  At most 256 executions
+ * form a batch.  Executions on the host or hybrid backend, and plans whose
+ * batch of transforms overlap in memory, are not coalesced.
+ *  @param[in] info execution info handle
+ *  @param[in] max_count largest number of executions in a batch; 0 or 1
+ * turns coalescing off
+ *  @param[in] max_wait_us longest time, in microseconds, the first
+ * execution of a batch waits for others
+ *  */
+ROCFFT_EXPORT rocfft_status rocfft_execution_info_set_coalescing(rocfft_execution_info info,
+                                                                 size_t max_count,
+                                                                 size_t max_wait_us);
+
 #if 0
 /*! @brief Get events from execution info
  *  @details This is one of the execution info functions to retrieve information from execution.
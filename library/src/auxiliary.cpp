@@ -20,10 +20,12 @@
 * THE SOFTWARE.
 *******************************************************************************/
 
+#include "device_runtime.h"
 #include "logging.h"
 #include "rocfft.h"
 #include "rocfft_hip.h"
 #include "rocfft_ostream.hpp"
+#include "workspace.h"
 #include <fcntl.h>
 #include <memory>
 
@@ -100,6 +102,8 @@ rocfft_status rocfft_setup()
 rocfft_status rocfft_cleanup()
 {
     log_trace(__func__);
+    WorkspacePool::Release();
+    device_runtime().log_summary();
 
     LogSingleton::GetInstance().SetLayerMode(rocfft_layer_mode_none);
     // Close log files
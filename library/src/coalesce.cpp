@@ -0,0 +1,494 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "batch_copy.h"
+#include "coalesce.h"
+#include "device_runtime.h"
+#include "logging.h"
+#include "radix_table.h"
+#include "repo.h"
+#include "transform.h"
+
+namespace
+{
+    bool IsPlanar(rocfft_array_type type)
+    {
+        return type == rocfft_array_type_complex_planar
+               || type == rocfft_array_type_hermitian_planar;
+    }
+
+    // bytes per element of one plane of an array
+    size_t ElementBytes(rocfft_array_type type, rocfft_precision precision)
+    {
+        const bool interleaved = type == rocfft_array_type_complex_interleaved
+                                 || type == rocfft_array_type_hermitian_interleaved;
+        return RealTypeSize(precision) * (interleaved ? 2 : 1);
+    }
+
+    // elements one transform of the plan spans in an array
+    size_t TransformSpan(const rocfft_plan_t&                     plan,
+                         rocfft_array_type                        type,
+                         const std::array<size_t, MAX_PLAN_RANK>& strides)
+    {
+        const bool hermitian = type == rocfft_array_type_hermitian_interleaved
+                               || type == rocfft_array_type_hermitian_planar;
+
+        size_t span = 1;
+        for(size_t i = 0; i < plan.rank; ++i)
+        {
+            const size_t len = (i == 0 && hermitian) ? plan.lengths[0] / 2 + 1 : plan.lengths[i];
+            span += (len - 1) * strides[i];
+        }
+        return span;
+    }
+
+    // Where each execution's data sits in the staging buffer, per
+    // plane of the input and output
+    struct CoalesceLayout
+    {
+        bool   supported = false;
+        size_t inBytes   = 0; // copied per execution
+        size_t outBytes  = 0;
+        size_t inSlot    = 0; // between consecutive executions
+        size_t outSlot   = 0;
+        size_t inDist    = 0; // of the batched plan
+        size_t outDist   = 0;
+    };
+
+    CoalesceLayout MakeLayout(const rocfft_plan_t& plan)
+    {
+        const auto&  desc    = plan.desc;
+        const bool   inplace = plan.placement == rocfft_placement_inplace;
+        const size_t inElem  = ElementBytes(desc.inArrayType, plan.precision);
+        const size_t outElem = ElementBytes(desc.outArrayType, plan.precision);
+        const size_t inSpan  = TransformSpan(plan, desc.inArrayType, desc.inStrides);
+        const size_t outSpan = TransformSpan(plan, desc.outArrayType, desc.outStrides);
+
+        CoalesceLayout layout;
+        layout.inBytes  = ((plan.batch - 1) * desc.inDist + inSpan) * inElem;
+        layout.outBytes = ((plan.batch - 1) * desc.outDist + outSpan) * outElem;
+
+        if(plan.batch == 1)
+        {
+            // a lone transform may be spaced as suits the staging
+            // buffer, as long as an in-place one has the same spacing
+            // in both of its types
+            const size_t unit = 2 * RealTypeSize(plan.precision);
+            layout.inSlot     = (inSpan * inElem + unit - 1) / unit * unit;
+            layout.outSlot    = (outSpan * outElem + unit - 1) / unit * unit;
+            if(inplace)
+                layout.inSlot = layout.outSlot = std::max(layout.inSlot, layout.outSlot);
+            layout.inDist  = layout.inSlot / inElem;
+            layout.outDist = layout.outSlot / outElem;
+        }
+        else
+        {
+            // a batch keeps its distances, which must keep its
+            // transforms apart for batches to follow each other
+            if(desc.inDist < inSpan || desc.outDist < outSpan)
+                return layout;
+            layout.inSlot  = plan.batch * desc.inDist * inElem;
+            layout.outSlot = plan.batch * desc.outDist * outElem;
+            if(inplace && layout.inSlot != layout.outSlot)
+                return layout;
+            layout.inDist  = desc.inDist;
+            layout.outDist = desc.outDist;
+        }
+        layout.supported = true;
+        return layout;
+    }
+
+    struct CoalesceRequest
+    {
+        void*         in[2]  = {};
+        void*         out[2] = {};
+        hipStream_t   stream = nullptr; // the caller's
+        hipEvent_t    ready  = nullptr; // the input is written, on 'stream'
+        bool          done   = false;
+        rocfft_status status = rocfft_status_success;
+    };
+
+    // executions that run as one batch
+    struct CoalesceGroup
+    {
+        std::vector<CoalesceRequest*> requests;
+        size_t                        maxCount = 0;
+        bool                          closed   = false; // no more may join
+    };
+
+    // Coalescing state of all plans with one set of parameters
+    struct CoalesceShape
+    {
+        explicit CoalesceShape(const rocfft_plan_t& plan)
+            : plan(plan)
+            , layout(MakeLayout(plan))
+        {
+        }
+
+        const rocfft_plan_t  plan;
+        const CoalesceLayout layout;
+
+        // the group still taking executions, if any
+        std::mutex                     mutex;
+        std::condition_variable        cv;
+        std::shared_ptr<CoalesceGroup> open;
+
+        // batches run one at a time, through one staging buffer, work
+        // buffer and set of batched plans
+        std::mutex                 runMutex;
+        std::map<size_t, ExecPlan> plans; // by number of executions
+        devbuf                     staging;
+        devbuf                     work;
+        size_t                     stagingSize = 0;
+        size_t                     workSize    = 0;
+        hipStream_t                stream      = nullptr; // of the last batch
+        hipEvent_t                 idle        = nullptr; // the last batch is done
+
+        // plan for 'count' executions' worth of transforms, built on
+        // first use
+        const ExecPlan* BatchPlan(size_t count)
+        {
+            auto it = plans.find(count);
+            if(it == plans.end())
+            {
+                rocfft_plan_t batched = plan;
+                batched.batch         = plan.batch * count;
+                batched.desc.inDist   = layout.inDist;
+                batched.desc.outDist  = layout.outDist;
+                batched.desc.backend  = rocfft_backend_device;
+
+                ExecPlan execPlan;
+                if(!Repo::BuildExecPlan(batched, execPlan))
+                    return nullptr;
+                it = plans.emplace(count, std::move(execPlan)).first;
+            }
+            return &it->second;
+        }
+    };
+
+    CoalesceShape& GetShape(const rocfft_plan_t& plan)
+    {
+        static std::mutex                                              mutex;
+        static std::map<rocfft_plan_t, std::unique_ptr<CoalesceShape>> shapes;
+
+        std::lock_guard<std::mutex> lck(mutex);
+        auto&                       shape = shapes[plan];
+        if(!shape)
+            shape.reset(new CoalesceShape(plan));
+        return *shape;
+    }
+
+    // grow a staging or work buffer to at least 'size' bytes; freeing
+    // the old one waits for the batches still using it
+    bool Reserve(devbuf& buf, size_t& bufSize, size_t size)
+    {
+        if(bufSize >= size)
+            return true;
+        bufSize = 0;
+        if(buf.alloc(size) != hipSuccess)
+            return false;
+        bufSize = size;
+        return true;
+    }
+
+    // Gather 'count' transforms' worth of separate buffers, transform
+    // them as one batch on the stream of 'info' and scatter the
+    // outputs.  setBuffers(copy, input, plane) points 'copy' at the
+    // buffers holding a plane of the input or output.
+    template <typename SetBuffers>
+    rocfft_status RunStaged(CoalesceShape&        shape,
+                            size_t                count,
+                            rocfft_execution_info info,
+                            SetBuffers            setBuffers)
+    {
+        std::lock_guard<std::mutex> lck(shape.runMutex);
+
+        auto&             runtime = device_runtime();
+        const hipStream_t stream  = info->rocfft_stream;
+
+        log_trace(__func__, "count", count);
+
+        const ExecPlan* batchPlan = shape.BatchPlan(count);
+        if(!batchPlan)
+            return rocfft_status_failure;
+
+        // a batch on another stream may still be using the buffers
+        if(shape.stream != stream && shape.idle)
+            runtime.stream_wait_event(stream, shape.idle);
+        shape.stream = stream;
+
+        const auto&  desc      = shape.plan.desc;
+        const auto&  layout    = shape.layout;
+        const bool   inplace   = shape.plan.placement == rocfft_placement_inplace;
+        const size_t inPlanes  = IsPlanar(desc.inArrayType) ? 2 : 1;
+        const size_t outPlanes = IsPlanar(desc.outArrayType) ? 2 : 1;
+        const size_t inPlane   = count * layout.inSlot;
+        const size_t outPlane  = count * layout.outSlot;
+
+        // the input planes, then the output planes unless in place
+        const size_t stagingSize = inPlanes * inPlane + (inplace ? 0 : outPlanes * outPlane);
+        const size_t workSize    = batchPlan->workBufSize * 2 * shape.plan.base_type_size;
+        if(!Reserve(shape.staging, shape.stagingSize, stagingSize)
+           || !Reserve(shape.work, shape.workSize, workSize))
+            return rocfft_status_failure;
+
+        char* base          = static_cast<char*>(shape.staging.data());
+        void* stagingIn[2]  = {base, base + inPlane};
+        void* stagingOut[2] = {stagingIn[0], stagingIn[1]};
+        if(!inplace)
+        {
+            stagingOut[0] = base + inPlanes * inPlane;
+            stagingOut[1] = base + inPlanes * inPlane + outPlane;
+        }
+
+        BatchCopy copy;
+        copy.count = count;
+        for(size_t p = 0; p < inPlanes; ++p)
+        {
+            setBuffers(copy, true, p);
+            copy.staging = static_cast<char*>(stagingIn[p]);
+            copy.slot    = layout.inSlot;
+            copy.bytes   = layout.inBytes;
+            copy.gather  = true;
+            runtime.batch_copy(copy, stream);
+        }
+
+        rocfft_execution_info_t batchInfo = *info;
+        batchInfo.workBuffer              = shape.work.data();
+        batchInfo.workBufferSize          = shape.workSize;
+        batchInfo.backend                 = rocfft_backend_device;
+        TransformPowX(*batchPlan, stagingIn, stagingOut, &batchInfo);
+
+        for(size_t p = 0; p < outPlanes; ++p)
+        {
+            setBuffers(copy, false, p);
+            copy.staging = static_cast<char*>(stagingOut[p]);
+            copy.slot    = layout.outSlot;
+            copy.bytes   = layout.outBytes;
+            copy.gather  = false;
+            runtime.batch_copy(copy, stream);
+        }
+
+        if(!shape.idle && runtime.event_create(&shape.idle) != hipSuccess)
+        {
+            shape.idle = nullptr;
+            runtime.stream_synchronize(stream);
+        }
+        else
+            runtime.event_record(shape.idle, stream);
+        return rocfft_status_success;
+    }
+
+    // Enqueue the group's executions as one batch on the stream of
+    // 'info', ordered after each caller's input and before anything
+    // each caller enqueues next on its own stream
+    rocfft_status RunBatch(CoalesceShape&        shape,
+                           const ExecPlan&       execPlan,
+                           const CoalesceGroup&  group,
+                           rocfft_execution_info info)
+    {
+        auto&             runtime  = device_runtime();
+        const hipStream_t stream   = info->rocfft_stream;
+        const auto&       requests = group.requests;
+
+        for(auto r : requests)
+        {
+            if(!r->ready)
+                continue;
+            if(r->stream != stream)
+                runtime.stream_wait_event(stream, r->ready);
+            runtime.event_destroy(r->ready);
+        }
+
+        // nothing else joined
+        if(requests.size() == 1)
+        {
+            const rocfft_status status
+                = TransformPowXBorrowing(execPlan, requests[0]->in, requests[0]->out, info);
+            if(status != rocfft_status_success)
+                return status;
+        }
+        else
+        {
+            const rocfft_status status
+                = RunStaged(shape, requests.size(), info, [&](BatchCopy& copy, bool in, size_t p) {
+                      for(size_t i = 0; i < requests.size(); ++i)
+                          copy.buffers[i] = in ? requests[i]->in[p] : requests[i]->out[p];
+                  });
+            if(status != rocfft_status_success)
+                return status;
+        }
+
+        hipEvent_t finished = nullptr;
+        if(runtime.event_create(&finished) != hipSuccess)
+        {
+            runtime.stream_synchronize(stream);
+            return rocfft_status_success;
+        }
+        runtime.event_record(finished, stream);
+        for(auto r : requests)
+            if(r->stream != stream)
+                runtime.stream_wait_event(r->stream, finished);
+        runtime.event_destroy(finished);
+        return rocfft_status_success;
+    }
+}
+
+bool BatchPointersSupported(const ExecPlan& execPlan)
+{
+    if(execPlan.execSeq.size() != 1 || execPlan.workBufSize != 0)
+        return false;
+    const TreeNode* node = execPlan.execSeq[0];
+    return node->scheme == CS_KERNEL_STOCKHAM && node->length.size() == 1
+           && (node->inArrayType == rocfft_array_type_complex_interleaved
+               || node->inArrayType == rocfft_array_type_complex_planar)
+           && (node->outArrayType == rocfft_array_type_complex_interleaved
+               || node->outArrayType == rocfft_array_type_complex_planar);
+}
+
+rocfft_status TransformCoalesced(const rocfft_plan_t&  plan,
+                                 const ExecPlan&       execPlan,
+                                 void*                 in_buffer[],
+                                 void*                 out_buffer[],
+                                 rocfft_execution_info info)
+{
+    CoalesceShape& shape = GetShape(plan);
+    if(!shape.layout.supported)
+        return TransformPowXBorrowing(execPlan, in_buffer, out_buffer, info);
+
+    auto& runtime = device_runtime();
+
+    CoalesceRequest request;
+    std::copy_n(in_buffer, IsPlanar(plan.desc.inArrayType) ? 2 : 1, request.in);
+    std::copy_n(out_buffer, IsPlanar(plan.desc.outArrayType) ? 2 : 1, request.out);
+
+    // the input may still be being written on the caller's stream,
+    // and the batch may run on another one
+    request.stream = info->rocfft_stream;
+    if(runtime.event_create(&request.ready) == hipSuccess)
+        runtime.event_record(request.ready, request.stream);
+    else
+    {
+        request.ready = nullptr;
+        runtime.stream_synchronize(request.stream);
+    }
+
+    std::unique_lock<std::mutex>   lck(shape.mutex);
+    std::shared_ptr<CoalesceGroup> group  = shape.open;
+    const bool                     leader = !group;
+    if(leader)
+    {
+        group           = std::make_shared<CoalesceGroup>();
+        group->maxCount = std::min<size_t>(info->coalesceCount, size_t(BatchCopy::max_count));
+        shape.open      = group;
+    }
+    group->requests.push_back(&request);
+    if(group->requests.size() >= group->maxCount)
+    {
+        group->closed = true;
+        shape.open.reset();
+        shape.cv.notify_all();
+    }
+
+    if(!leader)
+    {
+        shape.cv.wait(lck, [&]() { return request.done; });
+        return request.status;
+    }
+
+    // the first execution of a group waits out the window, then runs
+    // the batch for everyone
+    const auto deadline
+        = std::chrono::steady_clock::now() + std::chrono::microseconds(info->coalesceWaitUs);
+    shape.cv.wait_until(lck, deadline, [&]() { return group->closed; });
+    if(!group->closed)
+    {
+        group->closed = true;
+        shape.open.reset();
+    }
+    lck.unlock();
+
+    const rocfft_status status = RunBatch(shape, execPlan, *group, info);
+
+    lck.lock();
+    for(auto r : group->requests)
+    {
+        r->status = status;
+        r->done   = true;
+    }
+    shape.cv.notify_all();
+    return status;
+}
+
+rocfft_status TransformPointerArray(const rocfft_plan_t&  plan,
+                                    const ExecPlan&       execPlan,
+                                    void**                in_buffer[],
+                                    void**                out_buffer[],
+                                    rocfft_execution_info info)
+{
+    // a single small 1D complex kernel reads and writes each transform
+    // where it is, through the pointer tables
+    if(BatchPointersSupported(execPlan))
+    {
+        const TreeNode* node = execPlan.execSeq[0];
+        const size_t inPlanes  = IsPlanar(node->inArrayType) ? 2 : 1;
+        const size_t outPlanes = IsPlanar(node->outArrayType) ? 2 : 1;
+
+        rocfft_execution_info_t tableInfo = *info;
+        void*                   in[2]     = {};
+        void*                   out[2]    = {};
+        for(size_t p = 0; p < inPlanes; ++p)
+        {
+            tableInfo.batchPointers.in[p] = in_buffer[p];
+            in[p]                         = in_buffer[p];
+        }
+        for(size_t p = 0; p < outPlanes; ++p)
+        {
+            tableInfo.batchPointers.out[p] = out_buffer[p];
+            out[p]                         = out_buffer[p];
+        }
+        // the kernel's buffer arguments are not dereferenced; pass the
+        // tables so that none of them is null
+        TransformPowX(execPlan, in, out, &tableInfo);
+        return rocfft_status_success;
+    }
+
+    // the batch's transforms are staged like executions of a plan
+    // for just one of them
+    rocfft_plan_t single = plan;
+    single.batch         = 1;
+    single.desc.inDist   = 0;
+    single.desc.outDist  = 0;
+    CoalesceShape& shape = GetShape(single);
+
+    const size_t align = RealTypeSize(plan.precision);
+    return RunStaged(shape, plan.batch, info, [&](BatchCopy& copy, bool in, size_t p) {
+        copy.buffer_array = in ? in_buffer[p] : out_buffer[p];
+        copy.buffer_align = align;
+    });
+}
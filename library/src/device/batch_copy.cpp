@@ -0,0 +1,82 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "batch_copy.h"
+#include "rocfft_hip.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/// Copy 'units' elements of T between each buffer and its slot, the
+/// buffers strided over blockIdx.y.
+template <typename T>
+__global__ static void batch_copy_kernel(const BatchCopy copy, const size_t units)
+{
+    const size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i >= units)
+        return;
+
+    for(size_t b = hipBlockIdx_y; b < copy.count; b += hipGridDim_y)
+    {
+        T* buffer = static_cast<T*>(copy.buffer_array ? copy.buffer_array[b] : copy.buffers[b]);
+        T* slot   = reinterpret_cast<T*>(copy.staging + b * copy.slot);
+        if(copy.gather)
+            slot[i] = buffer[i];
+        else
+            buffer[i] = slot[i];
+    }
+}
+
+template <typename T>
+static void batch_copy_launch(const BatchCopy& copy, hipStream_t stream)
+{
+    const size_t units   = copy.bytes / sizeof(T);
+    const size_t threads = 256;
+    const dim3   grid((units + threads - 1) / threads, std::min<size_t>(copy.count, 65535));
+    hipLaunchKernelGGL(batch_copy_kernel<T>, grid, dim3(threads), 0, stream, copy, units);
+}
+
+void batch_copy(const BatchCopy& copy, hipStream_t stream)
+{
+    if(copy.count == 0 || copy.bytes == 0)
+        return;
+
+    // the widest unit that every buffer, slot and the size are
+    // aligned to
+    uintptr_t align = reinterpret_cast<uintptr_t>(copy.staging) | copy.slot | copy.bytes;
+    if(copy.buffer_array)
+        align |= copy.buffer_align;
+    else
+    {
+        for(size_t i = 0; i < copy.count; ++i)
+            align |= reinterpret_cast<uintptr_t>(copy.buffers[i]);
+    }
+
+    if(align % 16 == 0)
+        batch_copy_launch<uint4>(copy, stream);
+    else if(align % 8 == 0)
+        batch_copy_launch<uint64_t>(copy, stream);
+    else if(align % 4 == 0)
+        batch_copy_launch<uint32_t>(copy, stream);
+    else if(align % 2 == 0)
+        batch_copy_launch<uint16_t>(copy, stream);
+    else
+        batch_copy_launch<uint8_t>(copy, stream);
+}
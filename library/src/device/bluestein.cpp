@@ -40,7 +40,7 @@ rocfft_status chirp_launch(
                        N,
                        M,
                        B,
-                       (T*)twiddles_large,
+                       (compute_t<T>*)twiddles_large,
                        twl,
                        dir);
 
@@ -79,6 +79,14 @@ void rocfft_internal_chirp(const void* data_p, void* back_p)
                              twl,
                              dir,
                              rocfft_stream);
+    else if(data->node->precision == rocfft_precision_half)
+        chirp_launch<rocfft_half2>(N,
+                                   M,
+                                   (rocfft_half2*)data->bufOut[0],
+                                   data->node->twiddles_large.data(),
+                                   twl,
+                                   dir,
+                                   rocfft_stream);
     else
         chirp_launch<double2>(N,
                               M,
@@ -113,6 +121,10 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
     {
         cBytes = sizeof(float) * 2;
     }
+    else if(data->node->precision == rocfft_precision_half)
+    {
+        cBytes = sizeof(_Float16) * 2;
+    }
     else
     {
         cBytes = sizeof(double) * 2;
@@ -185,6 +197,26 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                dir,
                                scheme);
         }
+        else if(data->node->precision == rocfft_precision_half)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<rocfft_half2>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocfft_stream,
+                               numof,
+                               count,
+                               N,
+                               M,
+                               (const rocfft_half2*)bufIn0,
+                               (rocfft_half2*)bufOut0,
+                               data->node->length.size(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
+                               dir,
+                               scheme);
+        }
         else
         {
             hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<double2>),
@@ -235,6 +267,27 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                dir,
                                scheme);
         }
+        else if(data->node->precision == rocfft_precision_half)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<rocfft_half2>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocfft_stream,
+                               numof,
+                               count,
+                               N,
+                               M,
+                               (const real_type_t<rocfft_half2>*)bufIn0,
+                               (const real_type_t<rocfft_half2>*)bufIn1,
+                               (rocfft_half2*)bufOut0,
+                               data->node->length.size(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
+                               dir,
+                               scheme);
+        }
         else
         {
             hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<double2>),
@@ -286,6 +339,27 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                dir,
                                scheme);
         }
+        else if(data->node->precision == rocfft_precision_half)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<rocfft_half2>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocfft_stream,
+                               numof,
+                               count,
+                               N,
+                               M,
+                               (const rocfft_half2*)bufIn0,
+                               (real_type_t<rocfft_half2>*)bufOut0,
+                               (real_type_t<rocfft_half2>*)bufOut1,
+                               data->node->length.size(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
+                               dir,
+                               scheme);
+        }
         else
         {
             hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<double2>),
@@ -339,6 +413,28 @@ void rocfft_internal_mul(const void* data_p, void* back_p)
                                dir,
                                scheme);
         }
+        else if(data->node->precision == rocfft_precision_half)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<rocfft_half2>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocfft_stream,
+                               numof,
+                               count,
+                               N,
+                               M,
+                               (const real_type_t<rocfft_half2>*)bufIn0,
+                               (const real_type_t<rocfft_half2>*)bufIn1,
+                               (real_type_t<rocfft_half2>*)bufOut0,
+                               (real_type_t<rocfft_half2>*)bufOut1,
+                               data->node->length.size(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
+                               dir,
+                               scheme);
+        }
         else
         {
             hipLaunchKernelGGL(HIP_KERNEL_NAME(mul_device<double2>),
@@ -126,6 +126,19 @@ void complex2real(const void* data_p, void* back_p)
                            input_distance,
                            (float*)output_buffer,
                            output_distance);
+    else if(precision == rocfft_precision_half)
+        hipLaunchKernelGGL(complex2real_kernel<rocfft_half2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           input_size,
+                           input_stride,
+                           output_stride,
+                           (rocfft_half2*)input_buffer,
+                           input_distance,
+                           (_Float16*)output_buffer,
+                           output_distance);
     else
         hipLaunchKernelGGL(complex2real_kernel<double2>,
                            grid,
@@ -142,39 +155,39 @@ void complex2real(const void* data_p, void* back_p)
 }
 
 template <typename T>
-__global__ static void hermitian2complex_kernel(const size_t hermitian_size,
-                                                const size_t dim_0,
-                                                const size_t dim_1,
-                                                const size_t dim_2,
-                                                const size_t input_stride,
-                                                const size_t output_stride,
-                                                T*           input,
-                                                const size_t input_distance,
-                                                T*           output,
-                                                const size_t output_distance)
+__global__ static void hermitian2complex_kernel(const size_t  hermitian_size,
+                                                const size_t  dim,
+                                                const size_t* lengths,
+                                                const size_t* stride_in,
+                                                const size_t* stride_out,
+                                                T*            input,
+                                                const size_t  input_distance,
+                                                T*            output,
+                                                const size_t  output_distance)
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    size_t input_offset   = hipBlockIdx_z * input_distance;
-    size_t outputs_offset = hipBlockIdx_z * output_distance; // straight copy
-    size_t outputc_offset = hipBlockIdx_z * output_distance; // conjugate copy
+    // straight and conjugate copy indices
+    const size_t dim_0 = lengths[0];
+    const size_t is0   = tid;
+    const size_t ic0   = (is0 == 0) ? 0 : dim_0 - is0;
 
-    // straight copy indices
-    size_t is0 = tid;
-    size_t is1 = hipBlockIdx_y % dim_1;
-    size_t is2 = hipBlockIdx_y / dim_1;
+    size_t input_offset   = hipBlockIdx_z * input_distance + is0 * stride_in[0];
+    size_t outputs_offset = hipBlockIdx_z * output_distance + is0 * stride_out[0];
+    size_t outputc_offset = hipBlockIdx_z * output_distance + ic0 * stride_out[0];
 
-    // conjugate copy indices
-    size_t ic0 = (is0 == 0) ? 0 : dim_0 - is0;
-    size_t ic1 = (is1 == 0) ? 0 : dim_1 - is1;
-    size_t ic2 = (is2 == 0) ? 0 : dim_2 - is2;
+    // hipBlockIdx_y counts the higher dimensions; for 1D it is 0
+    size_t counter_mod = hipBlockIdx_y;
+    for(size_t i = 1; i < dim; i++)
+    {
+        const size_t is = counter_mod % lengths[i];
+        const size_t ic = (is == 0) ? 0 : lengths[i] - is;
+        counter_mod /= lengths[i];
 
-    input_offset += hipBlockIdx_y * input_stride + is0; // notice for 1D,
-    // hipBlockIdx_y == 0 and
-    // thus has no effect for
-    // input_offset
-    outputs_offset += (is2 * dim_1 + is1) * output_stride + is0;
-    outputc_offset += (ic2 * dim_1 + ic1) * output_stride + ic0;
+        input_offset += is * stride_in[i];
+        outputs_offset += is * stride_out[i];
+        outputc_offset += ic * stride_out[i];
+    }
 
     input += input_offset;
     T* outputs = output + outputs_offset;
@@ -197,11 +210,10 @@ __global__ static void hermitian2complex_kernel(const size_t hermitian_size,
 
 template <typename T>
 __global__ static void hermitian2complex_kernel(const size_t    hermitian_size,
-                                                const size_t    dim_0,
-                                                const size_t    dim_1,
-                                                const size_t    dim_2,
-                                                const size_t    input_stride,
-                                                const size_t    output_stride,
+                                                const size_t    dim,
+                                                const size_t*   lengths,
+                                                const size_t*   stride_in,
+                                                const size_t*   stride_out,
                                                 real_type_t<T>* inputRe,
                                                 real_type_t<T>* inputIm,
                                                 const size_t    input_distance,
@@ -210,26 +222,27 @@ __global__ static void hermitian2complex_kernel(const size_t    hermitian_size,
 {
     const size_t tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    size_t input_offset   = hipBlockIdx_z * input_distance;
-    size_t outputs_offset = hipBlockIdx_z * output_distance; // straight copy
-    size_t outputc_offset = hipBlockIdx_z * output_distance; // conjugate copy
+    // straight and conjugate copy indices
+    const size_t dim_0 = lengths[0];
+    const size_t is0   = tid;
+    const size_t ic0   = (is0 == 0) ? 0 : dim_0 - is0;
 
-    // straight copy indices
-    size_t is0 = tid;
-    size_t is1 = hipBlockIdx_y % dim_1;
-    size_t is2 = hipBlockIdx_y / dim_1;
+    size_t input_offset   = hipBlockIdx_z * input_distance + is0 * stride_in[0];
+    size_t outputs_offset = hipBlockIdx_z * output_distance + is0 * stride_out[0];
+    size_t outputc_offset = hipBlockIdx_z * output_distance + ic0 * stride_out[0];
 
-    // conjugate copy indices
-    size_t ic0 = (is0 == 0) ? 0 : dim_0 - is0;
-    size_t ic1 = (is1 == 0) ? 0 : dim_1 - is1;
-    size_t ic2 = (is2 == 0) ? 0 : dim_2 - is2;
+    // hipBlockIdx_y counts the higher dimensions; for 1D it is 0
+    size_t counter_mod = hipBlockIdx_y;
+    for(size_t i = 1; i < dim; i++)
+    {
+        const size_t is = counter_mod % lengths[i];
+        const size_t ic = (is == 0) ? 0 : lengths[i] - is;
+        counter_mod /= lengths[i];
 
-    input_offset += hipBlockIdx_y * input_stride + is0; // notice for 1D,
-    // hipBlockIdx_y == 0 and
-    // thus has no effect for
-    // input_offset
-    outputs_offset += (is2 * dim_1 + is1) * output_stride + is0;
-    outputc_offset += (ic2 * dim_1 + ic1) * output_stride + ic0;
+        input_offset += is * stride_in[i];
+        outputs_offset += is * stride_out[i];
+        outputc_offset += ic * stride_out[i];
+    }
 
     inputRe += input_offset;
     inputIm += input_offset;
@@ -276,10 +289,10 @@ void hermitian2complex(const void* data_p, void* back_p)
     size_t input_distance  = data->node->iDist;
     size_t output_distance = data->node->oDist;
 
-    size_t input_stride
-        = (data->node->length.size() > 1) ? data->node->inStride[1] : input_distance;
-    size_t output_stride
-        = (data->node->length.size() > 1) ? data->node->outStride[1] : output_distance;
+    const size_t  dim        = data->node->length.size();
+    const size_t* lengths    = data->node->devKernArg.data();
+    const size_t* stride_in  = data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH;
+    const size_t* stride_out = data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH;
 
     void* input_buffer  = data->bufIn[0];
     void* output_buffer = data->bufOut[0];
@@ -297,15 +310,6 @@ void hermitian2complex(const void* data_p, void* back_p)
 
     size_t blocks = (hermitian_size - 1) / 512 + 1;
 
-    if(data->node->length.size() > 3)
-        rocfft_cout << "Error: dimension larger than 3, which is not handled" << std::endl;
-
-    size_t dim_1 = 1, dim_2 = 1;
-    if(data->node->length.size() >= 2)
-        dim_1 = data->node->length[1];
-    if(data->node->length.size() == 3)
-        dim_2 = data->node->length[2];
-
     if(high_dimension > 65535 || batch > 65535)
         printf("2D and 3D or batch is too big; not implemented\n");
     // the z dimension is used for batching,
@@ -343,15 +347,29 @@ void hermitian2complex(const void* data_p, void* back_p)
                                0,
                                rocfft_stream,
                                hermitian_size,
-                               dim_0,
-                               dim_1,
-                               dim_2,
-                               input_stride,
-                               output_stride,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (float2*)input_buffer,
                                input_distance,
                                (float2*)output_buffer,
                                output_distance);
+        else if(precision == rocfft_precision_half)
+            hipLaunchKernelGGL(hermitian2complex_kernel<rocfft_half2>,
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               hermitian_size,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (rocfft_half2*)input_buffer,
+                               input_distance,
+                               (rocfft_half2*)output_buffer,
+                               output_distance);
         else
             hipLaunchKernelGGL(hermitian2complex_kernel<double2>,
                                grid,
@@ -359,11 +377,10 @@ void hermitian2complex(const void* data_p, void* back_p)
                                0,
                                rocfft_stream,
                                hermitian_size,
-                               dim_0,
-                               dim_1,
-                               dim_2,
-                               input_stride,
-                               output_stride,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (double2*)input_buffer,
                                input_distance,
                                (double2*)output_buffer,
@@ -378,16 +395,31 @@ void hermitian2complex(const void* data_p, void* back_p)
                                0,
                                rocfft_stream,
                                hermitian_size,
-                               dim_0,
-                               dim_1,
-                               dim_2,
-                               input_stride,
-                               output_stride,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (float*)data->bufIn[0],
                                (float*)data->bufIn[1],
                                input_distance,
                                (float2*)output_buffer,
                                output_distance);
+        else if(precision == rocfft_precision_half)
+            hipLaunchKernelGGL(hermitian2complex_kernel<rocfft_half2>,
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               hermitian_size,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (_Float16*)data->bufIn[0],
+                               (_Float16*)data->bufIn[1],
+                               input_distance,
+                               (rocfft_half2*)output_buffer,
+                               output_distance);
         else
             hipLaunchKernelGGL(hermitian2complex_kernel<double2>,
                                grid,
@@ -395,11 +427,10 @@ void hermitian2complex(const void* data_p, void* back_p)
                                0,
                                rocfft_stream,
                                hermitian_size,
-                               dim_0,
-                               dim_1,
-                               dim_2,
-                               input_stride,
-                               output_stride,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (double*)data->bufIn[0],
                                (double*)data->bufIn[1],
                                input_distance,
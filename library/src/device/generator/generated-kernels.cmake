@@ -5,16 +5,24 @@
 
 set( kernels_pow2
 rocfft_kernel_1024.h
+rocfft_kernel_1024_nt2.h
 rocfft_kernel_128.h
+rocfft_kernel_128_nt8.h
 rocfft_kernel_128_sbcc.h
 rocfft_kernel_128_sbrc.h
 rocfft_kernel_16.h
+rocfft_kernel_16_nt32.h
+rocfft_kernel_16_sbcc.h
+rocfft_kernel_16_sbrc.h
 rocfft_kernel_1.h
+rocfft_kernel_1_nt128.h
 rocfft_kernel_2048.h
 rocfft_kernel_256.h
+rocfft_kernel_256_nt2.h
 rocfft_kernel_256_sbcc.h
 rocfft_kernel_256_sbrc.h
 rocfft_kernel_2.h
+rocfft_kernel_2_nt128.h
 rocfft_kernel_2D_128_16.h
 rocfft_kernel_2D_128_32.h
 rocfft_kernel_2D_128_4.h
@@ -52,20 +60,36 @@ rocfft_kernel_2D_8_4.h
 rocfft_kernel_2D_8_64.h
 rocfft_kernel_2D_8_8.h
 rocfft_kernel_32.h
+rocfft_kernel_32_nt32.h
+rocfft_kernel_32_sbcc.h
+rocfft_kernel_32_sbrc.h
 rocfft_kernel_4096.h
 rocfft_kernel_4.h
+rocfft_kernel_4_nt64.h
 rocfft_kernel_512.h
+rocfft_kernel_512_nt2.h
+rocfft_kernel_512_sbcc.h
+rocfft_kernel_512_sbrc.h
 rocfft_kernel_64.h
+rocfft_kernel_64_nt8.h
 rocfft_kernel_64_sbcc.h
 rocfft_kernel_64_sbrc.h
 rocfft_kernel_8.h
+rocfft_kernel_8_nt64.h
 )
 
 set( kernels_pow3
 rocfft_kernel_1.h
+rocfft_kernel_1_nt128.h
 rocfft_kernel_2187.h
 rocfft_kernel_243.h
+rocfft_kernel_243_nt1.h
+rocfft_kernel_243_sbcc.h
+rocfft_kernel_243_sbrc.h
 rocfft_kernel_27.h
+rocfft_kernel_27_nt8.h
+rocfft_kernel_27_sbcc.h
+rocfft_kernel_27_sbrc.h
 rocfft_kernel_2D_243_9.h
 rocfft_kernel_2D_27_27.h
 rocfft_kernel_2D_27_81.h
@@ -77,18 +101,35 @@ rocfft_kernel_2D_9_27.h
 rocfft_kernel_2D_9_81.h
 rocfft_kernel_2D_9_9.h
 rocfft_kernel_3.h
+rocfft_kernel_3_nt64.h
 rocfft_kernel_729.h
 rocfft_kernel_81.h
+rocfft_kernel_81_nt3.h
+rocfft_kernel_81_sbcc.h
+rocfft_kernel_81_sbrc.h
 rocfft_kernel_9.h
+rocfft_kernel_9_nt22.h
 )
 
 set( kernels_pow5
 rocfft_kernel_125.h
+rocfft_kernel_125_nt10.h
+rocfft_kernel_125_nt3.h
+rocfft_kernel_125_sbcc.h
+rocfft_kernel_125_sbrc.h
 rocfft_kernel_1.h
+rocfft_kernel_1_nt128.h
 rocfft_kernel_25.h
+rocfft_kernel_25_nt13.h
+rocfft_kernel_25_nt50.h
+rocfft_kernel_25_sbcc.h
+rocfft_kernel_25_sbrc.h
 rocfft_kernel_3125.h
 rocfft_kernel_5.h
+rocfft_kernel_5_nt250.h
+rocfft_kernel_5_nt64.h
 rocfft_kernel_625.h
+rocfft_kernel_625_nt2.h
 rocfft_kernel_2D_125_25.h
 rocfft_kernel_2D_25_125.h
 rocfft_kernel_2D_25_25.h
@@ -96,80 +137,195 @@ rocfft_kernel_2D_25_25.h
 
 set( kernels_all
 rocfft_kernel_1000.h
+rocfft_kernel_1000_nt2.h
 rocfft_kernel_100.h
+rocfft_kernel_100_nt24.h
+rocfft_kernel_100_nt7.h
 rocfft_kernel_100_sbcc.h
 rocfft_kernel_100_sbrc.h
 rocfft_kernel_1024.h
+rocfft_kernel_1024_nt2.h
 rocfft_kernel_1080.h
+rocfft_kernel_1080_nt2.h
 rocfft_kernel_108.h
+rocfft_kernel_108_nt28.h
+rocfft_kernel_108_nt8.h
+rocfft_kernel_108_sbcc.h
+rocfft_kernel_108_sbrc.h
 rocfft_kernel_10.h
+rocfft_kernel_10_nt256.h
+rocfft_kernel_10_nt64.h
 rocfft_kernel_1125.h
+rocfft_kernel_1125_nt2.h
 rocfft_kernel_1152.h
+rocfft_kernel_1152_nt2.h
 rocfft_kernel_1200.h
+rocfft_kernel_1200_nt2.h
 rocfft_kernel_120.h
+rocfft_kernel_120_nt32.h
+rocfft_kernel_120_sbcc.h
+rocfft_kernel_120_sbrc.h
 rocfft_kernel_1215.h
+rocfft_kernel_1215_nt2.h
 rocfft_kernel_1250.h
+rocfft_kernel_1250_nt2.h
 rocfft_kernel_125.h
+rocfft_kernel_125_nt10.h
+rocfft_kernel_125_nt3.h
+rocfft_kernel_125_sbcc.h
+rocfft_kernel_125_sbrc.h
 rocfft_kernel_1280.h
+rocfft_kernel_1280_nt2.h
 rocfft_kernel_128.h
+rocfft_kernel_128_nt8.h
 rocfft_kernel_128_sbcc.h
 rocfft_kernel_128_sbrc.h
 rocfft_kernel_1296.h
+rocfft_kernel_1296_nt2.h
 rocfft_kernel_12.h
+rocfft_kernel_12_nt256.h
+rocfft_kernel_12_nt64.h
 rocfft_kernel_1350.h
+rocfft_kernel_1350_nt2.h
 rocfft_kernel_135.h
+rocfft_kernel_135_nt28.h
+rocfft_kernel_135_nt8.h
+rocfft_kernel_135_sbcc.h
+rocfft_kernel_135_sbrc.h
 rocfft_kernel_1440.h
+rocfft_kernel_1440_nt2.h
 rocfft_kernel_144.h
+rocfft_kernel_144_nt20.h
+rocfft_kernel_144_nt6.h
+rocfft_kernel_144_sbcc.h
+rocfft_kernel_144_sbrc.h
 rocfft_kernel_1458.h
 rocfft_kernel_1500.h
+rocfft_kernel_1500_nt2.h
 rocfft_kernel_150.h
+rocfft_kernel_150_nt24.h
+rocfft_kernel_150_sbcc.h
+rocfft_kernel_150_sbrc.h
 rocfft_kernel_1536.h
+rocfft_kernel_1536_nt2.h
 rocfft_kernel_15.h
+rocfft_kernel_15_nt256.h
+rocfft_kernel_15_nt64.h
 rocfft_kernel_1600.h
+rocfft_kernel_1600_nt2.h
 rocfft_kernel_160.h
+rocfft_kernel_160_nt16.h
+rocfft_kernel_160_sbcc.h
+rocfft_kernel_160_sbrc.h
 rocfft_kernel_1620.h
+rocfft_kernel_1620_nt2.h
 rocfft_kernel_162.h
+rocfft_kernel_162_nt3.h
+rocfft_kernel_162_sbcc.h
+rocfft_kernel_162_sbrc.h
 rocfft_kernel_16.h
+rocfft_kernel_16_nt32.h
+rocfft_kernel_16_sbcc.h
+rocfft_kernel_16_sbrc.h
 rocfft_kernel_1728.h
 rocfft_kernel_1800.h
+rocfft_kernel_1800_nt2.h
 rocfft_kernel_180.h
+rocfft_kernel_180_nt20.h
+rocfft_kernel_180_sbcc.h
+rocfft_kernel_180_sbrc.h
 rocfft_kernel_1875.h
+rocfft_kernel_1875_nt2.h
 rocfft_kernel_18.h
+rocfft_kernel_18_nt22.h
+rocfft_kernel_18_sbcc.h
+rocfft_kernel_18_sbrc.h
 rocfft_kernel_1920.h
+rocfft_kernel_1920_nt2.h
 rocfft_kernel_192.h
+rocfft_kernel_192_nt16.h
+rocfft_kernel_192_nt4.h
+rocfft_kernel_192_sbcc.h
+rocfft_kernel_192_sbrc.h
 rocfft_kernel_1944.h
 rocfft_kernel_1.h
+rocfft_kernel_1_nt128.h
 rocfft_kernel_2000.h
+rocfft_kernel_2000_nt2.h
 rocfft_kernel_200.h
+rocfft_kernel_200_nt12.h
+rocfft_kernel_200_sbcc.h
+rocfft_kernel_200_sbrc.h
 rocfft_kernel_2025.h
 rocfft_kernel_2048.h
 rocfft_kernel_20.h
+rocfft_kernel_20_nt128.h
+rocfft_kernel_20_sbcc.h
+rocfft_kernel_20_sbrc.h
 rocfft_kernel_2160.h
 rocfft_kernel_216.h
+rocfft_kernel_216_nt14.h
+rocfft_kernel_216_nt4.h
+rocfft_kernel_216_sbcc.h
+rocfft_kernel_216_sbrc.h
 rocfft_kernel_2187.h
 rocfft_kernel_2250.h
 rocfft_kernel_225.h
+rocfft_kernel_225_nt16.h
+rocfft_kernel_225_nt5.h
+rocfft_kernel_225_sbcc.h
+rocfft_kernel_225_sbrc.h
 rocfft_kernel_2304.h
 rocfft_kernel_2400.h
 rocfft_kernel_240.h
+rocfft_kernel_240_nt16.h
+rocfft_kernel_240_sbcc.h
+rocfft_kernel_240_sbrc.h
 rocfft_kernel_2430.h
 rocfft_kernel_243.h
+rocfft_kernel_243_nt1.h
+rocfft_kernel_243_sbcc.h
+rocfft_kernel_243_sbrc.h
 rocfft_kernel_24.h
+rocfft_kernel_24_nt128.h
+rocfft_kernel_24_nt32.h
+rocfft_kernel_24_sbcc.h
+rocfft_kernel_24_sbrc.h
 rocfft_kernel_2500.h
 rocfft_kernel_250.h
+rocfft_kernel_250_nt10.h
+rocfft_kernel_250_nt3.h
+rocfft_kernel_250_sbcc.h
+rocfft_kernel_250_sbrc.h
 rocfft_kernel_2560.h
 rocfft_kernel_256.h
+rocfft_kernel_256_nt2.h
 rocfft_kernel_256_sbcc.h
 rocfft_kernel_256_sbrc.h
 rocfft_kernel_2592.h
 rocfft_kernel_25.h
+rocfft_kernel_25_nt13.h
+rocfft_kernel_25_nt50.h
+rocfft_kernel_25_sbcc.h
+rocfft_kernel_25_sbrc.h
 rocfft_kernel_2700.h
 rocfft_kernel_270.h
+rocfft_kernel_270_nt14.h
+rocfft_kernel_270_sbcc.h
+rocfft_kernel_270_sbrc.h
 rocfft_kernel_27.h
+rocfft_kernel_27_nt8.h
+rocfft_kernel_27_sbcc.h
+rocfft_kernel_27_sbrc.h
 rocfft_kernel_2880.h
 rocfft_kernel_288.h
+rocfft_kernel_288_nt10.h
+rocfft_kernel_288_nt3.h
+rocfft_kernel_288_sbcc.h
+rocfft_kernel_288_sbrc.h
 rocfft_kernel_2916.h
 rocfft_kernel_2.h
+rocfft_kernel_2_nt128.h
 rocfft_kernel_2D_125_25.h
 rocfft_kernel_2D_128_16.h
 rocfft_kernel_2D_128_32.h
@@ -274,115 +430,335 @@ rocfft_kernel_2D_4_25.h
 rocfft_kernel_2D_125_16.h
 rocfft_kernel_2D_125_8.h
 rocfft_kernel_2D_125_4.h
+rocfft_kernel_2D_125_32.h
+rocfft_kernel_2D_32_125.h
+rocfft_kernel_2D_128_25.h
+rocfft_kernel_2D_25_128.h
 rocfft_kernel_2D_25_64.h
 rocfft_kernel_2D_25_32.h
 rocfft_kernel_2D_25_16.h
 rocfft_kernel_2D_25_8.h
 rocfft_kernel_2D_25_4.h
+rocfft_kernel_3D_16_16_4.h
+rocfft_kernel_3D_16_16_8.h
+rocfft_kernel_3D_16_4_16.h
+rocfft_kernel_3D_16_4_4.h
+rocfft_kernel_3D_16_4_8.h
+rocfft_kernel_3D_16_8_16.h
+rocfft_kernel_3D_16_8_4.h
+rocfft_kernel_3D_16_8_8.h
+rocfft_kernel_3D_25_5_5.h
+rocfft_kernel_3D_27_3_3.h
+rocfft_kernel_3D_27_3_9.h
+rocfft_kernel_3D_27_9_3.h
+rocfft_kernel_3D_32_4_4.h
+rocfft_kernel_3D_32_4_8.h
+rocfft_kernel_3D_32_8_4.h
+rocfft_kernel_3D_32_8_8.h
+rocfft_kernel_3D_3_27_3.h
+rocfft_kernel_3D_3_27_9.h
+rocfft_kernel_3D_3_3_27.h
+rocfft_kernel_3D_3_3_3.h
+rocfft_kernel_3D_3_3_81.h
+rocfft_kernel_3D_3_3_9.h
+rocfft_kernel_3D_3_81_3.h
+rocfft_kernel_3D_3_9_27.h
+rocfft_kernel_3D_3_9_3.h
+rocfft_kernel_3D_3_9_9.h
+rocfft_kernel_3D_4_16_16.h
+rocfft_kernel_3D_4_16_4.h
+rocfft_kernel_3D_4_16_8.h
+rocfft_kernel_3D_4_32_4.h
+rocfft_kernel_3D_4_32_8.h
+rocfft_kernel_3D_4_4_16.h
+rocfft_kernel_3D_4_4_32.h
+rocfft_kernel_3D_4_4_4.h
+rocfft_kernel_3D_4_4_64.h
+rocfft_kernel_3D_4_4_8.h
+rocfft_kernel_3D_4_64_4.h
+rocfft_kernel_3D_4_8_16.h
+rocfft_kernel_3D_4_8_32.h
+rocfft_kernel_3D_4_8_4.h
+rocfft_kernel_3D_4_8_8.h
+rocfft_kernel_3D_5_25_5.h
+rocfft_kernel_3D_5_5_25.h
+rocfft_kernel_3D_5_5_5.h
+rocfft_kernel_3D_64_4_4.h
+rocfft_kernel_3D_81_3_3.h
+rocfft_kernel_3D_8_16_16.h
+rocfft_kernel_3D_8_16_4.h
+rocfft_kernel_3D_8_16_8.h
+rocfft_kernel_3D_8_32_4.h
+rocfft_kernel_3D_8_32_8.h
+rocfft_kernel_3D_8_4_16.h
+rocfft_kernel_3D_8_4_32.h
+rocfft_kernel_3D_8_4_4.h
+rocfft_kernel_3D_8_4_8.h
+rocfft_kernel_3D_8_8_16.h
+rocfft_kernel_3D_8_8_32.h
+rocfft_kernel_3D_8_8_4.h
+rocfft_kernel_3D_8_8_8.h
+rocfft_kernel_3D_9_27_3.h
+rocfft_kernel_3D_9_3_27.h
+rocfft_kernel_3D_9_3_3.h
+rocfft_kernel_3D_9_3_9.h
+rocfft_kernel_3D_9_9_3.h
+rocfft_kernel_3D_9_9_9.h
 rocfft_kernel_3000.h
 rocfft_kernel_300.h
+rocfft_kernel_300_nt12.h
+rocfft_kernel_300_sbcc.h
+rocfft_kernel_300_sbrc.h
 rocfft_kernel_3072.h
 rocfft_kernel_30.h
+rocfft_kernel_30_nt128.h
+rocfft_kernel_30_sbcc.h
+rocfft_kernel_30_sbrc.h
 rocfft_kernel_3125.h
 rocfft_kernel_3200.h
 rocfft_kernel_320.h
+rocfft_kernel_320_nt8.h
+rocfft_kernel_320_sbcc.h
+rocfft_kernel_320_sbrc.h
 rocfft_kernel_3240.h
 rocfft_kernel_324.h
+rocfft_kernel_324_nt3.h
+rocfft_kernel_324_nt8.h
+rocfft_kernel_324_sbcc.h
+rocfft_kernel_324_sbrc.h
 rocfft_kernel_32.h
+rocfft_kernel_32_nt32.h
+rocfft_kernel_32_sbcc.h
+rocfft_kernel_32_sbrc.h
 rocfft_kernel_3375.h
 rocfft_kernel_3456.h
 rocfft_kernel_3600.h
 rocfft_kernel_360.h
+rocfft_kernel_360_nt10.h
+rocfft_kernel_360_sbcc.h
+rocfft_kernel_360_sbrc.h
 rocfft_kernel_3645.h
 rocfft_kernel_36.h
+rocfft_kernel_36_nt22.h
+rocfft_kernel_36_nt84.h
+rocfft_kernel_36_sbcc.h
+rocfft_kernel_36_sbrc.h
 rocfft_kernel_3750.h
 rocfft_kernel_375.h
+rocfft_kernel_375_nt10.h
+rocfft_kernel_375_nt3.h
+rocfft_kernel_375_sbcc.h
+rocfft_kernel_375_sbrc.h
 rocfft_kernel_3840.h
 rocfft_kernel_384.h
+rocfft_kernel_384_nt2.h
+rocfft_kernel_384_nt8.h
+rocfft_kernel_384_sbcc.h
+rocfft_kernel_384_sbrc.h
 rocfft_kernel_3888.h
 rocfft_kernel_3.h
+rocfft_kernel_3_nt64.h
 rocfft_kernel_4000.h
 rocfft_kernel_400.h
+rocfft_kernel_400_nt6.h
+rocfft_kernel_400_sbcc.h
+rocfft_kernel_400_sbrc.h
 rocfft_kernel_4050.h
 rocfft_kernel_405.h
+rocfft_kernel_405_nt3.h
+rocfft_kernel_405_nt8.h
+rocfft_kernel_405_sbcc.h
+rocfft_kernel_405_sbrc.h
 rocfft_kernel_4096.h
 rocfft_kernel_40.h
+rocfft_kernel_40_nt64.h
+rocfft_kernel_40_sbcc.h
+rocfft_kernel_40_sbrc.h
 rocfft_kernel_432.h
+rocfft_kernel_432_nt2.h
+rocfft_kernel_432_nt6.h
+rocfft_kernel_432_sbcc.h
+rocfft_kernel_432_sbrc.h
 rocfft_kernel_450.h
+rocfft_kernel_450_nt8.h
+rocfft_kernel_450_sbcc.h
+rocfft_kernel_450_sbrc.h
 rocfft_kernel_45.h
+rocfft_kernel_45_nt22.h
+rocfft_kernel_45_nt84.h
+rocfft_kernel_45_sbcc.h
+rocfft_kernel_45_sbrc.h
 rocfft_kernel_480.h
+rocfft_kernel_480_nt8.h
+rocfft_kernel_480_sbcc.h
+rocfft_kernel_480_sbrc.h
 rocfft_kernel_486.h
+rocfft_kernel_486_nt1.h
+rocfft_kernel_486_sbcc.h
+rocfft_kernel_486_sbrc.h
 rocfft_kernel_48.h
+rocfft_kernel_48_nt16.h
+rocfft_kernel_48_nt64.h
+rocfft_kernel_48_sbcc.h
+rocfft_kernel_48_sbrc.h
 rocfft_kernel_4.h
+rocfft_kernel_4_nt64.h
 rocfft_kernel_500.h
+rocfft_kernel_500_nt4.h
+rocfft_kernel_500_sbcc.h
+rocfft_kernel_500_sbrc.h
 rocfft_kernel_50.h
+rocfft_kernel_50_nt13.h
+rocfft_kernel_50_nt50.h
+rocfft_kernel_50_sbcc.h
+rocfft_kernel_50_sbrc.h
 rocfft_kernel_512.h
+rocfft_kernel_512_nt2.h
+rocfft_kernel_512_sbcc.h
+rocfft_kernel_512_sbrc.h
 rocfft_kernel_540.h
+rocfft_kernel_540_nt6.h
 rocfft_kernel_54.h
+rocfft_kernel_54_nt8.h
+rocfft_kernel_54_sbcc.h
+rocfft_kernel_54_sbrc.h
 rocfft_kernel_576.h
+rocfft_kernel_576_nt4.h
 rocfft_kernel_5.h
+rocfft_kernel_5_nt250.h
+rocfft_kernel_5_nt64.h
 rocfft_kernel_600.h
+rocfft_kernel_600_nt6.h
 rocfft_kernel_60.h
+rocfft_kernel_60_nt64.h
+rocfft_kernel_60_sbcc.h
+rocfft_kernel_60_sbrc.h
 rocfft_kernel_625.h
+rocfft_kernel_625_nt2.h
 rocfft_kernel_640.h
+rocfft_kernel_640_nt4.h
 rocfft_kernel_648.h
+rocfft_kernel_648_nt4.h
 rocfft_kernel_64.h
+rocfft_kernel_64_nt8.h
 rocfft_kernel_64_sbcc.h
 rocfft_kernel_64_sbrc.h
 rocfft_kernel_675.h
+rocfft_kernel_675_nt4.h
 rocfft_kernel_6.h
+rocfft_kernel_6_nt64.h
 rocfft_kernel_720.h
+rocfft_kernel_720_nt4.h
 rocfft_kernel_729.h
 rocfft_kernel_72.h
+rocfft_kernel_72_nt11.h
+rocfft_kernel_72_nt42.h
+rocfft_kernel_72_sbcc.h
+rocfft_kernel_72_sbrc.h
 rocfft_kernel_750.h
+rocfft_kernel_750_nt4.h
 rocfft_kernel_75.h
+rocfft_kernel_75_nt13.h
+rocfft_kernel_75_nt50.h
+rocfft_kernel_75_sbcc.h
+rocfft_kernel_75_sbrc.h
 rocfft_kernel_768.h
+rocfft_kernel_768_nt1.h
+rocfft_kernel_768_nt4.h
 rocfft_kernel_800.h
+rocfft_kernel_800_nt2.h
 rocfft_kernel_80.h
+rocfft_kernel_80_nt32.h
+rocfft_kernel_80_sbcc.h
+rocfft_kernel_80_sbrc.h
 rocfft_kernel_810.h
+rocfft_kernel_810_nt4.h
 rocfft_kernel_81.h
+rocfft_kernel_81_nt3.h
 rocfft_kernel_81_sbcc.h
 rocfft_kernel_81_sbrc.h
 rocfft_kernel_864.h
+rocfft_kernel_864_nt2.h
 rocfft_kernel_8.h
+rocfft_kernel_8_nt64.h
 rocfft_kernel_900.h
+rocfft_kernel_900_nt4.h
 rocfft_kernel_90.h
+rocfft_kernel_90_nt42.h
+rocfft_kernel_90_sbcc.h
+rocfft_kernel_90_sbrc.h
 rocfft_kernel_960.h
+rocfft_kernel_960_nt4.h
 rocfft_kernel_96.h
+rocfft_kernel_96_nt32.h
+rocfft_kernel_96_nt8.h
+rocfft_kernel_96_sbcc.h
+rocfft_kernel_96_sbrc.h
 rocfft_kernel_972.h
+rocfft_kernel_972_nt2.h
 rocfft_kernel_9.h
+rocfft_kernel_9_nt22.h
 rocfft_kernel_7.h
+rocfft_kernel_7_nt98.h
+rocfft_kernel_28.h
+rocfft_kernel_28_nt64.h
 rocfft_kernel_49.h
+rocfft_kernel_49_nt14.h
+rocfft_kernel_42.h
+rocfft_kernel_56.h
+rocfft_kernel_56_nt32.h
 rocfft_kernel_84.h
 rocfft_kernel_112.h
+rocfft_kernel_112_nt16.h
 )
 
 set( kernels_launch
 kernel_launch_generator.h
+rocfft_butterfly_host.h
 function_pool.cpp.h
 function_pool.cpp
 kernel_launch_single_large.cpp.h
 kernel_launch_single_large.cpp
 kernel_launch_double_large.cpp.h
 kernel_launch_double_large.cpp
+kernel_launch_half_large.cpp.h
+kernel_launch_half_large.cpp
 kernel_launch_single_2D_pow2.cpp
 kernel_launch_double_2D_pow2.cpp
+kernel_launch_half_2D_pow2.cpp
 kernel_launch_single_2D_pow3.cpp
 kernel_launch_double_2D_pow3.cpp
+kernel_launch_half_2D_pow3.cpp
 kernel_launch_single_2D_pow5.cpp
 kernel_launch_double_2D_pow5.cpp
+kernel_launch_half_2D_pow5.cpp
 kernel_launch_single_2D_mix_pow2_3.cpp
 kernel_launch_double_2D_mix_pow2_3.cpp
+kernel_launch_half_2D_mix_pow2_3.cpp
 kernel_launch_single_2D_mix_pow3_2.cpp
 kernel_launch_double_2D_mix_pow3_2.cpp
+kernel_launch_half_2D_mix_pow3_2.cpp
 kernel_launch_single_2D_mix_pow3_5.cpp
 kernel_launch_double_2D_mix_pow3_5.cpp
+kernel_launch_half_2D_mix_pow3_5.cpp
 kernel_launch_single_2D_mix_pow5_3.cpp
 kernel_launch_double_2D_mix_pow5_3.cpp
+kernel_launch_half_2D_mix_pow5_3.cpp
 kernel_launch_single_2D_mix_pow2_5.cpp
 kernel_launch_double_2D_mix_pow2_5.cpp
+kernel_launch_half_2D_mix_pow2_5.cpp
 kernel_launch_single_2D_mix_pow5_2.cpp
 kernel_launch_double_2D_mix_pow5_2.cpp
+kernel_launch_half_2D_mix_pow5_2.cpp
+kernel_launch_single_3D_pow2.cpp
+kernel_launch_double_3D_pow2.cpp
+kernel_launch_half_3D_pow2.cpp
+kernel_launch_single_3D_pow3.cpp
+kernel_launch_double_3D_pow3.cpp
+kernel_launch_half_3D_pow3.cpp
+kernel_launch_single_3D_pow5.cpp
+kernel_launch_double_3D_pow5.cpp
+kernel_launch_half_3D_pow5.cpp
 )
 
 set( small_kernels_group_num 8 )
@@ -392,8 +768,11 @@ foreach(small_kernel_group_id RANGE 0 ${max_group_num} )
     string(CONCAT small_kernel_single_h_file "kernel_launch_single_" ${small_kernel_group_id} ".cpp.h")
     string(CONCAT small_kernel_double_file "kernel_launch_double_" ${small_kernel_group_id} ".cpp")
     string(CONCAT small_kernel_double_h_file "kernel_launch_double_" ${small_kernel_group_id} ".cpp.h")
+    string(CONCAT small_kernel_half_file "kernel_launch_half_" ${small_kernel_group_id} ".cpp")
+    string(CONCAT small_kernel_half_h_file "kernel_launch_half_" ${small_kernel_group_id} ".cpp.h")
 
     list(APPEND kernels_launch ${small_kernel_single_file} ${small_kernel_single_h_file})
     list(APPEND kernels_launch ${small_kernel_double_file} ${small_kernel_double_h_file})
+    list(APPEND kernels_launch ${small_kernel_half_file} ${small_kernel_half_h_file})
 endforeach(small_kernel_group_id)
 
@@ -18,6 +18,7 @@ namespace StockhamGenerator
         size_t count; // Number of basic butterflies, valid values: 1,2,4
         bool   fwd; // FFT direction
         bool   cReg; // registers are complex numbers, .x (real), .y(imag)
+        bool   host; // emit a host function instead of a device function
 
         size_t BitReverse(size_t n, size_t N) const
         {
@@ -30,7 +31,7 @@ namespace StockhamGenerator
 
             // Function attribute
             bflyStr += "template <typename T>\n";
-            bflyStr += "__device__ void \n";
+            bflyStr += host ? "void \n" : "__device__ void \n";
 
             // Function name
             bflyStr += ButterflyName(radix, count, fwd);
@@ -109,7 +110,7 @@ namespace StockhamGenerator
                 {
                     bflyStr += "\t";
                     bflyStr += RegBaseType<PR>(2);
-                    bflyStr += " T;";
+                    bflyStr += " TMP;";
                 }
             }
 
@@ -213,7 +214,7 @@ namespace StockhamGenerator
                                    "\n\t"
                                    "(*R2) = (*R0) - (*R2);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R2);\n\t"
-                                   "(*R3) = (*R1) + (fvect2)(-(*R3).y, (*R3).x);\n\t"
+                                   "(*R3) = (*R1) + T(-(*R3).y, (*R3).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R3);\n\t";
                     }
                     else
@@ -242,7 +243,7 @@ namespace StockhamGenerator
                                    "\n\t"
                                    "(*R2) = (*R0) - (*R2);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R2);\n\t"
-                                   "(*R3) = (*R1) + (fvect2)((*R3).y, -(*R3).x);\n\t"
+                                   "(*R3) = (*R1) + T((*R3).y, -(*R3).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R3);\n\t";
                     }
                     else
@@ -973,21 +974,21 @@ namespace StockhamGenerator
                                    "\n\t"
                                    "(*R2) = (*R0) - (*R2);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R2);\n\t"
-                                   "(*R3) = (*R1) + (fvect2)(-(*R3).y, (*R3).x);\n\t"
+                                   "(*R3) = (*R1) + T(-(*R3).y, (*R3).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R3);\n\t"
                                    "(*R6) = (*R4) - (*R6);\n\t"
                                    "(*R4) = 2.0f * (*R4) - (*R6);\n\t"
-                                   "(*R7) = (*R5) + (fvect2)(-(*R7).y, (*R7).x);\n\t"
+                                   "(*R7) = (*R5) + T(-(*R7).y, (*R7).x);\n\t"
                                    "(*R5) = 2.0f * (*R5) - (*R7);\n\t"
                                    "\n\t"
                                    "(*R4) = (*R0) - (*R4);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R4);\n\t"
-                                   "(*R5) = ((*R1) - C8Q * (*R5)) - C8Q * (fvect2)((*R5).y, "
+                                   "(*R5) = ((*R1) - C8Q * (*R5)) - C8Q * T((*R5).y, "
                                    "-(*R5).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R5);\n\t"
-                                   "(*R6) = (*R2) + (fvect2)(-(*R6).y, (*R6).x);\n\t"
+                                   "(*R6) = (*R2) + T(-(*R6).y, (*R6).x);\n\t"
                                    "(*R2) = 2.0f * (*R2) - (*R6);\n\t"
-                                   "(*R7) = ((*R3) + C8Q * (*R7)) - C8Q * (fvect2)((*R7).y, "
+                                   "(*R7) = ((*R3) + C8Q * (*R7)) - C8Q * T((*R7).y, "
                                    "-(*R7).x);\n\t"
                                    "(*R3) = 2.0f * (*R3) - (*R7);\n\t";
                     }
@@ -1061,21 +1062,21 @@ namespace StockhamGenerator
                                    "\n\t"
                                    "(*R2) = (*R0) - (*R2);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R2);\n\t"
-                                   "(*R3) = (*R1) + (fvect2)((*R3).y, -(*R3).x);\n\t"
+                                   "(*R3) = (*R1) + T((*R3).y, -(*R3).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R3);\n\t"
                                    "(*R6) = (*R4) - (*R6);\n\t"
                                    "(*R4) = 2.0f * (*R4) - (*R6);\n\t"
-                                   "(*R7) = (*R5) + (fvect2)((*R7).y, -(*R7).x);\n\t"
+                                   "(*R7) = (*R5) + T((*R7).y, -(*R7).x);\n\t"
                                    "(*R5) = 2.0f * (*R5) - (*R7);\n\t"
                                    "\n\t"
                                    "(*R4) = (*R0) - (*R4);\n\t"
                                    "(*R0) = 2.0f * (*R0) - (*R4);\n\t"
-                                   "(*R5) = ((*R1) - C8Q * (*R5)) + C8Q * (fvect2)((*R5).y, "
+                                   "(*R5) = ((*R1) - C8Q * (*R5)) + C8Q * T((*R5).y, "
                                    "-(*R5).x);\n\t"
                                    "(*R1) = 2.0f * (*R1) - (*R5);\n\t"
-                                   "(*R6) = (*R2) + (fvect2)((*R6).y, -(*R6).x);\n\t"
+                                   "(*R6) = (*R2) + T((*R6).y, -(*R6).x);\n\t"
                                    "(*R2) = 2.0f * (*R2) - (*R6);\n\t"
-                                   "(*R7) = ((*R3) + C8Q * (*R7)) + C8Q * (fvect2)((*R7).y, "
+                                   "(*R7) = ((*R3) + C8Q * (*R7)) + C8Q * T((*R7).y, "
                                    "-(*R7).x);\n\t"
                                    "(*R3) = 2.0f * (*R3) - (*R7);\n\t";
                     }
@@ -1948,7 +1949,7 @@ namespace StockhamGenerator
 
                     if(i < j)
                     {
-                        bflyStr += "T = (*R";
+                        bflyStr += "TMP = (*R";
                         bflyStr += std::to_string(i);
                         bflyStr += "); (*R";
                         bflyStr += std::to_string(i);
@@ -1956,7 +1957,7 @@ namespace StockhamGenerator
                         bflyStr += std::to_string(j);
                         bflyStr += "); (*R";
                         bflyStr += std::to_string(j);
-                        bflyStr += ") = T;\n\t";
+                        bflyStr += ") = TMP;\n\t";
                     }
                 }
             }
@@ -1965,11 +1966,13 @@ namespace StockhamGenerator
         }
 
     public:
-        Butterfly(size_t radixVal, size_t countVal, bool fwdVal, bool cRegVal)
+        Butterfly(
+            size_t radixVal, size_t countVal, bool fwdVal, bool cRegVal, bool hostVal = false)
             : radix(radixVal)
             , count(countVal)
             , fwd(fwdVal)
             , cReg(cRegVal)
+            , host(hostVal)
         {
         }
 
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include "generator.butterfly.hpp"
 #include "generator.kernel.hpp"
 #include "generator.param.h"
 #include "generator.pass.hpp"
@@ -19,6 +20,40 @@
 
 using namespace StockhamGenerator;
 
+/* =====================================================================
+   Lengths whose Stockham kernels also have variants with even-length
+   real post/pre-processing fused in, for a precision
+=================================================================== */
+static bool real_fused_length(size_t len, rocfft_precision precision)
+{
+    KernelCoreSpecs kcs;
+    auto GetWGSAndNT = [&kcs](size_t length, size_t& workGroupSize, size_t& numTransforms) {
+        return kcs.GetWGSAndNT(length, workGroupSize, numTransforms);
+    };
+    return RealFusedFitsLDS(len, 0, precision, GetWGSAndNT);
+}
+
+/* =====================================================================
+   Transforms per thread block of the variants of a length's Stockham
+   kernel besides the default, named with an "_nt<transforms>" suffix.
+   Kernel sources are written for the single-precision variants, which
+   include the double-precision ones; half precision uses single's.
+=================================================================== */
+static std::vector<size_t> nt_variants(size_t len, rocfft_precision precision)
+{
+    KernelCoreSpecs kcs;
+    auto GetWGSAndNT = [&kcs](size_t length, size_t& workGroupSize, size_t& numTransforms) {
+        return kcs.GetWGSAndNT(length, workGroupSize, numTransforms);
+    };
+    auto nts = StockhamTransformsPerBlock(len, precision, GetWGSAndNT);
+    return std::vector<size_t>(nts.begin() + 1, nts.end());
+}
+
+static std::string nt_suffix(size_t nt)
+{
+    return "_nt" + std::to_string(nt);
+}
+
 /* =====================================================================
             Initial parameter used to generate kernels
 =================================================================== */
@@ -139,12 +174,63 @@ void WriteButterflyToFile(std::string& str, int LEN)
     file.close();
 }
 
+/* =====================================================================
+   Write host butterfly functions to rocfft_butterfly_host.h, used by
+   the host execution backend
+=================================================================== */
+void WriteHostButterfliesToFile()
+{
+    std::string str;
+
+    str += "\n";
+    str += "#pragma once\n";
+    str += "#if !defined( rocfft_butterfly_host_H )\n";
+    str += "#define rocfft_butterfly_host_H \n";
+    str += "\n";
+    str += "#include \"butterfly_constant.h\"\n";
+    str += "\n";
+    str += "namespace host_butterfly\n";
+    str += "{\n";
+    str += "    template <typename T>\n";
+    str += "    using real_type_t = decltype(T::x);\n";
+    str += "\n";
+
+    for(size_t rad : HostButterflyRadices())
+    {
+        for(bool fwd : {true, false})
+        {
+            // T needs .x/.y members, a (x, y) constructor and the usual arithmetic
+            // operators, including multiplication by a scalar.  .x/.y may be SIMD
+            // vectors, to run one butterfly per lane.
+            Butterfly<rocfft_precision_single> bfly(rad, 1, fwd, true, true);
+            bfly.GenerateButterfly(str);
+            str += "\n";
+        }
+    }
+
+    str += "}\n";
+    str += "\n";
+    str += "#endif\n";
+
+    std::ofstream file;
+    file.open("rocfft_butterfly_host.h");
+    if(!file.is_open())
+    {
+        std::cout << "File: rocfft_butterfly_host.h could not be opened, exiting ...."
+                  << std::endl;
+    }
+    file << str;
+    file.close();
+}
+
 /* =====================================================================
    Write CPU functions (launching kernel) header to file
 =================================================================== */
-void WriteCPUHeaders(const std::vector<size_t>&                                    support_list,
-                     const std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
-                     const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D)
+void WriteCPUHeaders(
+    const std::vector<size_t>&                                            support_list,
+    const std::vector<std::tuple<size_t, ComputeScheme>>&                 large1D_list,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D)
 {
 
     std::string str;
@@ -166,6 +252,24 @@ void WriteCPUHeaders(const std::vector<size_t>&
         str += "void rocfft_internal_dfn_sp_ci_ci_stoc_";
         str += str_len + "(const void *data_p, void *back_p);\n";
     }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_single))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "void rocfft_internal_dfn_sp_ci_ci_stoc_real_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+    }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        std::string str_len = std::to_string(support_list[i]);
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_single))
+        {
+            str += "void rocfft_internal_dfn_sp_ci_ci_stoc_";
+            str += str_len + nt_suffix(nt) + "(const void *data_p, void *back_p);\n";
+        }
+    }
 
     str += "\n";
     for(size_t i = 0; i < support_list.size(); i++)
@@ -175,6 +279,51 @@ void WriteCPUHeaders(const std::vector<size_t>&
         str += "void rocfft_internal_dfn_dp_ci_ci_stoc_";
         str += str_len + "(const void *data_p, void *back_p);\n";
     }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_double))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "void rocfft_internal_dfn_dp_ci_ci_stoc_real_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+    }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        std::string str_len = std::to_string(support_list[i]);
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_double))
+        {
+            str += "void rocfft_internal_dfn_dp_ci_ci_stoc_";
+            str += str_len + nt_suffix(nt) + "(const void *data_p, void *back_p);\n";
+        }
+    }
+
+    str += "\n";
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "void rocfft_internal_dfn_hp_ci_ci_stoc_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+    }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_single))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "void rocfft_internal_dfn_hp_ci_ci_stoc_real_";
+        str += str_len + "(const void *data_p, void *back_p);\n";
+    }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        std::string str_len = std::to_string(support_list[i]);
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_single))
+        {
+            str += "void rocfft_internal_dfn_hp_ci_ci_stoc_";
+            str += str_len + nt_suffix(nt) + "(const void *data_p, void *back_p);\n";
+        }
+    }
 
     str += "\n";
     // write large 1D kernels single
@@ -205,6 +354,17 @@ void WriteCPUHeaders(const std::vector<size_t>&
             str += "void rocfft_internal_dfn_dp_op_ci_ci_sbrc_";
             str += str_len + "(const void *data_p, void *back_p);\n";
         }
+
+        if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+        {
+            str += "void rocfft_internal_dfn_hp_ci_ci_sbcc_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
+        else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+        {
+            str += "void rocfft_internal_dfn_hp_op_ci_ci_sbrc_";
+            str += str_len + "(const void *data_p, void *back_p);\n";
+        }
     }
 
     str += "\n";
@@ -224,6 +384,25 @@ void WriteCPUHeaders(const std::vector<size_t>&
         {
             str += "void rocfft_internal_dfn_sp_ci_ci_2D_" + suffix;
             str += "void rocfft_internal_dfn_dp_ci_ci_2D_" + suffix;
+            str += "void rocfft_internal_dfn_hp_ci_ci_2D_" + suffix;
+        }
+    }
+
+    str += "\n";
+    // write 3d fused
+    for(const auto& kernel : support_list_3D)
+    {
+        std::string suffix = std::to_string(std::get<0>(kernel)) + "_"
+                             + std::to_string(std::get<1>(kernel)) + "_"
+                             + std::to_string(std::get<2>(kernel))
+                             + "(const void *data_p, void *back_p);\n";
+
+        ComputeScheme scheme = std::get<3>(kernel);
+        if(scheme == CS_KERNEL_3D_SINGLE)
+        {
+            str += "void rocfft_internal_dfn_sp_ci_ci_3D_" + suffix;
+            str += "void rocfft_internal_dfn_dp_ci_ci_3D_" + suffix;
+            str += "void rocfft_internal_dfn_hp_ci_ci_3D_" + suffix;
         }
     }
 
@@ -270,6 +449,16 @@ void write_cpu_function_small(std::vector<size_t> support_list,
         short_name_precision   = "dp";
         complex_case_precision = "double2";
     }
+    else if(precision == "half")
+    {
+        large_case_precision   = "HALF";
+        short_name_precision   = "hp";
+        complex_case_precision = "rocfft_half2";
+    }
+
+    // half precision uses the same fused lengths and variants as single
+    rocfft_precision table_precision
+        = precision == "double" ? rocfft_precision_double : rocfft_precision_single;
 
     size_t group_size = (support_list.size() + group_num - 1) / group_num;
     for(size_t j = 0; j < group_num; j++)
@@ -289,6 +478,8 @@ void write_cpu_function_small(std::vector<size_t> support_list,
             std::string str_len = std::to_string(support_list[i]);
 
             str += "#include \"rocfft_kernel_" + str_len + ".h\" \n";
+            for(auto nt : nt_variants(support_list[i], table_precision))
+                str += "#include \"rocfft_kernel_" + str_len + nt_suffix(nt) + ".h\" \n";
         }
 
         str += "\n";
@@ -304,6 +495,29 @@ void write_cpu_function_small(std::vector<size_t> support_list,
                    + complex_case_precision + ")\n";
         }
 
+        for(size_t i = i_start; i < i_end; i++)
+        {
+            if(!real_fused_length(support_list[i], table_precision))
+                continue;
+
+            std::string str_len = std::to_string(support_list[i]);
+            str += "POWX_REAL_FUSED_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+                   + "_ci_ci_stoc_real_" + str_len + ", fft_fwd_len" + str_len + "_r2c"
+                   + ", fft_back_len" + str_len + "_c2r, " + complex_case_precision + ")\n";
+        }
+
+        for(size_t i = i_start; i < i_end; i++)
+        {
+            for(auto nt : nt_variants(support_list[i], table_precision))
+            {
+                std::string str_len = std::to_string(support_list[i]) + nt_suffix(nt);
+                str += "POWX_SMALL_GENERATOR( rocfft_internal_dfn_" + short_name_precision
+                       + "_ci_ci_stoc_" + str_len + ", fft_fwd_ip_len" + str_len
+                       + ", fft_back_ip_len" + str_len + ", fft_fwd_op_len" + str_len
+                       + ", fft_back_op_len" + str_len + ", " + complex_case_precision + ")\n";
+            }
+        }
+
         std::ofstream file;
         std::string   headerFileName
             = "kernel_launch_" + precision + "_" + std::to_string(j) + ".cpp.h";
@@ -348,6 +562,11 @@ void write_cpu_function_large(std::vector<std::tuple<size_t, ComputeScheme>> lar
         complex_case_precision = "double2";
         short_name_precision   = "dp";
     }
+    else if(precision == "half")
+    {
+        complex_case_precision = "rocfft_half2";
+        short_name_precision   = "hp";
+    }
 
     str += "\n";
     str += "#include \"kernel_launch.h\" \n"; // kernel_launch.h has the required
@@ -512,6 +731,11 @@ void write_cpu_function_2D(const std::vector<std::tuple<size_t, size_t, ComputeS
         complex_case_precision = "double2";
         short_name_precision   = "dp";
     }
+    else if(precision == "half")
+    {
+        complex_case_precision = "rocfft_half2";
+        short_name_precision   = "hp";
+    }
 
     std::map<std::string, std::ofstream> files;
     for(const auto& kernel : list_2D)
@@ -541,14 +765,119 @@ void write_cpu_function_2D(const std::vector<std::tuple<size_t, size_t, ComputeS
     }
 }
 
+/* =====================================================================
+   Write CPU functions for launching fused 3D kernels to *.cpp.h
+=================================================================== */
+std::string get_3D_type(const std::tuple<size_t, size_t, size_t, ComputeScheme>& dim)
+{
+    if(IsPo2(std::get<0>(dim)) && IsPo2(std::get<1>(dim)) && IsPo2(std::get<2>(dim)))
+    {
+        return "pow2";
+    }
+    else if(IsPow<3>(std::get<0>(dim)) && IsPow<3>(std::get<1>(dim)) && IsPow<3>(std::get<2>(dim)))
+    {
+        return "pow3";
+    }
+    else if(IsPow<5>(std::get<0>(dim)) && IsPow<5>(std::get<1>(dim)) && IsPow<5>(std::get<2>(dim)))
+    {
+        return "pow5";
+    }
+    // not implemented, fail the build
+    abort();
+}
+
+std::ofstream& open_3D_file(const std::tuple<size_t, size_t, size_t, ComputeScheme>& dim,
+                            const std::string&                                       precision,
+                            std::map<std::string, std::ofstream>&                    files)
+{
+    std::string type = get_3D_type(dim);
+
+    std::string    headerFileName = "kernel_launch_" + precision + "_3D_" + type + ".cpp.h";
+    auto           result         = files.emplace(type, headerFileName);
+    std::ofstream& file           = result.first->second;
+
+    // if it was newly opened, initialize the file
+    if(result.second)
+    {
+        if(!file.is_open())
+        {
+            // can't continue, fail the build
+            std::cout << "Failed to open " << headerFileName << " for writing, aborting\n";
+            abort();
+        }
+        file << "#include \"kernel_launch.h\"\n";
+
+        // write source file to include this header
+        std::string   sourceFileName = "kernel_launch_" + precision + "_3D_" + type + ".cpp";
+        std::ofstream sourceFile(sourceFileName);
+        if(!sourceFile.is_open())
+        {
+            // fail build
+            std::cout << "File: " << sourceFileName << " could not be opened, exiting ...."
+                      << std::endl;
+            abort();
+        }
+        sourceFile << "#include \"" << headerFileName << "\"";
+    }
+    return file;
+}
+
+void write_cpu_function_3D(
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& list_3D,
+    const std::string&                                                    precision)
+{
+    std::string complex_case_precision = "float2";
+    std::string short_name_precision   = "sp";
+
+    if(precision == "double")
+    {
+        complex_case_precision = "double2";
+        short_name_precision   = "dp";
+    }
+    else if(precision == "half")
+    {
+        complex_case_precision = "rocfft_half2";
+        short_name_precision   = "hp";
+    }
+
+    std::map<std::string, std::ofstream> files;
+    for(const auto& kernel : list_3D)
+    {
+        std::ofstream& file          = open_3D_file(kernel, precision, files);
+        std::string    length_suffix = "_3D_" + std::to_string(std::get<0>(kernel)) + "_"
+                                    + std::to_string(std::get<1>(kernel)) + "_"
+                                    + std::to_string(std::get<2>(kernel));
+
+        file << "#include \"rocfft_kernel" << length_suffix << ".h\"\n";
+
+        ComputeScheme scheme = std::get<3>(kernel);
+        if(scheme == CS_KERNEL_3D_SINGLE)
+        {
+            // 3D single kernels take the same arguments as the small
+            // 1D kernels, so launch them the same way
+            file << "POWX_SMALL_GENERATOR(rocfft_internal_dfn_" << short_name_precision << "_ci_ci"
+                 << length_suffix << ", fft_fwd_ip" << length_suffix << ", fft_back_ip"
+                 << length_suffix << ", fft_fwd_op" << length_suffix << ", fft_back_op"
+                 << length_suffix << ", " << complex_case_precision << ")\n";
+        }
+        else
+        {
+            // not implemented yet
+            abort();
+        }
+    }
+}
+
 /* =====================================================================
    Add CPU funtions to function pools (a hash map)
 =================================================================== */
 void AddCPUFunctionToPool(
     const std::vector<size_t>&                                    support_list,
     const std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
-    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_single,
-    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_double)
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D_single,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D_double,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D_single,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D_double)
 {
     std::string str;
 
@@ -570,6 +899,31 @@ void AddCPUFunctionToPool(
                + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_sp_ci_ci_stoc_";
         str += str_len + ";\n";
     }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_single))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "\tfunction_map_single[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM_R_TO_CMPLX)] = &rocfft_internal_dfn_sp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+        str += "\tfunction_map_single[std::make_pair(" + str_len
+               + ",CS_KERNEL_CMPLX_TO_R_STOCKHAM)] = &rocfft_internal_dfn_sp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+    }
+
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_single))
+        {
+            std::string str_len = std::to_string(support_list[i]);
+            std::string str_nt  = std::to_string(nt);
+            str += "\tfunction_map_single_nt[std::make_tuple(" + str_len + ", " + str_nt
+                   + ", CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_sp_ci_ci_stoc_" + str_len
+                   + nt_suffix(nt) + ";\n";
+        }
+    }
 
     str += "\n";
     str += "\t//double precision \n";
@@ -580,6 +934,66 @@ void AddCPUFunctionToPool(
                + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_dp_ci_ci_stoc_";
         str += str_len + ";\n";
     }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_double))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "\tfunction_map_double[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM_R_TO_CMPLX)] = &rocfft_internal_dfn_dp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+        str += "\tfunction_map_double[std::make_pair(" + str_len
+               + ",CS_KERNEL_CMPLX_TO_R_STOCKHAM)] = &rocfft_internal_dfn_dp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+    }
+
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_double))
+        {
+            std::string str_len = std::to_string(support_list[i]);
+            std::string str_nt  = std::to_string(nt);
+            str += "\tfunction_map_double_nt[std::make_tuple(" + str_len + ", " + str_nt
+                   + ", CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_dp_ci_ci_stoc_" + str_len
+                   + nt_suffix(nt) + ";\n";
+        }
+    }
+
+    str += "\n";
+    str += "\t//half precision \n";
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        std::string str_len = std::to_string(support_list[i]);
+        str += "\tfunction_map_half[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_hp_ci_ci_stoc_";
+        str += str_len + ";\n";
+    }
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        if(!real_fused_length(support_list[i], rocfft_precision_single))
+            continue;
+
+        std::string str_len = std::to_string(support_list[i]);
+        str += "\tfunction_map_half[std::make_pair(" + str_len
+               + ",CS_KERNEL_STOCKHAM_R_TO_CMPLX)] = &rocfft_internal_dfn_hp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+        str += "\tfunction_map_half[std::make_pair(" + str_len
+               + ",CS_KERNEL_CMPLX_TO_R_STOCKHAM)] = &rocfft_internal_dfn_hp_ci_ci_stoc_real_";
+        str += str_len + ";\n";
+    }
+
+    for(size_t i = 0; i < support_list.size(); i++)
+    {
+        for(auto nt : nt_variants(support_list[i], rocfft_precision_single))
+        {
+            std::string str_len = std::to_string(support_list[i]);
+            std::string str_nt  = std::to_string(nt);
+            str += "\tfunction_map_half_nt[std::make_tuple(" + str_len + ", " + str_nt
+                   + ", CS_KERNEL_STOCKHAM)] = &rocfft_internal_dfn_hp_ci_ci_stoc_" + str_len
+                   + nt_suffix(nt) + ";\n";
+        }
+    }
 
     str += "\n";
 
@@ -635,6 +1049,30 @@ void AddCPUFunctionToPool(
         }
     }
 
+    // write large 1D kernels half
+    for(size_t i = 0; i < large1D_list.size(); i++)
+    {
+
+        auto          my_tuple = large1D_list[i];
+        std::string   str_len  = std::to_string(std::get<0>(my_tuple));
+        ComputeScheme scheme   = std::get<1>(my_tuple);
+
+        if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+        {
+            str += "\tfunction_map_half[std::make_pair(" + str_len
+                   + ", CS_KERNEL_STOCKHAM_BLOCK_CC)] = "
+                     "&rocfft_internal_dfn_hp_ci_ci_sbcc_"
+                   + str_len + ";\n";
+        }
+        else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+        {
+            str += "\tfunction_map_half[std::make_pair(" + str_len
+                   + ", CS_KERNEL_STOCKHAM_BLOCK_RC)] = "
+                     "&rocfft_internal_dfn_hp_op_ci_ci_sbrc_"
+                   + str_len + ";\n";
+        }
+    }
+
     for(const auto& kernel : support_list_2D_single)
     {
         std::string   str_len_1 = std::to_string(std::get<0>(kernel));
@@ -646,6 +1084,12 @@ void AddCPUFunctionToPool(
                    + ", CS_KERNEL_2D_SINGLE)] = "
                      "&rocfft_internal_dfn_sp_ci_ci_2D_"
                    + str_len_1 + "_" + str_len_2 + ";\n";
+            // half-precision 2D kernels are instantiated from the
+            // single-precision size list
+            str += "\tfunction_map_half_2D[std::make_tuple(" + str_len_1 + ", " + str_len_2
+                   + ", CS_KERNEL_2D_SINGLE)] = "
+                     "&rocfft_internal_dfn_hp_ci_ci_2D_"
+                   + str_len_1 + "_" + str_len_2 + ";\n";
         }
         else
         {
@@ -671,6 +1115,50 @@ void AddCPUFunctionToPool(
             abort();
         }
     }
+    for(const auto& kernel : support_list_3D_single)
+    {
+        std::string lens = std::to_string(std::get<0>(kernel)) + ", "
+                           + std::to_string(std::get<1>(kernel)) + ", "
+                           + std::to_string(std::get<2>(kernel));
+        std::string suffix = std::to_string(std::get<0>(kernel)) + "_"
+                             + std::to_string(std::get<1>(kernel)) + "_"
+                             + std::to_string(std::get<2>(kernel));
+        if(std::get<3>(kernel) == CS_KERNEL_3D_SINGLE)
+        {
+            str += "\tfunction_map_single_3D[std::make_tuple(" + lens
+                   + ", CS_KERNEL_3D_SINGLE)] = &rocfft_internal_dfn_sp_ci_ci_3D_" + suffix
+                   + ";\n";
+            // half-precision 3D kernels share the single-precision size list
+            str += "\tfunction_map_half_3D[std::make_tuple(" + lens
+                   + ", CS_KERNEL_3D_SINGLE)] = &rocfft_internal_dfn_hp_ci_ci_3D_" + suffix
+                   + ";\n";
+        }
+        else
+        {
+            // not implemented yet!
+            abort();
+        }
+    }
+    for(const auto& kernel : support_list_3D_double)
+    {
+        std::string lens = std::to_string(std::get<0>(kernel)) + ", "
+                           + std::to_string(std::get<1>(kernel)) + ", "
+                           + std::to_string(std::get<2>(kernel));
+        std::string suffix = std::to_string(std::get<0>(kernel)) + "_"
+                             + std::to_string(std::get<1>(kernel)) + "_"
+                             + std::to_string(std::get<2>(kernel));
+        if(std::get<3>(kernel) == CS_KERNEL_3D_SINGLE)
+        {
+            str += "\tfunction_map_double_3D[std::make_tuple(" + lens
+                   + ", CS_KERNEL_3D_SINGLE)] = &rocfft_internal_dfn_dp_ci_ci_3D_" + suffix
+                   + ";\n";
+        }
+        else
+        {
+            // not implemented yet!
+            abort();
+        }
+    }
 
     str += "}\n";
 
@@ -732,12 +1220,34 @@ void generate_kernel(size_t len, ComputeScheme scheme)
         initParams(params, fft_N, false, BCT_C2C); // here the C2C is not enabled,
         // as the third parameter is set
         // as false
+        // double-precision lengths are a subset of these
+        params.fft_realFused     = real_fused_length(len, rocfft_precision_single);
+        params.fft_batchPointers = true;
 
         Kernel<rocfft_precision_single> kernel(
             params); // generate data type template kernels regardless of precision
         kernel.GenerateKernel(programCode);
 
         WriteKernelToFile(programCode, std::to_string(len));
+
+        // variants with more or fewer transforms per block, and the
+        // work group scaled to match; they leave out the fused real
+        // processing
+        const size_t threadsPerTransform = params.fft_workGroupSize / params.fft_numTrans;
+        for(auto nt : nt_variants(len, rocfft_precision_single))
+        {
+            FFTKernelGenKeyParams ntParams = params;
+            ntParams.fft_realFused         = false;
+            ntParams.fft_numTrans          = nt;
+            ntParams.fft_workGroupSize     = threadsPerTransform * nt;
+            ntParams.name_suffix           = nt_suffix(nt);
+
+            std::string                     ntCode;
+            Kernel<rocfft_precision_single> ntKernel(ntParams);
+            ntKernel.GenerateKernel(ntCode);
+
+            WriteKernelToFile(ntCode, std::to_string(len) + ntParams.name_suffix);
+        }
     }
     else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
     {
@@ -820,3 +1330,47 @@ void generate_2D_kernels(const std::vector<std::tuple<size_t, size_t, ComputeSch
         }
     }
 }
+
+void generate_3D_kernels(
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& kernels)
+{
+    for(const auto& kernel : kernels)
+    {
+        std::string         programCode;
+        std::vector<size_t> lens
+            = {std::get<0>(kernel), std::get<1>(kernel), std::get<2>(kernel)};
+        ComputeScheme scheme = std::get<3>(kernel);
+
+        // include each distinct 1D kernel once
+        std::vector<size_t> distinct = lens;
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+        for(auto len : distinct)
+            programCode += "#include \"rocfft_kernel_" + std::to_string(len) + ".h\"\n";
+
+        if(scheme == CS_KERNEL_3D_SINGLE)
+        {
+            // parameters for each dimension
+            FFTKernelGenKeyParams params[3];
+            for(size_t i = 0; i < 3; ++i)
+            {
+                // only the X transform can possibly be unit stride
+                params[i].forceNonUnitStride = i > 0;
+                std::vector<size_t> fft_N(1, lens[i]);
+                initParams(params[i], fft_N, false, BCT_C2C);
+            }
+
+            Kernel3D kernel(params[0], params[1], params[2]);
+            kernel.GenerateGlobalKernel(programCode);
+
+            std::string file_suffix = "3D_" + std::to_string(lens[0]) + "_"
+                                      + std::to_string(lens[1]) + "_" + std::to_string(lens[2]);
+            WriteKernelToFile(programCode, file_suffix);
+        }
+        else
+        {
+            // not handled yet
+            abort();
+        }
+    }
+}
@@ -15,9 +15,13 @@ rocfft_status initParams(FFTKernelGenKeyParams& params,
 
 void WriteButterflyToFile(std::string& str, int LEN);
 
-void WriteCPUHeaders(const std::vector<size_t>&                                    support_list,
-                     const std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
-                     const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D);
+void WriteHostButterfliesToFile();
+
+void WriteCPUHeaders(
+    const std::vector<size_t>&                                            support_list,
+    const std::vector<std::tuple<size_t, ComputeScheme>>&                 large1D_list,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D);
 
 void write_cpu_function_small(std::vector<size_t> support_list,
                               std::string         precision,
@@ -29,14 +33,23 @@ void write_cpu_function_large(std::vector<std::tuple<size_t, ComputeScheme>> lar
 void write_cpu_function_2D(const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& list_2D,
                            const std::string&                                            precision);
 
+void write_cpu_function_3D(
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& list_3D,
+    const std::string&                                                    precision);
+
 void AddCPUFunctionToPool(
     const std::vector<size_t>&                                    support_list,
     const std::vector<std::tuple<size_t, ComputeScheme>>&         large1D_list,
-    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_single,
-    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& support_list_2D_double);
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D_single,
+    const std::vector<std::tuple<size_t, size_t, ComputeScheme>>&         support_list_2D_double,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D_single,
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& support_list_3D_double);
 
 void generate_kernel(size_t len, ComputeScheme scheme);
 
 void generate_2D_kernels(const std::vector<std::tuple<size_t, size_t, ComputeScheme>>& kernels);
 
+void generate_3D_kernels(
+    const std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>& kernels);
+
 #endif // generator_file_H
@@ -236,26 +236,61 @@ namespace StockhamGenerator
             return str;
         }
 
-        inline bool IsGroupedReadWritePossible() // TODO
+        // Grouped (vector4) global reads and writes pair up the registers of
+        // neighbouring butterflies, (2i)*radix+r and (2i+1)*radix+r, so the
+        // first or last pass must give each work item an even number of
+        // butterflies.  Non-unit stride kernels never take the unit-stride
+        // branch and callbacks work one element at a time, so neither gets
+        // the grouped code; alignment is still checked at run time.
+        inline bool IsGroupedReadWritePossible()
         {
-            bool possible = true;
+            if(r2c2r || realSpecial)
+                return false;
 
-            if(r2c2r)
+            if(params.forceNonUnitStride)
                 return false;
 
-            if(realSpecial)
+            if(params.fft_hasPreCallback && params.fft_hasPostCallback)
                 return false;
 
-            for(size_t i = 0; i < params.fft_DataDim - 1; i++) // if it is power of 2
-            {
-                if(params.fft_N[i] % 2)
-                {
-                    possible = false;
-                    break;
-                }
-            }
+            if(passes.empty())
+                return false;
+
+            const Pass<PR>& first = passes.front();
+            const Pass<PR>& last  = passes.back();
+
+            bool readPossible = !params.fft_hasPreCallback && (first.GetNumB1() % 2 == 0)
+                                && ((length / first.GetRadix()) % 2 == 0);
+            bool writePossible = !params.fft_hasPostCallback && (last.GetNumB1() % 2 == 0);
 
-            return possible;
+            return readPossible || writePossible;
+        }
+
+        // Work groups of small transforms hold numTrans of them.  When those
+        // are contiguous in memory, the whole group's input is read with
+        // vector4 loads that run across transform boundaries and staged in
+        // LDS, so the reads coalesce over the group instead of one short row
+        // at a time.
+        //
+        // The staging array comes on top of the kernel's own LDS, and
+        // kernels are instantiated for every precision, so both are
+        // sized as double precision against the LDS of current hardware.
+        virtual bool IsBlockReadPossible(bool inInterleaved)
+        {
+            if(numTrans == 1 || blockCompute || r2c2r || realSpecial)
+                return false;
+
+            if(!inInterleaved || params.fft_hasPreCallback || params.forceNonUnitStride)
+                return false;
+
+            static const size_t MAX_LDS_SIZE_BYTES = 64 * 1024;
+            // lds is interleaved here unless halfLds, see SharedMemSize
+            const size_t ldsBytes     = length * numTrans * (halfLds ? 8 : 16);
+            const size_t stagingBytes = length * numTrans * 16;
+            if(ldsBytes + stagingBytes > MAX_LDS_SIZE_BYTES)
+                return false;
+
+            return (length * numTrans) % 2 == 0;
         }
 
         /*
@@ -282,8 +317,8 @@ namespace StockhamGenerator
         {
             std::string str;
 
-            str += "\t// SBCC+SBRC fold higher dimensions into the batch_count, so we need\n";
-            str += "\t// extra math to work out how many 'true' batches we really have\n";
+            str += "\t// SBCC+SBRC blocks cover every dimension above lengths[1], and the\n";
+            str += "\t// batch_count transforms beyond those\n";
             str += "\tsize_t batch_block_size = hipGridDim_x / batch_count; //To opt: it can be "
                    "calc on host.\n";
             str += "\tsize_t counter_mod = batch % batch_block_size;\n";
@@ -320,19 +355,16 @@ namespace StockhamGenerator
             if(blockComputeType == BCT_C2C)
                 loop += "\t" + offset_name1 + " *= (" + stride_name1 + "[1]);\n";
 
-            // Distance between 'true' batches might be in a
-            // different stride_in/out array member depending on how
-            // this kernel is called.
+            // The distance between batches follows the strides of
+            // the dim dimensions, as in the other kernel arguments.
             //
             // e.g. In a standalone CS_L1D_CC plan, dim=2 for these
-            // kernels and stride_foo[2] has the 'true' batch offset,
-            // as the first two strides represent the block compute
-            // dimensions.
-            //
-            // When these kernels are child nodes of some more
-            // complicated plan, dim should be >= 3, and the last
-            // stride has the 'true' batch offset.
-            static const char* batch_dist_idx = "[dim >= 3 ? dim-1 : 2]";
+            // kernels and stride_foo[2] has the batch offset, as the
+            // first two strides represent the block compute
+            // dimensions.  Higher dimensions are walked by the loop
+            // above, so a dist that is not the last length times its
+            // stride is honoured too.
+            static const char* batch_dist_idx = "[dim]";
             loop += "\t" + offset_name1 + " += (batch_local_count * " + stride_name1
                     + batch_dist_idx + ");\n";
 
@@ -660,8 +692,12 @@ namespace StockhamGenerator
         void GenerateEncapsulatedPassesKernel(std::string& str)
         {
             str += "\n////////////////////////////////////////Encapsulated passes kernels\n";
-            std::string rType  = RegBaseType<PR>(1);
-            std::string r2Type = RegBaseType<PR>(2);
+            // registers, LDS and twiddles are of the compute type, global
+            // buffers of T; block compute kernels pass LDS as lwbIn/lwbOut
+            std::string crType  = ComputeBaseType<PR>(1);
+            std::string cr2Type = ComputeBaseType<PR>(2);
+            std::string rType   = blockCompute ? crType : RegBaseType<PR>(1);
+            std::string r2Type  = blockCompute ? cr2Type : RegBaseType<PR>(2);
             for(int in = 1; in >= 0; in--)
                 for(int out = 1; out >= 0; out--)
                 {
@@ -680,7 +716,8 @@ namespace StockhamGenerator
 
                         if(NeedsLargeTwiddles())
                         {
-                            str += "template <typename T, StrideBin sb, bool TwdLarge>\n";
+                            str += "template <typename T, StrideBin sb, bool TwdLarge, bool "
+                                   "TwdSincos>\n";
                         }
                         else
                         {
@@ -696,10 +733,11 @@ namespace StockhamGenerator
                         str += std::to_string(length) + name_suffix;
                         str += "_device";
 
-                        str += "(const T *twiddles, ";
+                        str += "(const " + cr2Type + " *twiddles, ";
                         if(NeedsLargeTwiddles())
-                            str += "const T *twiddles_large, "; // the blockCompute BCT_C2C
-                        // algorithm use one more twiddle parameter
+                            str += "const " + cr2Type
+                                   + " *twiddles_large, const size_t twiddles_large_len, ";
+                        // the blockCompute BCT_C2C algorithm use one more twiddle parameter
                         str += "const size_t stride_in, const size_t stride_out, unsigned int "
                                "rw, unsigned int b, ";
                         str += "unsigned int me, unsigned int ldsOffset, ";
@@ -714,14 +752,14 @@ namespace StockhamGenerator
                         else
                             str += rType + " *bufOutRe, " + rType + " *bufOutIm";
 
-                        if(blockCompute) // blockCompute' lds type is T
+                        if(blockCompute) // blockCompute' lds type is complex
                         {
-                            str += ", " + r2Type + " *lds";
+                            str += ", " + cr2Type + " *lds";
                         }
                         else
                         {
                             if(numPasses > 1)
-                                str += ", " + rType + " *lds"; // only multiple pass use lds
+                                str += ", " + crType + " *lds"; // only multiple pass use lds
                         }
 
                         str += ")\n";
@@ -731,7 +769,7 @@ namespace StockhamGenerator
                         if(linearRegs)
                         {
                             str += "\t";
-                            str += r2Type;
+                            str += cr2Type;
                             str += " ";
                             str += IterRegs("", false);
                             str += ";\n";
@@ -743,7 +781,9 @@ namespace StockhamGenerator
                             str += PassName(0, fwd, length, name_suffix);
                             if(NeedsLargeTwiddles())
                             {
-                                str += "<T, sb, TwdLarge>(twiddles, twiddles_large, "; // the blockCompute BCT_C2C algorithm use
+                                // the blockCompute BCT_C2C algorithm use
+                                str += "<T, sb, TwdLarge, TwdSincos>(twiddles, twiddles_large, "
+                                       "twiddles_large_len, ";
                             }
                             else
                             {
@@ -778,7 +818,8 @@ namespace StockhamGenerator
                                 // the blockCompute BCT_C2C algorithm use one more twiddle parameter
                                 if(NeedsLargeTwiddles())
                                 {
-                                    str += "<T, sb, TwdLarge>(twiddles, twiddles_large, ";
+                                    str += "<T, sb, TwdLarge, TwdSincos>(twiddles, twiddles_large, "
+                                       "twiddles_large_len, ";
                                 }
                                 else
                                 {
@@ -924,6 +965,12 @@ namespace StockhamGenerator
         {
             return false;
         }
+        // kernels launched by POWX_SMALL_GENERATOR take a BatchPointers
+        // argument last
+        virtual bool BatchPointersParam()
+        {
+            return params.fft_batchPointers;
+        }
 
         void GenerateSingleGlobalKernelPrototype(std::string&            str,
                                                  bool                    fwd,
@@ -948,7 +995,8 @@ namespace StockhamGenerator
             // Function signature
             if(NeedsLargeTwiddles())
             {
-                str += "template <typename T, StrideBin sb, bool TwdLarge>\n";
+                str += "template <typename T, StrideBin sb, bool TwdLarge, bool TwdSincos = "
+                       "false>\n";
             }
             else
             {
@@ -973,10 +1021,10 @@ namespace StockhamGenerator
                     lengths, strides may be high dimension arrays
                 */
             str += "( ";
-            str += "const " + r2Type + " * __restrict__ twiddles, ";
+            str += "const " + ComputeBaseType<PR>(2) + " * __restrict__ twiddles, ";
             if(NeedsLargeTwiddles())
             {
-                str += "const " + r2Type
+                str += "const " + ComputeBaseType<PR>(2)
                        + " * __restrict__ twiddles_large, "; // blockCompute introduce
                 // one more twiddle parameter
             }
@@ -1010,7 +1058,6 @@ namespace StockhamGenerator
                     if(IOParamUnderscore())
                         str += "_";
                     str += "gb";
-                    str += ")\n";
                 }
                 else
                 {
@@ -1024,8 +1071,6 @@ namespace StockhamGenerator
                     if(IOParamUnderscore())
                         str += "_";
                     str += "gbIm";
-
-                    str += ")\n";
                 }
             }
             else
@@ -1076,9 +1121,11 @@ namespace StockhamGenerator
                         str += "_";
                     str += "gbOutIm";
                 }
-
-                str += ")\n";
             }
+
+            if(BatchPointersParam())
+                str += ", const BatchPointers ptrs";
+            str += ")\n";
         }
 
         virtual void GenerateSingleGlobalKernelRWFlag(std::string& str)
@@ -1149,6 +1196,77 @@ namespace StockhamGenerator
             }
         }
 
+        // Stage the work group's input in LDS when its transforms are
+        // contiguous; see IsBlockReadPossible.  lwbRead is where the first
+        // pass reads from, either the staged copy or the row in global memory.
+        virtual void GenerateSingleGlobalKernelBlockRead(std::string&            str,
+                                                         rocfft_result_placement placeness)
+        {
+            const std::string gbIn  = (placeness == rocfft_placement_inplace) ? "gb" : "gbIn";
+            const std::string lwbIn = (placeness == rocfft_placement_inplace) ? "lwb" : "lwbIn";
+            const std::string blockLen = std::to_string(length * numTrans);
+            const std::string blockIn  = gbIn + " + batch*" + blockLen;
+
+            str += "\t__shared__ T ldsIn[" + blockLen + "];\n";
+            str += "\tT *lwbRead = " + lwbIn + ";\n";
+            str += "\tif(";
+            if(params.fft_batchPointers)
+                str += "!ptrs.in[0] && ";
+            // with dim == 1, stride_in[1] is the batch distance
+            str += "sb == SB_UNIT && dim == 1 && stride_in[1] == " + std::to_string(length);
+            str += " && (batch + 1)*" + std::to_string(numTrans) + " <= upper_count";
+            str += " && is_vector4_aligned(" + blockIn + "))\n\t{\n";
+            str += "\t\tconst vector4_type_t<T> *gb4 = (const vector4_type_t<T>*)(" + blockIn
+                   + ");\n";
+            str += "\t\tfor(unsigned int i = me; i < " + std::to_string(length * numTrans / 2)
+                   + "; i += " + std::to_string(workGroupSize) + ")\n\t\t{\n";
+            str += "\t\t\tvector4_type_t<T> v4 = gb4[i];\n";
+            str += "\t\t\tldsIn[2*i] = lib_make_vector2<T>(v4.x, v4.y);\n";
+            str += "\t\t\tldsIn[2*i + 1] = lib_make_vector2<T>(v4.z, v4.w);\n";
+            str += "\t\t}\n";
+            str += "\t\t__syncthreads();\n";
+            str += "\t\tlwbRead = ldsIn + (me/" + std::to_string(workGroupSizePerTrans) + ")*"
+                   + std::to_string(length) + ";\n";
+            str += "\t}\n\n";
+        }
+
+        // Batches of separately allocated transforms: take each transform's
+        // address from the BatchPointers argument instead of the batch
+        // distance.  Work items past the end of the batch (rw == 0) use
+        // the last transform's, so that they still hold a valid address.
+        virtual void GenerateSingleGlobalKernelBatchPointers(std::string&            str,
+                                                             rocfft_result_placement placeness,
+                                                             bool                    inInterleaved,
+                                                             bool               outInterleaved,
+                                                             const std::string& rType,
+                                                             const std::string& r2Type)
+        {
+            if(params.fft_hasPreCallback || params.fft_hasPostCallback)
+                return;
+
+            auto assign = [&](const std::string& lwb, bool interleaved, const std::string& table) {
+                if(interleaved)
+                    str += "\t\t" + lwb + " = (" + r2Type + "*)" + table + "[0][t];\n";
+                else
+                {
+                    str += "\t\t" + lwb + "Re = (" + rType + "*)" + table + "[0][t];\n";
+                    str += "\t\t" + lwb + "Im = (" + rType + "*)" + table + "[1][t];\n";
+                }
+            };
+
+            str += "\tif(ptrs.in[0] && dim == 1)\n\t{\n";
+            str += "\t\tconst size_t t\n";
+            str += "\t\t\t= counter_mod < batch_count ? counter_mod : batch_count - 1;\n";
+            if(placeness == rocfft_placement_inplace)
+                assign("lwb", inInterleaved, "ptrs.in");
+            else
+            {
+                assign("lwbIn", inInterleaved, "ptrs.in");
+                assign("lwbOut", outInterleaved, "ptrs.out");
+            }
+            str += "\t}\n\n";
+        }
+
         virtual void GenerateSingleGlobalKernelBody(std::string&            str,
                                                     bool                    fwd,
                                                     rocfft_result_placement placeness,
@@ -1314,6 +1432,14 @@ namespace StockhamGenerator
                 str += "\n";
             }
 
+            if(params.fft_batchPointers)
+                GenerateSingleGlobalKernelBatchPointers(
+                    str, placeness, inInterleaved, outInterleaved, rType, r2Type);
+
+            const bool blockRead = IsBlockReadPossible(inInterleaved);
+            if(blockRead)
+                GenerateSingleGlobalKernelBlockRead(str, placeness);
+
             /* =====================================================================
                     blockCompute only: Read data into shared memory (LDS) for blocked
                     access
@@ -1331,7 +1457,7 @@ namespace StockhamGenerator
                 // get offset
                 std::string bufOffset;
 
-                str += "\t\tT R0;\n";
+                str += "\t\t" + ComputeBaseType<PR>(2) + " R0;\n";
 
                 for(size_t c = 0; c < 2; c++)
                 {
@@ -1365,20 +1491,24 @@ namespace StockhamGenerator
                         str += "\t\tR0";
                         str += comp;
                         str += " = ";
+                        if(inInterleaved)
+                            str += "lib_convert_vector2<" + ComputeBaseType<PR>(2) + ">(";
                         str += readBuf;
                         str += "[";
                         str += bufOffset;
-                        str += "];\n";
+                        str += inInterleaved ? "]);\n" : "];\n";
                     }
                     else
                     {
                         str += "\t\tR0";
                         str += comp;
                         str += " = ";
+                        if(inInterleaved)
+                            str += "lib_convert_vector2<" + ComputeBaseType<PR>(2) + ">(";
                         str += readBuf;
                         str += "[me + t*";
                         str += std::to_string(blockWGS);
-                        str += "];\n";
+                        str += inInterleaved ? "]);\n" : "];\n";
                     }
 
                     if(inInterleaved)
@@ -1470,6 +1600,9 @@ namespace StockhamGenerator
                     outBuf = params.fft_hasPostCallback ? "gbOutRe, gbOutIm" : "lwbOutRe, lwbOutIm";
             }
 
+            if(blockRead)
+                inBuf = "lwbRead, ";
+
             /* =====================================================================
                     call FFT devices functions in the generated kernel
                     ===================================================================*/
@@ -1542,7 +1675,9 @@ namespace StockhamGenerator
             std::string sb = params.forceNonUnitStride ? "SB_NONUNIT" : "sb";
             if(NeedsLargeTwiddles())
             {
-                str += "_device<T, " + sb + ", TwdLarge>(twiddles, twiddles_large, ";
+                str += "_device<T, " + sb
+                       + ", TwdLarge, TwdSincos>(twiddles, twiddles_large, ";
+                str += "lengths[0] * lengths[1], ";
             }
             else
             {
@@ -1582,7 +1717,7 @@ namespace StockhamGenerator
 
                 if((blockComputeType == BCT_C2C) || (blockComputeType == BCT_R2C))
                 {
-                    str += "\t\tT R0 = lds[t*";
+                    str += "\t\t" + ComputeBaseType<PR>(2) + " R0 = lds[t*";
                     str += std::to_string(blockWGS / blockWidth);
                     str += " + ";
                     str += "(me%";
@@ -1597,7 +1732,7 @@ namespace StockhamGenerator
                 }
                 else
                 {
-                    str += "\t\tT R0 = lds[t*";
+                    str += "\t\t" + ComputeBaseType<PR>(2) + " R0 = lds[t*";
                     str += std::to_string(blockWGS);
                     str += " + me];";
                     str += "\n";
@@ -1638,9 +1773,9 @@ namespace StockhamGenerator
                                         ? ")*stride_in[0] + t*stride_in[0]*"
                                         : ")*stride_out[0] + t*stride_out[0]*");
                             str += std::to_string(blockWGS / blockWidth);
-                            str += "] = R0";
+                            str += outInterleaved ? "] = lib_convert_vector2<T>(R0" : "] = R0";
                             str += comp;
-                            str += ";\n";
+                            str += outInterleaved ? ");\n" : ";\n";
                         }
                     }
                     else
@@ -1649,9 +1784,9 @@ namespace StockhamGenerator
                         str += writeBuf;
                         str += "[me + t*";
                         str += std::to_string(blockWGS);
-                        str += "] = R0";
+                        str += outInterleaved ? "] = lib_convert_vector2<T>(R0" : "] = R0";
                         str += comp;
-                        str += ";\n";
+                        str += outInterleaved ? ");\n" : ";\n";
                     }
 
                     if(outInterleaved)
@@ -1676,6 +1811,9 @@ namespace StockhamGenerator
             std::string rType = RegBaseType<PR>(1);
             // Vector type
             std::string r2Type = RegBaseType<PR>(2);
+            // LDS types
+            std::string crType  = ComputeBaseType<PR>(1);
+            std::string cr2Type = ComputeBaseType<PR>(2);
 
             for(size_t d = 0; d < 2; d++)
             {
@@ -1692,7 +1830,8 @@ namespace StockhamGenerator
                                                     r2Type);
                 str += "{\n";
                 // Allocate LDS
-                GenerateSingleGlobalKernelSharedMem(str, ldsInterleaved, placeness, rType, r2Type);
+                GenerateSingleGlobalKernelSharedMem(
+                    str, ldsInterleaved, placeness, crType, cr2Type);
 
                 GenerateSingleGlobalKernelBody(
                     str, fwd, placeness, inInterleaved, outInterleaved, rType, r2Type);
@@ -1720,6 +1859,119 @@ namespace StockhamGenerator
             GenerateSingleGlobalKernel(str, rocfft_placement_notinplace, true, false);
             GenerateSingleGlobalKernel(str, rocfft_placement_notinplace, false, true);
             GenerateSingleGlobalKernel(str, rocfft_placement_notinplace, false, false);
+
+            if(params.fft_realFused && !blockCompute)
+                GenerateRealFusedGlobalKernel(str);
+        }
+
+        /* =====================================================================
+                Generate kernels with the even-length real post-processing
+                fused into the last pass (forward, "_r2c") or the
+                pre-processing fused into the first pass (backward, "_c2r").
+                The row goes through LDS a second time, as planar reals
+                of T next to the (compute type) working space, so that
+                threads can exchange elements k and length - k.  The real side is interleaved,
+                the Hermitian side is of format TH, interleaved or planar,
+                and the two may be the same buffer.
+            =================================================================== */
+        void GenerateRealFusedGlobalKernel(std::string& str)
+        {
+            std::string rType   = RegBaseType<PR>(1);
+            std::string r2Type  = RegBaseType<PR>(2);
+            std::string crType  = ComputeBaseType<PR>(1);
+            std::string cr2Type = ComputeBaseType<PR>(2);
+
+            // working space of the passes, and the row
+            size_t ldsSize = SharedMemSize(false);
+
+            std::string me, ldsOff;
+            if(numTrans > 1)
+            {
+                me     = "me%" + std::to_string(workGroupSizePerTrans);
+                ldsOff = "(me/" + std::to_string(workGroupSizePerTrans) + ")*"
+                         + std::to_string(length);
+            }
+            else
+            {
+                me     = "me";
+                ldsOff = "0";
+            }
+
+            for(size_t d = 0; d < 2; d++)
+            {
+                bool fwd = d ? false : true;
+
+                str += "//Kernel configuration: number of threads per thread block: ";
+                str += std::to_string(workGroupSize) + ", maximum transforms: ";
+                str += std::to_string(numTrans) + ", Passes: " + std::to_string(numPasses);
+                str += fwd ? ", real post-processing fused\n" : ", real pre-processing fused\n";
+                str += "template <typename T, StrideBin sb, typename TH>\n";
+                str += "__global__ void\n";
+                str += LaunchBounds();
+                str += fwd ? "fft_fwd" : "fft_back";
+                str += GlobalKernelFunctionSuffix();
+                str += fwd ? "_r2c" : "_c2r";
+                str += "( const " + cr2Type + " * __restrict__ twiddles, ";
+                str += "const " + cr2Type + " * __restrict__ twiddles_real, ";
+                str += "const size_t dim, const size_t *lengths, const size_t *stride_in, ";
+                str += "const size_t *stride_out, const size_t batch_count, ";
+                if(fwd)
+                    str += r2Type + " *gbIn, array_out_t<TH> gbOut)\n";
+                else
+                    str += "array_in_t<TH> gbIn, " + r2Type + " *gbOut)\n";
+                str += "{\n";
+
+                str += "\n";
+                if(numPasses > 1)
+                    str += "\t__shared__ " + crType + " lds[" + std::to_string(ldsSize) + "];\n";
+                str += "\t__shared__ " + rType + " row[" + std::to_string(2 * ldsSize) + "];\n";
+                str += "\tunsigned int me = (unsigned int)hipThreadIdx_x;\n";
+                str += "\tunsigned int batch = (unsigned int)hipBlockIdx_x;\n\n";
+                str += "\tunsigned int iOffset = 0;\n";
+                str += "\tunsigned int oOffset = 0;\n";
+                str += "\t" + r2Type + (fwd ? " *lwbIn;\n\n" : " *lwbOut;\n\n");
+
+                GenerateSingleGlobalKernelRWFlag(str);
+                str += "\tunsigned int b = 0;\n\n";
+
+                GenerateSingleGlobalKernelIOOffsets(str, rocfft_placement_notinplace);
+                str += fwd ? "\tlwbIn = gbIn + iOffset;\n\n" : "\tlwbOut = gbOut + oOffset;\n\n";
+
+                str += "\t// the transform's row in LDS, as planar reals\n";
+                str += "\t" + rType + " *rowRe = row + " + ldsOff + ";\n";
+                str += "\t" + rType + " *rowIm = rowRe + " + std::to_string(ldsSize) + ";\n\n";
+
+                std::string fftCall = fwd ? "\tfwd_len" : "\tback_len";
+                fftCall += std::to_string(length) + name_suffix + "_device<T, sb>(twiddles, ";
+                fftCall += fwd ? "stride_in[0], 1, " : "1, stride_out[0], ";
+                fftCall += "rw, b, " + me + ", " + ldsOff + ", ";
+                fftCall += fwd ? "lwbIn, rowRe, rowIm" : "rowRe, rowIm, lwbOut";
+                if(numPasses > 1)
+                    fftCall += ", lds";
+                fftCall += ");\n";
+
+                std::string realArgs = std::to_string(length) + ", "
+                                       + std::to_string(workGroupSizePerTrans) + ", " + me
+                                       + ", rw, ";
+                if(fwd)
+                {
+                    str += "\t// FFT from lwbIn to the row, then post-process to gbOut\n";
+                    str += fftCall;
+                    str += "\t__syncthreads();\n";
+                    str += "\treal_post_process_lds<T, TH>(" + realArgs
+                           + "rowRe, rowIm, gbOut, oOffset, stride_out[0], twiddles_real);\n";
+                }
+                else
+                {
+                    str += "\t// pre-process gbIn to the row, then FFT to lwbOut\n";
+                    str += "\treal_pre_process_lds<T, TH>(" + realArgs
+                           + "gbIn, iOffset, stride_in[0], rowRe, rowIm, twiddles_real);\n";
+                    str += "\t__syncthreads();\n";
+                    str += fftCall;
+                }
+
+                str += "}\n\n";
+            }
         }
 
         Kernel(const FFTKernelGenKeyParams& paramsVal)
@@ -1776,9 +2028,9 @@ namespace StockhamGenerator
             // use blocked columns to compute FFTs
             if(blockCompute)
             {
-                assert(length <= 256); // 256 parameter comes from prototype experiments
-                // largest length at which block column possible given 32KB LDS limit
-                // if LDS limit is different this number need to be changed appropriately
+                assert(length <= 512); // GetBlockComputeTable keeps length * blockWidth
+                // within the 32KB LDS limit for double2, which leaves a block
+                // width of at least 4 at this length
                 halfLds    = false;
                 linearRegs = true;
             }
@@ -1989,42 +2241,61 @@ namespace StockhamGenerator
         }
     };
 
-    // Single pass of a 2D_SINGLE kernel, either to do row transform or
-    // column transform.  This generates templated kernels that don't
-    // care about precision, so just hardcode Kernel's precision arg.
+    // Single pass of a 2D_SINGLE or 3D_SINGLE kernel, transforming
+    // along one dimension between global memory and LDS (or LDS and
+    // LDS, for the middle pass of a 3D kernel).  This generates
+    // templated kernels that don't care about precision, so just
+    // hardcode Kernel's precision arg.
     class Kernel2D_SINGLE_pass : public Kernel<rocfft_precision_single>
     {
     public:
-        Kernel2D_SINGLE_pass(const FFTKernelGenKeyParams& paramsVal, bool _isRowTransform)
+        Kernel2D_SINGLE_pass(const FFTKernelGenKeyParams& paramsVal,
+                             bool                         _readGlobal,
+                             bool                         _writeGlobal,
+                             size_t                       _dims = 2)
             : Kernel(paramsVal)
-            , isRowTransform(_isRowTransform)
+            , readGlobal(_readGlobal)
+            , writeGlobal(_writeGlobal)
+            , dims(_dims)
         {
         }
 
         void GenerateSingleGlobalKernelRWFlag(std::string& str) override
         {
-            str += "\t// set rw for enough threads to cover total number of 2D elements\n";
-            str += "\tunsigned int rw = me < (lengths[0] * lengths[1] / " + std::to_string(cnPerWI)
+            std::string numElements = "lengths[0]";
+            for(size_t i = 1; i < dims; ++i)
+                numElements += " * lengths[" + std::to_string(i) + "]";
+            str += "\t// set rw for enough threads to cover total number of "
+                   + std::to_string(dims) + "D elements\n";
+            str += "\tunsigned int rw = me < (" + numElements + " / " + std::to_string(cnPerWI)
                    + ");\n";
         }
 
+        // A pass of a fused kernel transforms one 2D/3D volume per
+        // block, so its numTrans rows are neither a batch of whole
+        // transforms nor contiguous in general, and its LDS already
+        // holds the volume; it never stages its input.
+        bool IsBlockReadPossible(bool inInterleaved) override
+        {
+            return false;
+        }
+
         void GenerateSingleGlobalKernelIOOffsets(std::string&            str,
                                                  rocfft_result_placement placeness) override
         {
-            if(isRowTransform)
+            if(readGlobal)
             {
-                str += "\t// row transform writes to LDS, so respect non-unit strides for input\n";
-                str += "\t// and assume unit stride for output\n";
-                str += "\tiOffset = batch * _stride_in[2];\n";
+                str += "\t// this pass reads from global memory, so respect non-unit strides\n";
+                str += "\t// for input\n";
+                str += "\tiOffset = batch * _stride_in[" + std::to_string(dims) + "];\n";
             }
-            else
+            if(writeGlobal)
             {
-                str += "\t// col transform reads from LDS, so respect non-unit strides for "
-                       "output\n";
-                str += "\t// and assume unit stride for input\n";
-                str += "\toOffset = batch * _stride_in[2];\n";
+                str += "\t// this pass writes to global memory, so respect non-unit strides\n";
+                str += "\t// for output\n";
+                str += "\toOffset = batch * batch_dist_out;\n";
             }
-            // HACK: we're doing a single 2D transform per
+            // HACK: we're doing a single 2D/3D transform per
             // threadblock to/from LDS.  Convince the IO offset
             // generating code to assume everything is batch zero,
             // and use the code above to compensate for actual batch
@@ -2034,8 +2305,81 @@ namespace StockhamGenerator
             Kernel<rocfft_precision_single>::GenerateSingleGlobalKernelIOOffsets(str, placeness);
             std::swap(temp, numTrans);
         }
-        bool isRowTransform;
+        bool   readGlobal;
+        bool   writeGlobal;
+        size_t dims;
     };
+
+    // Emit declarations of the global input pointers for the first
+    // pass of a fused multi-dimensional kernel
+    static inline void DeclareSingleGlobalInputs(std::string&            str,
+                                                 rocfft_result_placement placeness,
+                                                 bool                    inInterleaved)
+    {
+        str += "\t// declare input/output pointers\n";
+        if(placeness == rocfft_placement_inplace)
+        {
+            if(inInterleaved)
+            {
+                str += "\tT* gbIn = _gb;\n";
+            }
+            else
+            {
+                str += "\treal_type_t<T>* gbInRe = _gbRe;\n";
+                str += "\treal_type_t<T>* gbInIm = _gbIm;\n";
+            }
+        }
+        else
+        {
+            if(inInterleaved)
+            {
+                str += "\tT* gbIn = _gbIn;\n";
+            }
+            else
+            {
+                str += "\treal_type_t<T>* gbInRe = _gbInRe;\n";
+                str += "\treal_type_t<T>* gbInIm = _gbInIm;\n";
+            }
+        }
+    }
+
+    // Emit assignments of the global output pointers for the last
+    // pass of a fused multi-dimensional kernel.  gbOut has already
+    // been declared to point at LDS.
+    static inline void DeclareSingleGlobalOutputs(std::string&            str,
+                                                  rocfft_result_placement placeness,
+                                                  bool                    outInterleaved,
+                                                  size_t                  dims)
+    {
+        std::string distIdx = "[" + std::to_string(dims) + "]";
+        if(placeness == rocfft_placement_inplace)
+        {
+            str += "\tsize_t batch_dist_out = _stride_in" + distIdx + ";\n";
+            if(outInterleaved)
+            {
+                str += "\tgbOut = _gb;\n";
+            }
+            else
+            {
+                str += "\treal_type_t<T>* gbOutRe = _gbRe;\n";
+                str += "\treal_type_t<T>* gbOutIm = _gbIm;\n";
+            }
+        }
+        else
+        {
+            str += "\tsize_t batch_dist_out = _stride_out" + distIdx + ";\n";
+            if(outInterleaved)
+            {
+                str += "\tgbOut = _gbOut;\n";
+            }
+            else
+            {
+                str += "\treal_type_t<T>* gbOutRe = _gbOutRe;\n";
+                str += "\treal_type_t<T>* gbOutIm = _gbOutIm;\n";
+            }
+        }
+    }
+
     // Generate 2D kernels.  Thus far, we're only generating templated
     // kernels that don't need to care about precision
     class Kernel2D : public Kernel<rocfft_precision_single>
@@ -2045,8 +2389,8 @@ namespace StockhamGenerator
         // dimension needs to be specified separately.
         Kernel2D(const FFTKernelGenKeyParams& paramsVal1, const FFTKernelGenKeyParams& paramsVal2)
             : Kernel(paramsVal1)
-            , transform_row(paramsVal1, true)
-            , transform_col(paramsVal2, false)
+            , transform_row(paramsVal1, true, false)
+            , transform_col(paramsVal2, false, true)
         {
             // ensure the row transform knows it's being done for each
             // column, and vice-versa
@@ -2069,6 +2413,12 @@ namespace StockhamGenerator
         {
             return true;
         }
+        // launched like the small 1D kernels, but always with a
+        // contiguous batch: the argument is ignored
+        bool BatchPointersParam() override
+        {
+            return true;
+        }
 
         std::string LaunchBounds() override
         {
@@ -2110,31 +2460,7 @@ namespace StockhamGenerator
             str += "\tlengths[1] = _lengths[1];\n";
             str += "\tlengths[2] = _lengths[2];\n";
 
-            str += "\t// declare input/output pointers\n";
-            if(placeness == rocfft_placement_inplace)
-            {
-                if(inInterleaved)
-                {
-                    str += "\tT* gbIn = _gb;\n";
-                }
-                else
-                {
-                    str += "\treal_type_t<T>* gbInRe = _gbRe;\n";
-                    str += "\treal_type_t<T>* gbInIm = _gbIm;\n";
-                }
-            }
-            else
-            {
-                if(inInterleaved)
-                {
-                    str += "\tT* gbIn = _gbIn;\n";
-                }
-                else
-                {
-                    str += "\treal_type_t<T>* gbInRe = _gbInRe;\n";
-                    str += "\treal_type_t<T>* gbInIm = _gbInIm;\n";
-                }
-            }
+            DeclareSingleGlobalInputs(str, placeness, inInterleaved);
             str += "\t// write to LDS\n";
             str += "\tT* gbOut = lds_data;\n";
             str += "\t// transform each row\n";
@@ -2187,30 +2513,7 @@ namespace StockhamGenerator
                 str += "\tT* gbIn = lds_data;\n";
             else
                 str += "\tgbIn = lds_data;\n";
-            if(placeness == rocfft_placement_inplace)
-            {
-                if(outInterleaved)
-                {
-                    str += "\tgbOut = _gb;\n";
-                }
-                else
-                {
-                    str += "\treal_type_t<T>* gbOutRe = _gbRe;\n";
-                    str += "\treal_type_t<T>* gbOutIm = _gbIm;\n";
-                }
-            }
-            else
-            {
-                if(outInterleaved)
-                {
-                    str += "\tgbOut = _gbOut;\n";
-                }
-                else
-                {
-                    str += "\treal_type_t<T>* gbOutRe = _gbOutRe;\n";
-                    str += "\treal_type_t<T>* gbOutIm = _gbOutIm;\n";
-                }
-            }
+            DeclareSingleGlobalOutputs(str, placeness, outInterleaved, 2);
             str += "\t{\n";
             // for column transform, it's also out-of-place (since
             // the row transform results were written to LDS, and the
@@ -2256,6 +2559,177 @@ namespace StockhamGenerator
         Kernel2D_SINGLE_pass transform_row;
         Kernel2D_SINGLE_pass transform_col;
     };
+
+    // Generate 3D kernels that keep an entire volume resident in LDS.
+    // The X pass reads from global memory into LDS, the Y pass
+    // transforms in place in LDS, and the Z pass writes back out to
+    // global memory.
+    class Kernel3D : public Kernel<rocfft_precision_single>
+    {
+    public:
+        Kernel3D(const FFTKernelGenKeyParams& paramsVal1,
+                 const FFTKernelGenKeyParams& paramsVal2,
+                 const FFTKernelGenKeyParams& paramsVal3)
+            : Kernel(paramsVal1)
+            , transform_x(paramsVal1, true, false, 3)
+            , transform_y(paramsVal2, false, false, 3)
+            , transform_z(paramsVal3, false, true, 3)
+        {
+            // each pass is done for every line along the other two
+            // dimensions
+            transform_x.numTrans = transform_y.length * transform_z.length;
+            transform_y.numTrans = transform_x.length * transform_z.length;
+            transform_z.numTrans = transform_x.length * transform_y.length;
+        }
+
+    private:
+        bool StrideParamUnderscore() override
+        {
+            return true;
+        }
+        bool LengthParamUnderscore() override
+        {
+            return true;
+        }
+        bool IOParamUnderscore() override
+        {
+            return true;
+        }
+        // launched like the small 1D kernels, but always with a
+        // contiguous batch: the argument is ignored
+        bool BatchPointersParam() override
+        {
+            return true;
+        }
+
+        std::string LaunchBounds() override
+        {
+            return "__launch_bounds__(" + std::to_string(MAX_LAUNCH_BOUNDS_3D_SINGLE_KERNEL)
+                   + ")\n";
+        }
+
+        std::string GlobalKernelFunctionSuffix() override
+        {
+            return "_3D_" + std::to_string(transform_x.length) + "_"
+                   + std::to_string(transform_y.length) + "_"
+                   + std::to_string(transform_z.length);
+        }
+
+        void GenerateSingleGlobalKernelBody(std::string&            str,
+                                            bool                    fwd,
+                                            rocfft_result_placement placeness,
+                                            bool                    inInterleaved,
+                                            bool                    outInterleaved,
+                                            const std::string&      rType,
+                                            const std::string&      r2Type) override
+        {
+            str += "\t// use supplied input stride for X transform\n";
+            str += "\tsize_t stride_in[4];\n";
+            str += "\tstride_in[0] = _stride_in[0];\n";
+            str += "\tstride_in[1] = _stride_in[1];\n";
+            str += "\tstride_in[2] = _stride_in[2];\n";
+            str += "\tstride_in[3] = _stride_in[3];\n";
+
+            str += "\t// the whole volume is contiguous in LDS\n";
+            str += "\tsize_t stride_out[4];\n";
+            str += "\tstride_out[0] = 1;\n";
+            str += "\tstride_out[1] = _lengths[0];\n";
+            str += "\tstride_out[2] = _lengths[0] * _lengths[1];\n";
+            str += "\tstride_out[3] = 0;\n";
+
+            str += "\tsize_t lengths[3];\n";
+            str += "\tlengths[0] = _lengths[0];\n";
+            str += "\tlengths[1] = _lengths[1];\n";
+            str += "\tlengths[2] = _lengths[2];\n";
+
+            DeclareSingleGlobalInputs(str, placeness, inInterleaved);
+            str += "\tT* gbOut = lds_data;\n";
+            str += "\t// transform along X\n";
+            str += "\t{\n";
+            transform_x.GenerateSingleGlobalKernelBody(
+                str, fwd, rocfft_placement_notinplace, inInterleaved, true, rType, r2Type);
+            str += "\t}\n";
+
+            str += "\t// twiddle tables for X, Y and Z are back to back\n";
+            str += "\ttwiddles = twiddles + _lengths[0];\n";
+            str += "\t// Y transform reads and writes LDS, in place\n";
+            str += "\tstride_in[0] = _lengths[0];\n";
+            str += "\tstride_in[1] = 1;\n";
+            str += "\tstride_in[2] = _lengths[0] * _lengths[1];\n";
+            str += "\tstride_in[3] = 0;\n";
+            str += "\tstride_out[0] = stride_in[0];\n";
+            str += "\tstride_out[1] = stride_in[1];\n";
+            str += "\tstride_out[2] = stride_in[2];\n";
+            str += "\tlengths[0] = _lengths[1];\n";
+            str += "\tlengths[1] = _lengths[0];\n";
+            str += "\tlengths[2] = _lengths[2];\n";
+            if(!inInterleaved)
+                str += "\tT* gbIn = lds_data;\n";
+            else
+                str += "\tgbIn = lds_data;\n";
+
+            str += "\t// Let the X transform finish before starting Y transform\n";
+            str += "\t__syncthreads();\n";
+            str += "\t{\n";
+            transform_y.GenerateSingleGlobalKernelBody(
+                str, fwd, rocfft_placement_notinplace, true, true, rType, r2Type);
+            str += "\t}\n";
+
+            str += "\ttwiddles = twiddles + _lengths[1];\n";
+            str += "\t// Z transform reads LDS and writes to the original destination\n";
+            str += "\tstride_in[0] = _lengths[0] * _lengths[1];\n";
+            str += "\tstride_in[1] = 1;\n";
+            str += "\tstride_in[2] = _lengths[0];\n";
+            if(placeness == rocfft_placement_notinplace)
+            {
+                str += "\tstride_out[0] = _stride_out[2];\n";
+                str += "\tstride_out[1] = _stride_out[0];\n";
+                str += "\tstride_out[2] = _stride_out[1];\n";
+            }
+            else
+            {
+                str += "\tstride_out[0] = _stride_in[2];\n";
+                str += "\tstride_out[1] = _stride_in[0];\n";
+                str += "\tstride_out[2] = _stride_in[1];\n";
+            }
+            str += "\tlengths[0] = _lengths[2];\n";
+            str += "\tlengths[1] = _lengths[0];\n";
+            str += "\tlengths[2] = _lengths[1];\n";
+            DeclareSingleGlobalOutputs(str, placeness, outInterleaved, 3);
+
+            str += "\t// Let the Y transform finish before starting Z transform\n";
+            str += "\t__syncthreads();\n";
+            str += "\t{\n";
+            transform_z.GenerateSingleGlobalKernelBody(
+                str, fwd, rocfft_placement_notinplace, true, outInterleaved, rType, r2Type);
+            str += "\t}\n";
+        }
+
+        size_t SharedMemSize(bool ldsInterleaved) override
+        {
+            // butterfly temp space for one pass over the whole
+            // volume, counted in reals
+            return transform_x.length * transform_y.length * transform_z.length;
+        }
+
+        void GenerateSingleGlobalKernelSharedMem(std::string&            str,
+                                                 bool                    ldsInterleaved,
+                                                 rocfft_result_placement placeness,
+                                                 const std::string&      rType,
+                                                 const std::string&      r2Type) override
+        {
+            Kernel<rocfft_precision_single>::GenerateSingleGlobalKernelSharedMem(
+                str, ldsInterleaved, placeness, rType, r2Type);
+            // the semi-transformed volume stays in LDS between passes
+            str += "\t__shared__ T lds_data[" + std::to_string(transform_x.length) + "*"
+                   + std::to_string(transform_y.length) + "*"
+                   + std::to_string(transform_z.length) + "];\n";
+        }
+
+        Kernel2D_SINGLE_pass transform_x;
+        Kernel2D_SINGLE_pass transform_y;
+        Kernel2D_SINGLE_pass transform_z;
+    };
 };
 
 #endif
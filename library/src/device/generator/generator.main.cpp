@@ -80,6 +80,22 @@ std::vector<std::tuple<size_t, size_t, ComputeScheme>>
     return retval;
 }
 
+std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>>
+    generate_support_size_list_3D(rocfft_precision precision)
+{
+    std::vector<std::tuple<size_t, size_t, size_t, ComputeScheme>> retval;
+    KernelCoreSpecs                                                kcs;
+    auto GetWGSAndNT = [&kcs](size_t length, size_t& workGroupSize, size_t& numTransforms) {
+        return kcs.GetWGSAndNT(length, workGroupSize, numTransforms);
+    };
+    for(const auto& s : Single3DSizes(0, precision, GetWGSAndNT))
+    {
+        retval.push_back(std::make_tuple(
+            std::get<0>(s), std::get<1>(s), std::get<2>(s), CS_KERNEL_3D_SINGLE));
+    }
+    return retval;
+}
+
 int main(int argc, char* argv[])
 {
 
@@ -166,6 +182,9 @@ int main(int argc, char* argv[])
     // FIXME: make this controllable via cmdline?
     auto support_size_list_2D_single = generate_support_size_list_2D(rocfft_precision_single);
     auto support_size_list_2D_double = generate_support_size_list_2D(rocfft_precision_double);
+    // generate 3D fused kernels
+    auto support_size_list_3D_single = generate_support_size_list_3D(rocfft_precision_single);
+    auto support_size_list_3D_double = generate_support_size_list_3D(rocfft_precision_double);
 
     /*
       for(size_t i=7;i<=2401;i*=7){
@@ -189,26 +208,34 @@ int main(int argc, char* argv[])
     // all the small size of the same precsion are in one single file
     write_cpu_function_small(support_size_list, "single", small_kernels_group_num);
     write_cpu_function_small(support_size_list, "double", small_kernels_group_num);
+    write_cpu_function_small(support_size_list, "half", small_kernels_group_num);
 
     /* =====================================================================
 
     large1D is not a single kernels but a bunch of small kernels combinations
     here we use a vector of tuple to store the supported sizes
-    Initially available is 8K - 64K break into 64, 128, 256 combinations
+    Block column kernels (SBCC/SBRC) are generated for every 2/3/5 size
+    in [16, 512]; GetBlockComputeTable provides their block width and
+    work group size.
   =================================================================== */
 
+    std::vector<size_t> block_size_list;
+    for(auto len : support_size_list)
+    {
+        size_t p = len;
+        for(size_t rad : {2, 3, 5})
+            while(p % rad == 0)
+                p /= rad;
+        if(p == 1 && len >= 16 && len <= 512)
+            block_size_list.push_back(len);
+    }
+    std::sort(block_size_list.begin(), block_size_list.end());
+
     std::vector<std::tuple<size_t, ComputeScheme>> large1D_list;
-    large1D_list.push_back(std::make_tuple(64, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(81, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(100, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(128, CS_KERNEL_STOCKHAM_BLOCK_CC));
-    large1D_list.push_back(std::make_tuple(256, CS_KERNEL_STOCKHAM_BLOCK_CC));
-
-    large1D_list.push_back(std::make_tuple(64, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(81, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(100, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(128, CS_KERNEL_STOCKHAM_BLOCK_RC));
-    large1D_list.push_back(std::make_tuple(256, CS_KERNEL_STOCKHAM_BLOCK_RC));
+    for(auto len : block_size_list)
+        large1D_list.push_back(std::make_tuple(len, CS_KERNEL_STOCKHAM_BLOCK_CC));
+    for(auto len : block_size_list)
+        large1D_list.push_back(std::make_tuple(len, CS_KERNEL_STOCKHAM_BLOCK_RC));
 
     for(int i = 0; i < large1D_list.size(); i++)
     {
@@ -219,19 +246,36 @@ int main(int argc, char* argv[])
     // write big size CPU functions; one file for one size
     write_cpu_function_large(large1D_list, "single");
     write_cpu_function_large(large1D_list, "double");
+    write_cpu_function_large(large1D_list, "half");
 
     // write 2D fused kernels
     write_cpu_function_2D(support_size_list_2D_single, "single");
     write_cpu_function_2D(support_size_list_2D_double, "double");
+    // half-precision shares the single-precision 2D size list
+    write_cpu_function_2D(support_size_list_2D_single, "half");
     // generated code is all templated so we can generate the largest
     // number of sizes and decide at runtime whether the
     // double-precision variants can be used based on available LDS
     generate_2D_kernels(support_size_list_2D_single);
 
+    // write 3D fused kernels, same precision arrangement as 2D
+    write_cpu_function_3D(support_size_list_3D_single, "single");
+    write_cpu_function_3D(support_size_list_3D_double, "double");
+    write_cpu_function_3D(support_size_list_3D_single, "half");
+    generate_3D_kernels(support_size_list_3D_single);
+
+    // host butterflies for the host execution backend
+    WriteHostButterfliesToFile();
+
     // printf("Write CPU functions declaration to *.h file \n");
-    WriteCPUHeaders(support_size_list, large1D_list, support_size_list_2D_single);
+    WriteCPUHeaders(
+        support_size_list, large1D_list, support_size_list_2D_single, support_size_list_3D_single);
 
     // printf("Add CPU function into hash map \n");
-    AddCPUFunctionToPool(
-        support_size_list, large1D_list, support_size_list_2D_single, support_size_list_2D_double);
+    AddCPUFunctionToPool(support_size_list,
+                         large1D_list,
+                         support_size_list_2D_single,
+                         support_size_list_2D_double,
+                         support_size_list_3D_single,
+                         support_size_list_3D_double);
 }
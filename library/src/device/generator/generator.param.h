@@ -59,6 +59,13 @@ struct FFTKernelGenKeyParams
 
     bool fft_RCsimple;
 
+    bool fft_realFused; // also generate kernels with the post-processing of
+    // even-length real forward transforms fused into the last pass, and the
+    // pre-processing of inverse ones fused into the first
+
+    bool fft_batchPointers; // the complex kernels take a BatchPointers
+    // argument, to run batches of separately allocated transforms
+
     bool transOutHorizontal; // tiles traverse the output buffer in horizontal
     // direction
 
@@ -114,6 +121,10 @@ struct FFTKernelGenKeyParams
 
         fft_RCsimple = false;
 
+        fft_realFused = false;
+
+        fft_batchPointers = false;
+
         blockCompute     = false;
         blockSIMD        = 0;
         blockLDS         = 0;
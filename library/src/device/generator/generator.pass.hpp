@@ -148,7 +148,7 @@ namespace StockhamGenerator
 
             if(linearRegs)
             {
-                std::string regType = RegBaseType<PR>(2);
+                std::string regType = ComputeBaseType<PR>(2);
 
                 for(size_t i = 0; i < cnPerWI; i++)
                 {
@@ -250,8 +250,12 @@ namespace StockhamGenerator
             // j = (numButterfly*me + butterflyIndex)%LS
             // k = (numButterfly*me + butterflyIndex)/LS
 
-            std::string twType = RegBaseType<PR>(2);
-            std::string rType  = RegBaseType<PR>(1);
+            std::string twType = ComputeBaseType<PR>(2);
+            std::string rType  = ComputeBaseType<PR>(1);
+
+            // global buffers hold T, registers and LDS compute_t<T>
+            const bool global
+                = (flag == SR_READ && ReadsGlobal()) || (flag == SR_WRITE && WritesGlobal());
 
             size_t      butterflyIndex = numPrev;
             std::string bufOffset;
@@ -273,12 +277,15 @@ namespace StockhamGenerator
                 // interleaved data
 
                 passStr += "\n\t //Optimization: coalescing into float4/double4 write";
-                passStr += "\n\tif(sb == SB_UNIT) {";
+                passStr += "\n\tif(sb == SB_UNIT && is_vector4_aligned(" + bufferRe + " + " + offset
+                           + ")) {";
+                const std::string buff4Type
+                    = global ? RegBaseType<PR>(4) : ComputeBaseType<PR>(4);
                 passStr += "\n\t";
-                passStr += RegBaseType<PR>(4);
+                passStr += buff4Type;
                 passStr += " *buff4g = ";
-                passStr += "(" + RegBaseType<PR>(4) + "*)" + bufferRe;
-                passStr += ";\n\t"; // Assuming 'outOffset' is 0, so not adding it here
+                passStr += "(" + buff4Type + "*)(" + bufferRe + " + " + offset + ")";
+                passStr += ";\n\t";
 
                 for(size_t r = 0; r < radix;
                     r++) // setting the radix loop outside to facilitate grouped writing
@@ -305,21 +312,37 @@ namespace StockhamGenerator
                         passStr += std::to_string(r * (algLS / 2));
                         passStr += " ]";
                         passStr += " = ";
-                        passStr += MakeRegBaseType<PR>(4);
-                        passStr += "(";
-                        passStr += regIndexA;
-                        passStr += ".x, ";
-                        passStr += regIndexA;
-                        passStr += ".y, ";
-                        passStr += regIndexB;
-                        passStr += ".x, ";
-                        passStr += regIndexB;
-                        passStr += ".y) ";
-                        if(scale != 1.0f)
+                        if(global)
                         {
-                            passStr += " * ";
-                            passStr += FloatToStr(scale);
-                            passStr += FloatSuffix<PR>();
+                            // scale in registers, then narrow to T
+                            std::string scaleStr;
+                            if(scale != 1.0f)
+                                scaleStr = " * " + FloatToStr(scale) + FloatSuffix<PR>();
+                            passStr += MakeRegBaseType<PR>(4);
+                            passStr += "(";
+                            passStr += regIndexA + ".x" + scaleStr + ", ";
+                            passStr += regIndexA + ".y" + scaleStr + ", ";
+                            passStr += regIndexB + ".x" + scaleStr + ", ";
+                            passStr += regIndexB + ".y" + scaleStr + ")";
+                        }
+                        else
+                        {
+                            passStr += MakeComputeBaseType<PR>(4);
+                            passStr += "(";
+                            passStr += regIndexA;
+                            passStr += ".x, ";
+                            passStr += regIndexA;
+                            passStr += ".y, ";
+                            passStr += regIndexB;
+                            passStr += ".x, ";
+                            passStr += regIndexB;
+                            passStr += ".y) ";
+                            if(scale != 1.0f)
+                            {
+                                passStr += " * ";
+                                passStr += FloatToStr(scale);
+                                passStr += FloatSuffix<PR>();
+                            }
                         }
                         passStr += ";";
 
@@ -336,6 +359,67 @@ namespace StockhamGenerator
             bool   swapElement = false;
             size_t tIter       = numB * radix;
 
+            bool vector4_read = false;
+            // special read from memory with float4 grouping, reading 2 adjacent
+            // complex numbers at once. Registers (2i)*radix+r and (2i+1)*radix+r
+            // hold neighbouring elements, so the pair comes from one load.
+            if(numB && (numB % 2 == 0) && (regC == 1) && (numButterfly % 2 == 0)
+               && ((length / radix) % 2 == 0) && (flag == SR_READ) && interleaved
+               && (component == SR_COMP_BOTH) && linearRegs && enableGrouping
+               && !fft_doPreCallback)
+            {
+                assert(bufferRe.compare(bufferIm) == 0); // Make sure Real & Imag buffer
+                // strings are same for
+                // interleaved data
+
+                passStr += "\n\t //Optimization: coalescing into float4/double4 read";
+                passStr += "\n\tif(sb == SB_UNIT && is_vector4_aligned(" + bufferRe + " + " + offset
+                           + ")) {";
+                const std::string buff4Type
+                    = global ? RegBaseType<PR>(4) : ComputeBaseType<PR>(4);
+                passStr += "\n\tconst ";
+                passStr += buff4Type;
+                passStr += " *buff4g = ";
+                passStr += "(const " + buff4Type + "*)(" + bufferRe + " + " + offset + ")";
+                passStr += ";\n\t";
+
+                for(size_t r = 0; r < radix; r++)
+                {
+                    for(size_t i = 0; i < (numB / 2); i++)
+                    {
+                        std::string regIndexA = "(*R";
+                        std::string regIndexB = "(*R";
+
+                        RegBaseAndCountAndPos("", (2 * i + 0) * radix + r, regIndexA);
+                        regIndexA += ")";
+                        RegBaseAndCountAndPos("", (2 * i + 1) * radix + r, regIndexB);
+                        regIndexB += ")";
+
+                        std::string elem = "buff4g[ ";
+                        elem += std::to_string(numButterfly / 2);
+                        elem += "*me + ";
+                        elem += std::to_string(i);
+                        elem += " + ";
+                        elem += std::to_string(r * (length / radix) / 2);
+                        elem += " ]";
+
+                        passStr += "\n\t{ " + buff4Type + " v4 = " + elem + "; ";
+                        passStr += regIndexA;
+                        passStr += " = ";
+                        passStr += MakeComputeBaseType<PR>(2);
+                        passStr += "(v4.x, v4.y); ";
+                        passStr += regIndexB;
+                        passStr += " = ";
+                        passStr += MakeComputeBaseType<PR>(2);
+                        passStr += "(v4.z, v4.w); }";
+                    }
+                }
+                passStr += "\n\t}";
+                passStr += "\n\telse{ // such optimization is not possible ";
+
+                vector4_read = true;
+            }
+
             // block to rearrange reads of adjacent memory locations together
             if(linearRegs && (flag == SR_READ))
             {
@@ -426,10 +510,17 @@ namespace StockhamGenerator
                             passStr += regIndex;
                             passStr += " = ";
 
+                            // whole elements of T are widened explicitly,
+                            // single components convert implicitly
+                            bool widen = global && interleaved && (component == SR_COMP_BOTH);
+                            if(widen)
+                                passStr += "lib_convert_vector2<" + ComputeBaseType<PR>(2) + ">(";
                             passStr += buffer;
                             passStr += "[";
                             passStr += bufOffset;
                             passStr += "]";
+                            if(widen)
+                                passStr += ")";
                             passStr += tail;
 
                             // Since we read real & imag at once, we break the loop
@@ -438,6 +529,9 @@ namespace StockhamGenerator
                         }
                     }
                 }
+
+                if(vector4_read)
+                    passStr += "\n\t}";
                 return;
             }
 
@@ -539,6 +633,11 @@ namespace StockhamGenerator
                             if(c == cStart)
                                 regIndexC0 = regIndex;
 
+                            // whole elements are narrowed to T explicitly
+                            if(global && interleaved && (component == SR_COMP_BOTH))
+                                regIndex = "lib_convert_vector2<" + RegBaseType<PR>(2) + ">("
+                                           + regIndex + ")";
+
                             passStr += "\n\t";
                             passStr += buffer;
                             passStr += "[";
@@ -747,7 +846,8 @@ namespace StockhamGenerator
                                 passStr += twType;
                                 passStr += " W = ";
                                 passStr += tw3StepFunc;
-                                passStr += "<T>(twiddles_large, ";
+                                passStr += "<" + twType + ", TwdSincos>";
+                                passStr += "(twiddles_large, twiddles_large_len, ";
 
                                 if(frontTwiddle)
                                 {
@@ -1054,7 +1154,7 @@ namespace StockhamGenerator
                 assert(false);
             }
 
-            std::string rType = RegBaseType<PR>(1);
+            std::string rType = ComputeBaseType<PR>(1);
 
             assert(r2c || c2r);
             assert(linearRegs);
@@ -1369,10 +1469,10 @@ namespace StockhamGenerator
                                 if(interleaved && (component == SR_COMP_BOTH))
                                 {
                                     val1Str += "(";
-                                    val1Str += RegBaseType<PR>(2);
+                                    val1Str += ComputeBaseType<PR>(2);
                                     val1Str += ")( ";
                                     val2Str += "(";
-                                    val2Str += RegBaseType<PR>(2);
+                                    val2Str += ComputeBaseType<PR>(2);
                                     val2Str += ")( ";
 
                                     if(!batch2)
@@ -1683,6 +1783,18 @@ namespace StockhamGenerator
         {
             return position;
         }
+
+        // Whether the pass reads its input from, or writes its output to,
+        // global memory rather than LDS.  Block compute kernels (which do
+        // not use halfLds) stage all global data through LDS themselves.
+        bool ReadsGlobal() const
+        {
+            return halfLds && (position == 0);
+        }
+        bool WritesGlobal() const
+        {
+            return halfLds && (nextPass == NULL);
+        }
         size_t GetRadix() const
         {
             return radix;
@@ -1747,15 +1859,21 @@ namespace StockhamGenerator
             if(singlePass)
                 assert(workGroupSize == 1);
 
-            // Register types
-            std::string regB1Type = RegBaseType<PR>(1);
-            std::string regB2Type = RegBaseType<PR>(2);
-            std::string regB4Type = RegBaseType<PR>(4);
+            // Register types, also those of LDS and twiddles
+            std::string regB1Type = ComputeBaseType<PR>(1);
+            std::string regB2Type = ComputeBaseType<PR>(2);
+            std::string regB4Type = ComputeBaseType<PR>(4);
+
+            // Global memory types
+            std::string memB1Type = RegBaseType<PR>(1);
+            std::string memB2Type = RegBaseType<PR>(2);
+            assert(gIn == ReadsGlobal());
+            assert(gOut == WritesGlobal());
 
             // Function attribute
             if(name_suffix == "_sbcc") // // the blockCompute BCT_C2C algorithm use only
             {
-                passStr += "template <typename T, StrideBin sb, bool TwdLarge>\n";
+                passStr += "template <typename T, StrideBin sb, bool TwdLarge, bool TwdSincos>\n";
             }
             else
             {
@@ -1773,6 +1891,8 @@ namespace StockhamGenerator
                 passStr += "const " + regB2Type
                            + " *twiddles_large, "; // the blockCompute BCT_C2C algorithm use only
             // one more twiddle parameter
+            if(name_suffix == "_sbcc")
+                passStr += "const size_t twiddles_large_len, ";
             passStr += "const size_t stride_in, const size_t stride_out, ";
             passStr += "unsigned int rw, unsigned int b, ";
             if(realSpecial)
@@ -1787,13 +1907,13 @@ namespace StockhamGenerator
                 {
                     if(inInterleaved)
                     {
-                        passStr += regB2Type;
+                        passStr += memB2Type;
                         passStr += " *";
                         passStr += bufferInRe;
                         passStr += ", ";
                         if(!rcSimple)
                         {
-                            passStr += regB2Type;
+                            passStr += memB2Type;
                             passStr += " *";
                             passStr += bufferInRe2;
                             passStr += ", ";
@@ -1801,13 +1921,13 @@ namespace StockhamGenerator
                     }
                     else if(inReal)
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferInRe;
                         passStr += ", ";
                         if(!rcSimple)
                         {
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferInRe2;
                             passStr += ", ";
@@ -1815,24 +1935,24 @@ namespace StockhamGenerator
                     }
                     else
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferInRe;
                         passStr += ", ";
                         if(!rcSimple)
                         {
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferInRe2;
                             passStr += ", ";
                         }
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferInIm;
                         passStr += ", ";
                         if(!rcSimple)
                         {
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferInIm2;
                             passStr += ", ";
@@ -1855,50 +1975,50 @@ namespace StockhamGenerator
                 {
                     if(outInterleaved)
                     {
-                        passStr += regB2Type;
+                        passStr += memB2Type;
                         passStr += " *";
                         passStr += bufferOutRe;
                         if(!rcSimple)
                         {
                             passStr += ", ";
-                            passStr += regB2Type;
+                            passStr += memB2Type;
                             passStr += " *";
                             passStr += bufferOutRe2;
                         }
                     }
                     else if(outReal)
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferOutRe;
                         if(!rcSimple)
                         {
                             passStr += ", ";
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferOutRe2;
                         }
                     }
                     else
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferOutRe;
                         passStr += ", ";
                         if(!rcSimple)
                         {
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferOutRe2;
                             passStr += ", ";
                         }
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferOutIm;
                         if(!rcSimple)
                         {
                             passStr += ", ";
-                            passStr += regB1Type;
+                            passStr += memB1Type;
                             passStr += " *";
                             passStr += bufferOutIm2;
                         }
@@ -1921,18 +2041,18 @@ namespace StockhamGenerator
                 {
                     if(inInterleaved)
                     {
-                        passStr += regB2Type;
+                        passStr += memB2Type;
                         passStr += " *";
                         passStr += bufferInRe;
                         passStr += ", ";
                     }
                     else
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferInRe;
                         passStr += ", ";
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferInIm;
                         passStr += ", ";
@@ -1964,17 +2084,17 @@ namespace StockhamGenerator
                 {
                     if(outInterleaved)
                     {
-                        passStr += regB2Type;
+                        passStr += memB2Type;
                         passStr += " *";
                         passStr += bufferOutRe;
                     }
                     else
                     {
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferOutRe;
                         passStr += ", ";
-                        passStr += regB1Type;
+                        passStr += memB1Type;
                         passStr += " *";
                         passStr += bufferOutIm;
                     }
@@ -89,7 +89,9 @@ namespace StockhamGenerator
         return result;
     }
 
-    // Register data base types
+    // Data base types of the kernel template parameter T, which global
+    // buffers are stored in.  The butterflies are templated directly on
+    // their register type, so they use these too.
     template <rocfft_precision PR>
     inline std::string RegBaseType(size_t count)
     {
@@ -124,6 +126,42 @@ namespace StockhamGenerator
         }
     }
 
+    // Register, LDS and twiddle data base types: compute_t<T> is fp32 for
+    // half precision, so only global memory is fp16
+    template <rocfft_precision PR>
+    inline std::string ComputeBaseType(size_t count)
+    {
+        switch(count)
+        {
+        case 1:
+            return "real_type_t<compute_t<T>>"; // float, double
+        case 2:
+            return "compute_t<T>"; // float2, double2
+        case 4:
+            return "vector4_type_t<compute_t<T>>"; // float4, double4
+        default:
+            assert(false);
+            return "";
+        }
+    }
+
+    template <rocfft_precision PR>
+    inline std::string MakeComputeBaseType(size_t count)
+    {
+        switch(count)
+        {
+        case 1:
+            return "real_type_t<compute_t<T>>"; // float, double
+        case 2:
+            return "lib_make_vector2<compute_t<T>>"; // float2, double2
+        case 4:
+            return "lib_make_vector4< vector4_type_t<compute_t<T>> >"; // float4, double4
+        default:
+            assert(false);
+            return "";
+        }
+    }
+
     template <rocfft_precision PR>
     inline std::string FloatSuffix()
     {
@@ -131,6 +169,7 @@ namespace StockhamGenerator
         std::string sfx;
         switch(PR)
         {
+        case rocfft_precision_half:
         case rocfft_precision_single:
             sfx = "f";
             break;
@@ -185,7 +224,8 @@ namespace StockhamGenerator
 
     inline std::string TwTableLargeFunc()
     {
-        return "TW2step"; // TODO: switch according to the problem size
+        // dispatches at compile time between TW2step and in-kernel sincos
+        return "TWLarge";
     }
 };
 
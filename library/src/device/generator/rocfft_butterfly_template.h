@@ -9,6 +9,7 @@
 
 #include "../kernels/butterfly_constant.h"
 #include "../kernels/common.h"
+#include "../kernels/realcomplex_fused.h"
 
 template <typename T>
 __device__ T TW2step(const T* twiddles, size_t u)
@@ -48,6 +49,18 @@ __device__ T TW3step(const T* twiddles, size_t u)
     return result;
 }
 
+// Large twiddle for block column kernels: read from the TwiddleTableLarge,
+// or computed in-kernel when the plan chose TwdSincos (N is the large1D
+// length the table would have been built for).
+template <typename T, bool TwdSincos>
+__device__ T TWLarge(const T* twiddles, size_t N, size_t u)
+{
+    if(TwdSincos)
+        return TWLsincos<T>(N, u);
+    else
+        return TW2step<T>(twiddles, u);
+}
+
 template <typename T>
 __device__ void FwdRad2B1(T* R0, T* R1)
 {
@@ -22,7 +22,6 @@
 #define ARRAY_FORMAT_H
 
 #include "common.h"
-#include "gpubuf.h"
 
 //-----------------------------------------------------------------------------
 // To support planar format with template, we have the below simple conventions.
@@ -37,10 +36,12 @@ struct planar
 // the default interleaved format
 using cmplx_float  = float2;
 using cmplx_double = double2;
+using cmplx_half   = rocfft_half2;
 
 // the planar format
 using cmplx_float_planar  = planar<float2>;
 using cmplx_double_planar = planar<double2>;
+using cmplx_half_planar   = planar<rocfft_half2>;
 
 template <class T>
 struct cmplx_type;
@@ -57,6 +58,12 @@ struct cmplx_type<double2>
     typedef double2 type;
 };
 
+template <>
+struct cmplx_type<cmplx_half>
+{
+    typedef rocfft_half2 type;
+};
+
 template <>
 struct cmplx_type<cmplx_float_planar>
 {
@@ -69,6 +76,12 @@ struct cmplx_type<cmplx_double_planar>
     typedef double2 type;
 };
 
+template <>
+struct cmplx_type<cmplx_half_planar>
+{
+    typedef rocfft_half2 type;
+};
+
 template <class T>
 using cmplx_type_t = typename cmplx_type<T>::type;
 
@@ -105,79 +118,115 @@ struct Handler<cmplx_double>
     }
 };
 
+template <>
+struct Handler<cmplx_half>
+{
+    static __host__ __device__ inline rocfft_half2 read(cmplx_half const* in, size_t idx)
+    {
+        return in[idx];
+    }
+
+    static __host__ __device__ inline void write(cmplx_half* out, size_t idx, rocfft_half2 v)
+    {
+        out[idx] = v;
+    }
+};
+
 template <>
 struct Handler<cmplx_float_planar>
 {
-    static __host__ __device__ inline float2 read(cmplx_float_planar const* in, size_t idx)
+    static __host__ __device__ inline float2 read(cmplx_float_planar const& in, size_t idx)
     {
         float2 t;
-        t.x = in->R[idx];
-        t.y = in->I[idx];
+        t.x = in.R[idx];
+        t.y = in.I[idx];
         return t;
     }
 
-    static __host__ __device__ inline void write(cmplx_float_planar* out, size_t idx, float2 v)
+    static __host__ __device__ inline void write(cmplx_float_planar const& out, size_t idx, float2 v)
     {
-        out->R[idx] = v.x;
-        out->I[idx] = v.y;
+        out.R[idx] = v.x;
+        out.I[idx] = v.y;
     }
 };
 
 template <>
 struct Handler<cmplx_double_planar>
 {
-    static __host__ __device__ inline double2 read(cmplx_double_planar const* in, size_t idx)
+    static __host__ __device__ inline double2 read(cmplx_double_planar const& in, size_t idx)
     {
         double2 t;
-        t.x = in->R[idx];
-        t.y = in->I[idx];
+        t.x = in.R[idx];
+        t.y = in.I[idx];
         return t;
     }
 
-    static __host__ __device__ inline void write(cmplx_double_planar* out, size_t idx, double2 v)
+    static __host__ __device__ inline void write(cmplx_double_planar const& out, size_t idx, double2 v)
     {
-        out->R[idx] = v.x;
-        out->I[idx] = v.y;
+        out.R[idx] = v.x;
+        out.I[idx] = v.y;
     }
 };
 
-static bool is_complex_planar(rocfft_array_type type)
-{
-    return type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar;
-}
-static bool is_complex_interleaved(rocfft_array_type type)
-{
-    return type == rocfft_array_type_complex_interleaved
-           || type == rocfft_array_type_hermitian_interleaved;
-}
-
-template <class T>
-struct cmplx_planar_device_buffer
+template <>
+struct Handler<cmplx_half_planar>
 {
-    cmplx_planar_device_buffer(void* real, void* imag)
+    static __host__ __device__ inline rocfft_half2 read(cmplx_half_planar const& in, size_t idx)
     {
-        planar<T> hostBuf;
-        hostBuf.R = static_cast<real_type_t<T>*>(real);
-        hostBuf.I = static_cast<real_type_t<T>*>(imag);
-        deviceBuf.alloc(sizeof(hostBuf));
-        hipMemcpy(deviceBuf.data(), &hostBuf, sizeof(hostBuf), hipMemcpyHostToDevice);
+        rocfft_half2 t;
+        t.x = in.R[idx];
+        t.y = in.I[idx];
+        return t;
     }
-    // if we're given const pointers, cheat and cast away const to
-    // simplify this struct.  the goal of this struct is to
-    // automatically manage the memory, not provide
-    // const-correctness.
-    cmplx_planar_device_buffer(const void* real, const void* imag)
-        : cmplx_planar_device_buffer(const_cast<void*>(real), const_cast<void*>(imag))
+
+    static __host__ __device__ inline void
+        write(cmplx_half_planar const& out, size_t idx, rocfft_half2 v)
     {
+        out.R[idx] = v.x;
+        out.I[idx] = v.y;
     }
+};
+
+// How kernels take a buffer of each format: interleaved buffers as a
+// pointer, planar buffers as the planar struct itself, by value, so
+// that a launch needs no copy of the struct in device memory.
+template <typename T>
+struct array_arg
+{
+    using in_type  = const T*;
+    using out_type = T*;
 
-    planar<T>* devicePtr()
+    static T* make(void* const buf[2])
     {
-        return deviceBuf.data();
+        return static_cast<T*>(buf[0]);
     }
+};
 
-private:
-    gpubuf_t<planar<T>> deviceBuf;
+template <typename T>
+struct array_arg<planar<T>>
+{
+    using in_type  = planar<T>;
+    using out_type = planar<T>;
+
+    static planar<T> make(void* const buf[2])
+    {
+        return {static_cast<real_type_t<T>*>(buf[0]), static_cast<real_type_t<T>*>(buf[1])};
+    }
 };
 
+template <class T>
+using array_in_t = typename array_arg<T>::in_type;
+template <class T>
+using array_out_t = typename array_arg<T>::out_type;
+
+static bool is_complex_planar(rocfft_array_type type)
+{
+    return type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar;
+}
+static bool is_complex_interleaved(rocfft_array_type type)
+{
+    return type == rocfft_array_type_complex_interleaved
+           || type == rocfft_array_type_hermitian_interleaved;
+}
+
 #endif
@@ -27,12 +27,16 @@
 #include "rocfft_hip.h"
 
 template <typename T>
-__global__ void chirp_device(
-    const size_t N, const size_t M, T* output, T* twiddles_large, const int twl, const int dir)
+__global__ void chirp_device(const size_t  N,
+                             const size_t  M,
+                             T*            output,
+                             compute_t<T>* twiddles_large,
+                             const int     twl,
+                             const int     dir)
 {
     size_t tx = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
 
-    T val = lib_make_vector2<T>(0, 0);
+    compute_t<T> val = lib_make_vector2<compute_t<T>>(0, 0);
 
     if(twl == 1)
         val = TWLstep1(twiddles_large, (tx * tx) % (2 * N));
@@ -43,20 +47,21 @@ __global__ void chirp_device(
     else if(twl == 4)
         val = TWLstep4(twiddles_large, (tx * tx) % (2 * N));
 
-    val.y *= (real_type_t<T>)(dir);
+    val.y *= (real_type_t<compute_t<T>>)(dir);
 
+    const T chirp = lib_convert_vector2<T>(val);
     if(tx == 0)
     {
-        output[tx]     = val;
-        output[tx + M] = val;
+        output[tx]     = chirp;
+        output[tx + M] = chirp;
     }
     else if(tx < N)
     {
-        output[tx]     = val;
-        output[tx + M] = val;
+        output[tx]     = chirp;
+        output[tx + M] = chirp;
 
-        output[M - tx]     = val;
-        output[M - tx + M] = val;
+        output[M - tx]     = chirp;
+        output[M - tx + M] = chirp;
     }
     else if(tx <= (M - N))
     {
@@ -69,6 +74,11 @@ __global__ void chirp_device(
 // are 3 steps in Bluestein algorithm. And In the below, we have
 // 4 similar overloaded functions to support interleaved and
 // planar format. There might be a better way to do it.
+//
+// The 1/M normalization of the convolution is applied in fft_mul,
+// before the inverse FFT rather than after it, so that the padded
+// transform never holds values M times larger than the result; those
+// overflow fp16 storage for half-precision transforms.
 
 template <typename T>
 __global__ void mul_device(const size_t  numof,
@@ -116,9 +126,10 @@ __global__ void mul_device(const size_t  numof,
     {
         output += oOffset;
 
-        T out          = output[oIdx];
-        output[oIdx].x = input[iIdx].x * out.x - input[iIdx].y * out.y;
-        output[oIdx].y = input[iIdx].x * out.y + input[iIdx].y * out.x;
+        real_type_t<compute_t<T>> MI  = 1.0 / (real_type_t<compute_t<T>>)M;
+        compute_t<T>              out = lib_convert_vector2<compute_t<T>>(output[oIdx]);
+        output[oIdx].x                = MI * (input[iIdx].x * out.x - input[iIdx].y * out.y);
+        output[oIdx].y                = MI * (input[iIdx].x * out.y + input[iIdx].y * out.x);
     }
     else if(scheme == 1)
     {
@@ -131,8 +142,9 @@ __global__ void mul_device(const size_t  numof,
 
         if(tx < N)
         {
-            output[oIdx].x = input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y;
-            output[oIdx].y = -input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x;
+            compute_t<T> c = lib_convert_vector2<compute_t<T>>(chirp[tx]);
+            output[oIdx].x = input[iIdx].x * c.x + input[iIdx].y * c.y;
+            output[oIdx].y = -input[iIdx].x * c.y + input[iIdx].y * c.x;
         }
         else
         {
@@ -148,9 +160,9 @@ __global__ void mul_device(const size_t  numof,
 
         output += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        output[oIdx].x    = MI * (input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y);
-        output[oIdx].y    = MI * (-input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x);
+        compute_t<T> c = lib_convert_vector2<compute_t<T>>(chirp[tx]);
+        output[oIdx].x = input[iIdx].x * c.x + input[iIdx].y * c.y;
+        output[oIdx].y = -input[iIdx].x * c.y + input[iIdx].y * c.x;
     }
 }
 
@@ -202,9 +214,10 @@ __global__ void mul_device(const size_t          numof,
     {
         output += oOffset;
 
-        T out          = output[oIdx];
-        output[oIdx].x = inputRe[iIdx] * out.x - inputIm[iIdx] * out.y;
-        output[oIdx].y = inputRe[iIdx] * out.y + inputIm[iIdx] * out.x;
+        real_type_t<compute_t<T>> MI  = 1.0 / (real_type_t<compute_t<T>>)M;
+        compute_t<T>              out = lib_convert_vector2<compute_t<T>>(output[oIdx]);
+        output[oIdx].x                = MI * (inputRe[iIdx] * out.x - inputIm[iIdx] * out.y);
+        output[oIdx].y                = MI * (inputRe[iIdx] * out.y + inputIm[iIdx] * out.x);
     }
     else if(scheme == 1)
     {
@@ -218,8 +231,9 @@ __global__ void mul_device(const size_t          numof,
 
         if(tx < N)
         {
-            output[oIdx].x = inputRe[iIdx] * chirp[tx].x + inputIm[iIdx] * chirp[tx].y;
-            output[oIdx].y = -inputRe[iIdx] * chirp[tx].y + inputIm[iIdx] * chirp[tx].x;
+            compute_t<T> c = lib_convert_vector2<compute_t<T>>(chirp[tx]);
+            output[oIdx].x = inputRe[iIdx] * c.x + inputIm[iIdx] * c.y;
+            output[oIdx].y = -inputRe[iIdx] * c.y + inputIm[iIdx] * c.x;
         }
         else
         {
@@ -239,9 +253,9 @@ __global__ void mul_device(const size_t          numof,
 
         output += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        output[oIdx].x    = MI * (inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx]);
-        output[oIdx].y    = MI * (-inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx]);
+        compute_t<T> c = lib_make_vector2<compute_t<T>>(chirpRe[tx], chirpIm[tx]);
+        output[oIdx].x = inputRe[iIdx] * c.x + inputIm[iIdx] * c.y;
+        output[oIdx].y = -inputRe[iIdx] * c.y + inputIm[iIdx] * c.x;
     }
 }
 
@@ -294,9 +308,11 @@ __global__ void mul_device(const size_t    numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        T out          = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
-        outputRe[oIdx] = input[iIdx].x * out.x - input[iIdx].y * out.y;
-        outputIm[oIdx] = input[iIdx].x * out.y + input[iIdx].y * out.x;
+        real_type_t<compute_t<T>> MI  = 1.0 / (real_type_t<compute_t<T>>)M;
+        compute_t<T>              out
+            = lib_make_vector2<compute_t<T>>(outputRe[oIdx], outputIm[oIdx]);
+        outputRe[oIdx]                = MI * (input[iIdx].x * out.x - input[iIdx].y * out.y);
+        outputIm[oIdx]                = MI * (input[iIdx].x * out.y + input[iIdx].y * out.x);
     }
     else if(scheme == 1)
     {
@@ -313,8 +329,9 @@ __global__ void mul_device(const size_t    numof,
 
         if(tx < N)
         {
-            outputRe[oIdx] = input[iIdx].x * chirpRe[tx] + input[iIdx].y * chirpIm[tx];
-            outputIm[oIdx] = -input[iIdx].x * chirpIm[tx] + input[iIdx].y * chirpRe[tx];
+            compute_t<T> c = lib_make_vector2<compute_t<T>>(chirpRe[tx], chirpIm[tx]);
+            outputRe[oIdx] = input[iIdx].x * c.x + input[iIdx].y * c.y;
+            outputIm[oIdx] = -input[iIdx].x * c.y + input[iIdx].y * c.x;
         }
         else
         {
@@ -332,9 +349,9 @@ __global__ void mul_device(const size_t    numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        outputRe[oIdx]    = MI * (input[iIdx].x * chirp[tx].x + input[iIdx].y * chirp[tx].y);
-        outputIm[oIdx]    = MI * (-input[iIdx].x * chirp[tx].y + input[iIdx].y * chirp[tx].x);
+        compute_t<T> c = lib_convert_vector2<compute_t<T>>(chirp[tx]);
+        outputRe[oIdx] = input[iIdx].x * c.x + input[iIdx].y * c.y;
+        outputIm[oIdx] = -input[iIdx].x * c.y + input[iIdx].y * c.x;
     }
 }
 
@@ -388,9 +405,11 @@ __global__ void mul_device(const size_t          numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        T out          = lib_make_vector2<T>(outputRe[oIdx], outputIm[oIdx]);
-        outputRe[oIdx] = inputRe[iIdx] * out.x - inputIm[iIdx] * out.y;
-        outputIm[oIdx] = inputRe[iIdx] * out.y + inputIm[iIdx] * out.x;
+        real_type_t<compute_t<T>> MI  = 1.0 / (real_type_t<compute_t<T>>)M;
+        compute_t<T>              out
+            = lib_make_vector2<compute_t<T>>(outputRe[oIdx], outputIm[oIdx]);
+        outputRe[oIdx]                = MI * (inputRe[iIdx] * out.x - inputIm[iIdx] * out.y);
+        outputIm[oIdx]                = MI * (inputRe[iIdx] * out.y + inputIm[iIdx] * out.x);
     }
     else if(scheme == 1)
     {
@@ -408,8 +427,9 @@ __global__ void mul_device(const size_t          numof,
 
         if(tx < N)
         {
-            outputRe[oIdx] = inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx];
-            outputIm[oIdx] = -inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx];
+            compute_t<T> c = lib_make_vector2<compute_t<T>>(chirpRe[tx], chirpIm[tx]);
+            outputRe[oIdx] = inputRe[iIdx] * c.x + inputIm[iIdx] * c.y;
+            outputIm[oIdx] = -inputRe[iIdx] * c.y + inputIm[iIdx] * c.x;
         }
         else
         {
@@ -431,9 +451,9 @@ __global__ void mul_device(const size_t          numof,
         outputRe += oOffset;
         outputIm += oOffset;
 
-        real_type_t<T> MI = 1.0 / (real_type_t<T>)M;
-        outputRe[oIdx]    = MI * (inputRe[iIdx] * chirpRe[tx] + inputIm[iIdx] * chirpIm[tx]);
-        outputIm[oIdx]    = MI * (-inputRe[iIdx] * chirpIm[tx] + inputIm[iIdx] * chirpRe[tx]);
+        compute_t<T> c = lib_make_vector2<compute_t<T>>(chirpRe[tx], chirpIm[tx]);
+        outputRe[oIdx] = inputRe[iIdx] * c.x + inputIm[iIdx] * c.y;
+        outputIm[oIdx] = -inputRe[iIdx] * c.y + inputIm[iIdx] * c.x;
     }
 }
 
@@ -5,8 +5,11 @@
 #ifndef COMMON_H
 #define COMMON_H
 #include "rocfft.h"
+#include "rocfft_hip.h"
+#include <cstdint>
 #include <hip/hip_vector_types.h>
 #include <iostream>
+#include <type_traits>
 
 #ifdef __NVCC__
 #include "vector_types.h"
@@ -60,6 +63,12 @@ struct real_type<double4>
     typedef double type;
 };
 
+template <>
+struct real_type<rocfft_half4>
+{
+    typedef _Float16 type;
+};
+
 template <>
 struct real_type<float2>
 {
@@ -72,6 +81,12 @@ struct real_type<double2>
     typedef double type;
 };
 
+template <>
+struct real_type<rocfft_half2>
+{
+    typedef _Float16 type;
+};
+
 template <class T>
 using real_type_t = typename real_type<T>::type;
 
@@ -94,6 +109,12 @@ struct complex_type<double>
     typedef double2 type;
 };
 
+template <>
+struct complex_type<_Float16>
+{
+    typedef rocfft_half2 type;
+};
+
 template <class T>
 using complex_type_t = typename complex_type<T>::type;
 
@@ -116,6 +137,12 @@ struct vector4_type<double2>
     typedef double4 type;
 };
 
+template <>
+struct vector4_type<rocfft_half2>
+{
+    typedef rocfft_half4 type;
+};
+
 template <class T>
 using vector4_type_t = typename vector4_type<T>::type;
 
@@ -138,6 +165,12 @@ struct vector2_type<rocfft_precision_double>
     typedef double2 type;
 };
 
+template <>
+struct vector2_type<rocfft_precision_half>
+{
+    typedef rocfft_half2 type;
+};
+
 template <rocfft_precision T>
 using vector2_type_t = typename vector2_type<T>::type;
 
@@ -145,6 +178,33 @@ using vector2_type_t = typename vector2_type<T>::type;
 // vector2_type_t<rocfft_precision_single> float2_scalar;
 // vector2_type_t<rocfft_precision_double> double2_scalar;
 
+// Type that kernels do arithmetic in for data stored as T: half
+// precision is loaded into fp32 registers, and its LDS and twiddles are
+// fp32 as well.  Single and double compute in their storage type.
+template <class T>
+struct compute_type
+{
+    typedef T type;
+};
+
+template <>
+struct compute_type<rocfft_half2>
+{
+    typedef float2 type;
+};
+
+template <>
+struct compute_type<rocfft_half4>
+{
+    typedef float4 type;
+};
+
+template <class T>
+using compute_t = typename compute_type<T>::type;
+
+/* example of using compute_t */
+// compute_t<rocfft_half2> float2_scalar;
+
 template <typename T>
 __device__ inline T lib_make_vector2(real_type_t<T> v0, real_type_t<T> v1);
 
@@ -172,6 +232,12 @@ __device__ inline double2 lib_make_vector2(double v0, double v1)
 }
 #endif
 
+template <>
+__device__ inline rocfft_half2 lib_make_vector2(_Float16 v0, _Float16 v1)
+{
+    return rocfft_half2(v0, v1);
+}
+
 template <typename T>
 __device__ inline T
     lib_make_vector4(real_type_t<T> v0, real_type_t<T> v1, real_type_t<T> v2, real_type_t<T> v3);
@@ -200,6 +266,30 @@ __device__ inline double4 lib_make_vector4(double v0, double v1, double v2, doub
 }
 #endif
 
+template <>
+__device__ inline rocfft_half4
+    lib_make_vector4(_Float16 v0, _Float16 v1, _Float16 v2, _Float16 v3)
+{
+    return rocfft_half4(v0, v1, v2, v3);
+}
+
+// Convert a complex value to type T, e.g. between the storage and
+// compute types of half precision.  A plain copy for matching types.
+template <typename T, typename Tin>
+__device__ inline T lib_convert_vector2(const Tin& v)
+{
+    return lib_make_vector2<T>(v.x, v.y);
+}
+
+// Generated kernels access two adjacent complex elements at once through
+// vector4_type_t<T> when the pointer is suitably aligned; the alignment
+// depends on offsets and distances only known at run time.
+template <typename T>
+__device__ inline bool is_vector4_aligned(const T* p)
+{
+    return (reinterpret_cast<uintptr_t>(p) % sizeof(vector4_type_t<T>)) == 0;
+}
+
 template <typename T>
 __device__ T TWLstep1(T* twiddles, size_t u)
 {
@@ -256,24 +346,52 @@ __device__ T TWLstep4(T* twiddles, size_t u)
     return result;
 }
 
-#define TWIDDLE_STEP_MUL_FWD(TWFUNC, TWIDDLES, INDEX, REG) \
-    {                                                      \
-        T              W = TWFUNC(TWIDDLES, INDEX);        \
-        real_type_t<T> TR, TI;                             \
-        TR    = (W.x * REG.x) - (W.y * REG.y);             \
-        TI    = (W.y * REG.x) + (W.x * REG.y);             \
-        REG.x = TR;                                        \
-        REG.y = TI;                                        \
+// Value of the transpose kernels' TWL template parameter selecting
+// TWLsincos instead of a TWLstep table lookup
+constexpr int TWL_SINCOS = -1;
+
+// Large twiddle exp(-2*pi*i*u/N), 0 <= u < N, computed in-kernel instead of
+// read from a TwiddleTableLarge.  The angle is reduced to [-1, 1] half-turns
+// in double before sincospi, so the result stays within about 2 ulp of the
+// exact twiddle in the working precision for any N.  Chaining k table levels
+// instead accumulates roughly k rounding errors, one per complex multiply.
+template <typename T>
+__device__ T TWLsincos(size_t N, size_t u)
+{
+    // -2u/N half-turns, folded into [-1, 1]
+    double x = (2 * u > N) ? 2.0 * (N - u) / N : -2.0 * u / N;
+    if(std::is_same<real_type_t<T>, double>::value)
+    {
+        double s, c;
+        sincospi(x, &s, &c);
+        return lib_make_vector2<T>(c, s);
+    }
+    else
+    {
+        float s, c;
+        sincospif(static_cast<float>(x), &s, &c);
+        return lib_make_vector2<T>(c, s);
+    }
+}
+
+#define TWIDDLE_STEP_MUL_FWD(TWFUNC, TWIDDLES, INDEX, REG)     \
+    {                                                          \
+        compute_t<T>              W = TWFUNC(TWIDDLES, INDEX); \
+        real_type_t<compute_t<T>> TR, TI;                      \
+        TR    = (W.x * REG.x) - (W.y * REG.y);                 \
+        TI    = (W.y * REG.x) + (W.x * REG.y);                 \
+        REG.x = TR;                                            \
+        REG.y = TI;                                            \
     }
 
-#define TWIDDLE_STEP_MUL_INV(TWFUNC, TWIDDLES, INDEX, REG) \
-    {                                                      \
-        T              W = TWFUNC(TWIDDLES, INDEX);        \
-        real_type_t<T> TR, TI;                             \
-        TR    = (W.x * REG.x) + (W.y * REG.y);             \
-        TI    = -(W.y * REG.x) + (W.x * REG.y);            \
-        REG.x = TR;                                        \
-        REG.y = TI;                                        \
+#define TWIDDLE_STEP_MUL_INV(TWFUNC, TWIDDLES, INDEX, REG)     \
+    {                                                          \
+        compute_t<T>              W = TWFUNC(TWIDDLES, INDEX); \
+        real_type_t<compute_t<T>> TR, TI;                      \
+        TR    = (W.x * REG.x) + (W.y * REG.y);                 \
+        TI    = -(W.y * REG.x) + (W.x * REG.y);                \
+        REG.x = TR;                                            \
+        REG.y = TI;                                            \
     }
 
 #endif // COMMON_H
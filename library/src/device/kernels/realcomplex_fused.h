@@ -0,0 +1,161 @@
+/******************************************************************************
+* Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*******************************************************************************/
+
+#ifndef REALCOMPLEX_FUSED_H
+#define REALCOMPLEX_FUSED_H
+
+#include "array_format.h"
+#include "common.h"
+
+// Even-length real pre/post-processing done by the generated Stockham
+// kernels with it fused in (CS_KERNEL_STOCKHAM_R_TO_CMPLX and
+// CS_KERNEL_CMPLX_TO_R_STOCKHAM).  The half-length complex row is in
+// LDS as planar reals, and the 'wpt' threads of the transform each take
+// the pairs of elements (p, half_N - p) for p = me, me + wpt, ...  The
+// arithmetic is that of the standalone R_TO_CMPLX and CMPLX_TO_R
+// kernels.  Threads with 'rw' clear only take part in the barriers
+// around these calls.  The Hermitian side is in format TH, interleaved
+// or planar, and is addressed from its offset for the transform.  The
+// row is of type T and the arithmetic is done in compute_t<T>.
+
+// Hermitian element i of input, in the compute type
+template <typename T, typename TH>
+__device__ inline compute_t<T> read_hermitian(array_in_t<TH> input, const size_t i)
+{
+    return lib_convert_vector2<compute_t<T>>(Handler<TH>::read(input, i));
+}
+
+// Write the half_N + 1 Hermitian outputs of the real forward transform
+// whose half-length FFT is in rowRe/rowIm
+template <typename T, typename TH>
+__device__ inline void real_post_process_lds(const size_t          half_N,
+                                             const unsigned int    wpt,
+                                             const unsigned int    me,
+                                             const unsigned int    rw,
+                                             const real_type_t<T>* rowRe,
+                                             const real_type_t<T>* rowIm,
+                                             array_out_t<TH>       output,
+                                             const size_t          offset,
+                                             const size_t          stride,
+                                             const compute_t<T>*   twiddles)
+{
+    if(!rw)
+        return;
+
+    const size_t quarter_N = (half_N + 1) / 2;
+    for(size_t idx_p = me; idx_p < quarter_N; idx_p += wpt)
+    {
+        if(idx_p == 0)
+        {
+            Handler<TH>::write(
+                output, offset + half_N * stride, lib_make_vector2<T>(rowRe[0] - rowIm[0], 0));
+            Handler<TH>::write(output, offset, lib_make_vector2<T>(rowRe[0] + rowIm[0], 0));
+
+            if(half_N % 2 == 0)
+            {
+                Handler<TH>::write(output,
+                                   offset + quarter_N * stride,
+                                   lib_make_vector2<T>(rowRe[quarter_N], -rowIm[quarter_N]));
+            }
+        }
+        else
+        {
+            const size_t idx_q = half_N - idx_p;
+
+            const compute_t<T> p = lib_make_vector2<compute_t<T>>(rowRe[idx_p], rowIm[idx_p]);
+            const compute_t<T> q = lib_make_vector2<compute_t<T>>(rowRe[idx_q], rowIm[idx_q]);
+            const compute_t<T> u = 0.5 * (p + q);
+            const compute_t<T> v = 0.5 * (p - q);
+
+            const compute_t<T> twd_p = twiddles[idx_p];
+            // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
+
+            Handler<TH>::write(output,
+                               offset + idx_p * stride,
+                               lib_make_vector2<T>(u.x + v.x * twd_p.y + u.y * twd_p.x,
+                                                   v.y + u.y * twd_p.y - v.x * twd_p.x));
+            Handler<TH>::write(output,
+                               offset + idx_q * stride,
+                               lib_make_vector2<T>(u.x - v.x * twd_p.y - u.y * twd_p.x,
+                                                   -v.y + u.y * twd_p.y - v.x * twd_p.x));
+        }
+    }
+}
+
+// Read the half_N + 1 Hermitian inputs of a real inverse transform
+// into rowRe/rowIm, as the half-length row to inverse FFT
+template <typename T, typename TH>
+__device__ inline void real_pre_process_lds(const size_t        half_N,
+                                            const unsigned int  wpt,
+                                            const unsigned int  me,
+                                            const unsigned int  rw,
+                                            array_in_t<TH>      input,
+                                            const size_t        offset,
+                                            const size_t        stride,
+                                            real_type_t<T>*     rowRe,
+                                            real_type_t<T>*     rowIm,
+                                            const compute_t<T>* twiddles)
+{
+    if(!rw)
+        return;
+
+    const size_t quarter_N = (half_N + 1) / 2;
+    for(size_t idx_p = me; idx_p < quarter_N; idx_p += wpt)
+    {
+        if(idx_p == 0)
+        {
+            // NB: multi-dimensional transforms may have non-zero
+            // imaginary part at index 0 or at the Nyquist frequency.
+            const compute_t<T> p = read_hermitian<T, TH>(input, offset);
+            const compute_t<T> q = read_hermitian<T, TH>(input, offset + half_N * stride);
+            rowRe[0]             = p.x - p.y + q.x + q.y;
+            rowIm[0]             = p.x + p.y - q.x + q.y;
+
+            if(half_N % 2 == 0)
+            {
+                const compute_t<T> r = read_hermitian<T, TH>(input, offset + quarter_N * stride);
+                rowRe[quarter_N]     = 2 * r.x;
+                rowIm[quarter_N]     = -2 * r.y;
+            }
+        }
+        else
+        {
+            const size_t idx_q = half_N - idx_p;
+
+            const compute_t<T> p = read_hermitian<T, TH>(input, offset + idx_p * stride);
+            const compute_t<T> q = read_hermitian<T, TH>(input, offset + idx_q * stride);
+            const compute_t<T> u = p + q;
+            const compute_t<T> v = p - q;
+
+            const compute_t<T> twd_p = twiddles[idx_p];
+            // NB: twd_q = -conj(twd_p);
+
+            rowRe[idx_p] = u.x + v.x * twd_p.y - u.y * twd_p.x;
+            rowIm[idx_p] = v.y + u.y * twd_p.y + v.x * twd_p.x;
+
+            rowRe[idx_q] = u.x - v.x * twd_p.y + u.y * twd_p.x;
+            rowIm[idx_q] = -v.y + u.y * twd_p.y + v.x * twd_p.x;
+        }
+    }
+}
+
+#endif // REALCOMPLEX_FUSED_H
@@ -61,6 +61,23 @@
                 TWIDDLE_STEP_MUL_INV(TWLstep4, twiddles_large, (gx + tx1) * (gy + ty1 + i), tmp); \
             }                                                                                     \
         }                                                                                         \
+        else if(TWL == TWL_SINCOS)                                                                \
+        {                                                                                         \
+            if(DIR == -1)                                                                         \
+            {                                                                                     \
+                TWIDDLE_STEP_MUL_FWD(TWLsincos<compute_t<T>>,                                     \
+                                     twiddles_large_len,                                          \
+                                     (gx + tx1) * (gy + ty1 + i),                                 \
+                                     tmp);                                                        \
+            }                                                                                     \
+            else                                                                                  \
+            {                                                                                     \
+                TWIDDLE_STEP_MUL_INV(TWLsincos<compute_t<T>>,                                     \
+                                     twiddles_large_len,                                          \
+                                     (gx + tx1) * (gy + ty1 + i),                                 \
+                                     tmp);                                                        \
+            }                                                                                     \
+        }                                                                                         \
     }                                                                                             \
                                                                                                   \
     shared[tx1][ty1 + i] = tmp; // the transpose taking place here
@@ -80,19 +97,20 @@ template <typename T,
           int    DIR,
           bool   ALL,
           bool   UNIT_STRIDE_0>
-__device__ void transpose_tile_device(const T_I*   input,
-                                      T_O*         output,
-                                      size_t       in_offset,
-                                      size_t       out_offset,
-                                      const size_t m,
-                                      const size_t n,
-                                      size_t       gx,
-                                      size_t       gy,
-                                      size_t       ld_in,
-                                      size_t       ld_out,
-                                      size_t       stride_0_in,
-                                      size_t       stride_0_out,
-                                      T*           twiddles_large)
+__device__ void transpose_tile_device(array_in_t<T_I>  input,
+                                      array_out_t<T_O> output,
+                                      size_t           in_offset,
+                                      size_t           out_offset,
+                                      const size_t     m,
+                                      const size_t     n,
+                                      size_t           gx,
+                                      size_t           gy,
+                                      size_t           ld_in,
+                                      size_t           ld_out,
+                                      size_t           stride_0_in,
+                                      size_t           stride_0_out,
+                                      compute_t<T>*    twiddles_large,
+                                      const size_t     twiddles_large_len)
 {
     __shared__ T shared[DIM_X][DIM_X];
 
@@ -194,12 +212,12 @@ template <typename T,
           bool   ALL,
           bool   UNIT_STRIDE_0,
           bool   DIAGONAL>
-__global__ void transpose_kernel2(const T_I* input,
-                                  T_O*       output,
-                                  T*         twiddles_large,
-                                  size_t*    lengths,
-                                  size_t*    stride_in,
-                                  size_t*    stride_out)
+__global__ void transpose_kernel2(array_in_t<T_I>  input,
+                                  array_out_t<T_O> output,
+                                  compute_t<T>*    twiddles_large,
+                                  size_t*          lengths,
+                                  size_t*          stride_in,
+                                  size_t*          stride_out)
 {
     size_t ld_in  = stride_in[1];
     size_t ld_out = stride_out[1];
@@ -244,7 +262,8 @@ __global__ void transpose_kernel2(const T_I* input,
             ld_out,
             stride_in[0],
             stride_out[0],
-            twiddles_large);
+            twiddles_large,
+            lengths[0] * lengths[1]);
     }
     else
     {
@@ -265,7 +284,8 @@ __global__ void transpose_kernel2(const T_I* input,
             ld_out,
             stride_in[0],
             stride_out[0],
-            twiddles_large);
+            twiddles_large,
+            lengths[0] * lengths[1]);
     }
 }
 
@@ -277,16 +297,16 @@ template <typename T,
           size_t DIM_Y,
           bool   ALL,
           bool   UNIT_STRIDE_0>
-__device__ void transpose_tile_device_scheme(const T_I*   input,
-                                             T_O*         output,
-                                             size_t       in_offset,
-                                             size_t       out_offset,
-                                             const size_t m,
-                                             const size_t n,
-                                             size_t       ld_in,
-                                             size_t       ld_out,
-                                             size_t       stride_0_in,
-                                             size_t       stride_0_out)
+__device__ void transpose_tile_device_scheme(array_in_t<T_I>  input,
+                                             array_out_t<T_O> output,
+                                             size_t           in_offset,
+                                             size_t           out_offset,
+                                             const size_t     m,
+                                             const size_t     n,
+                                             size_t           ld_in,
+                                             size_t           ld_out,
+                                             size_t           stride_0_in,
+                                             size_t           stride_0_out)
 {
     __shared__ T shared[DIM_X][DIM_X];
 
@@ -382,16 +402,16 @@ template <typename T,
           bool   ALL,
           bool   UNIT_STRIDE_0,
           bool   DIAGONAL>
-__global__ void transpose_kernel2_scheme(const T_I* input,
-                                         T_O*       output,
-                                         T*         twiddles_large,
-                                         size_t*    lengths,
-                                         size_t*    stride_in,
-                                         size_t*    stride_out,
-                                         size_t     ld_in,
-                                         size_t     ld_out,
-                                         size_t     m,
-                                         size_t     n)
+__global__ void transpose_kernel2_scheme(array_in_t<T_I>  input,
+                                         array_out_t<T_O> output,
+                                         compute_t<T>*    twiddles_large,
+                                         size_t*          lengths,
+                                         size_t*          stride_in,
+                                         size_t*          stride_out,
+                                         size_t           ld_in,
+                                         size_t           ld_out,
+                                         size_t           m,
+                                         size_t           n)
 {
     size_t iOffset = 0;
     size_t oOffset = 0;
@@ -113,6 +113,19 @@ void real2complex(const void* data_p, void* back_p)
                            input_distance,
                            (float2*)output_buffer,
                            output_distance);
+    else if(precision == rocfft_precision_half)
+        hipLaunchKernelGGL(real2complex_kernel<rocfft_half2>,
+                           grid,
+                           threads,
+                           0,
+                           rocfft_stream,
+                           input_size,
+                           input_stride,
+                           output_stride,
+                           (_Float16*)input_buffer,
+                           input_distance,
+                           (rocfft_half2*)output_buffer,
+                           output_distance);
     else
         hipLaunchKernelGGL(real2complex_kernel<double2>,
                            grid,
@@ -276,6 +289,19 @@ void complex2hermitian(const void* data_p, void* back_p)
                                input_distance,
                                (float2*)output_buffer,
                                output_distance);
+        else if(precision == rocfft_precision_half)
+            hipLaunchKernelGGL(complex2hermitian_kernel<rocfft_half2>,
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               input_size,
+                               input_stride,
+                               output_stride,
+                               (rocfft_half2*)input_buffer,
+                               input_distance,
+                               (rocfft_half2*)output_buffer,
+                               output_distance);
         else
             hipLaunchKernelGGL(complex2hermitian_kernel<double2>,
                                grid,
@@ -306,6 +332,20 @@ void complex2hermitian(const void* data_p, void* back_p)
                                (float*)data->bufOut[0],
                                (float*)data->bufOut[1],
                                output_distance);
+        else if(precision == rocfft_precision_half)
+            hipLaunchKernelGGL(complex2hermitian_kernel<rocfft_half2>,
+                               grid,
+                               threads,
+                               0,
+                               rocfft_stream,
+                               input_size,
+                               input_stride,
+                               output_stride,
+                               (rocfft_half2*)input_buffer,
+                               input_distance,
+                               (_Float16*)data->bufOut[0],
+                               (_Float16*)data->bufOut[1],
+                               output_distance);
         else
             hipLaunchKernelGGL(complex2hermitian_kernel<double2>,
                                grid,
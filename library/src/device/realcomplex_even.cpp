@@ -31,14 +31,73 @@
 // we find another solution for organizing the calling structure, we should be explicit with the
 // type.
 
+// Strided element access for the 1D kernels that allow any innermost
+// strides.  Strides and offsets are in elements of the buffer: complex
+// elements for interleaved data, and reals for planar data.  Reads return
+// the compute type.
+template <typename Tcomplex>
+struct strided_interleaved
+{
+    Tcomplex* ptr;
+    size_t    stride;
+
+    __device__ compute_t<Tcomplex> read(const size_t i) const
+    {
+        return lib_convert_vector2<compute_t<Tcomplex>>(ptr[i * stride]);
+    }
+    __device__ void write(const size_t i, const Tcomplex& val) const
+    {
+        ptr[i * stride] = val;
+    }
+    __device__ strided_interleaved shift(const size_t offset) const
+    {
+        return {ptr + offset, stride};
+    }
+};
+
+template <typename Tcomplex>
+struct strided_planar
+{
+    real_type_t<Tcomplex>* re;
+    real_type_t<Tcomplex>* im;
+    size_t                 stride;
+
+    __device__ compute_t<Tcomplex> read(const size_t i) const
+    {
+        compute_t<Tcomplex> val;
+        val.x = re[i * stride];
+        val.y = im[i * stride];
+        return val;
+    }
+    __device__ void write(const size_t i, const Tcomplex& val) const
+    {
+        re[i * stride] = val.x;
+        im[i * stride] = val.y;
+    }
+    __device__ strided_planar shift(const size_t offset) const
+    {
+        return {re + offset, im + offset, stride};
+    }
+};
+
+template <typename Tcomplex>
+__device__ inline Tcomplex make_complex(const real_type_t<Tcomplex> x,
+                                        const real_type_t<Tcomplex> y)
+{
+    Tcomplex val;
+    val.x = x;
+    val.y = y;
+    return val;
+}
+
 template <typename Tcomplex, bool Ndiv4>
-__device__ inline void post_process_interleaved(const size_t    idx_p,
-                                                const size_t    idx_q,
-                                                const size_t    half_N,
-                                                const size_t    quarter_N,
-                                                const Tcomplex* input,
-                                                Tcomplex*       output,
-                                                const Tcomplex* twiddles)
+__device__ inline void post_process_interleaved(const size_t               idx_p,
+                                                const size_t               idx_q,
+                                                const size_t               half_N,
+                                                const size_t               quarter_N,
+                                                const Tcomplex*            input,
+                                                Tcomplex*                  output,
+                                                const compute_t<Tcomplex>* twiddles)
 {
     if(idx_p == 0)
     {
@@ -55,12 +114,12 @@ __device__ inline void post_process_interleaved(const size_t    idx_p,
     }
     else
     {
-        const Tcomplex p = input[idx_p];
-        const Tcomplex q = input[idx_q];
-        const Tcomplex u = 0.5 * (p + q);
-        const Tcomplex v = 0.5 * (p - q);
+        const compute_t<Tcomplex> p = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_p]);
+        const compute_t<Tcomplex> q = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_q]);
+        const compute_t<Tcomplex> u = 0.5 * (p + q);
+        const compute_t<Tcomplex> v = 0.5 * (p - q);
 
-        const Tcomplex twd_p = twiddles[idx_p];
+        const compute_t<Tcomplex> twd_p = twiddles[idx_p];
         // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
         output[idx_p].x = u.x + v.x * twd_p.y + u.y * twd_p.x;
@@ -90,7 +149,7 @@ __global__ static void real_post_process_kernel_interleaved_1D(const size_t half
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -123,7 +182,7 @@ __global__ static void real_post_process_kernel_interleaved(const size_t half_N,
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -140,14 +199,14 @@ __global__ static void real_post_process_kernel_interleaved(const size_t half_N,
 }
 
 template <typename Tcomplex, bool Ndiv4>
-__device__ inline void post_process_planar(const size_t           idx_p,
-                                           const size_t           idx_q,
-                                           const size_t           half_N,
-                                           const size_t           quarter_N,
-                                           const Tcomplex*        input,
-                                           real_type_t<Tcomplex>* outputRe,
-                                           real_type_t<Tcomplex>* outputIm,
-                                           const Tcomplex*        twiddles)
+__device__ inline void post_process_planar(const size_t               idx_p,
+                                           const size_t               idx_q,
+                                           const size_t               half_N,
+                                           const size_t               quarter_N,
+                                           const Tcomplex*            input,
+                                           real_type_t<Tcomplex>*     outputRe,
+                                           real_type_t<Tcomplex>*     outputIm,
+                                           const compute_t<Tcomplex>* twiddles)
 {
     if(idx_p == 0)
     {
@@ -164,12 +223,12 @@ __device__ inline void post_process_planar(const size_t           idx_p,
     }
     else
     {
-        const Tcomplex p = input[idx_p];
-        const Tcomplex q = input[idx_q];
-        const Tcomplex u = 0.5 * (p + q);
-        const Tcomplex v = 0.5 * (p - q);
+        const compute_t<Tcomplex> p = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_p]);
+        const compute_t<Tcomplex> q = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_q]);
+        const compute_t<Tcomplex> u = 0.5 * (p + q);
+        const compute_t<Tcomplex> v = 0.5 * (p - q);
 
-        const Tcomplex twd_p = twiddles[idx_p];
+        const compute_t<Tcomplex> twd_p = twiddles[idx_p];
         // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
 
         outputRe[idx_p] = u.x + v.x * twd_p.y + u.y * twd_p.x;
@@ -197,7 +256,7 @@ __global__ static void real_post_process_kernel_planar_1D(const size_t half_N,
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -233,7 +292,7 @@ __global__ static void real_post_process_kernel_planar(const size_t half_N,
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -252,6 +311,151 @@ __global__ static void real_post_process_kernel_planar(const size_t half_N,
     }
 }
 
+// Strided version of r2c post-process kernel, 1D.  Either side may be
+// interleaved or planar with any innermost stride; a strided real input
+// is read as planar data.
+template <typename Tcomplex, bool Ndiv4, typename Tin, typename Tout>
+__global__ static void real_post_process_kernel_strided_1D(const size_t half_N,
+                                                           const Tin    input0,
+                                                           const size_t idist,
+                                                           const Tout   output0,
+                                                           const size_t odist,
+                                                           const void*  twiddles0)
+{
+    const size_t idx_p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const size_t idx_q = half_N - idx_p;
+
+    const auto quarter_N = (half_N + 1) / 2;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
+
+    if(idx_p < quarter_N)
+    {
+        // blockIdx.z gives the batch offset
+        const auto input  = input0.shift(blockIdx.z * idist);
+        const auto output = output0.shift(blockIdx.z * odist);
+
+        if(idx_p == 0)
+        {
+            const compute_t<Tcomplex> p = input.read(0);
+            output.write(half_N, make_complex<Tcomplex>(p.x - p.y, 0));
+            output.write(0, make_complex<Tcomplex>(p.x + p.y, 0));
+
+            if(Ndiv4)
+            {
+                const compute_t<Tcomplex> r = input.read(quarter_N);
+                output.write(quarter_N, make_complex<Tcomplex>(r.x, -r.y));
+            }
+        }
+        else
+        {
+            const compute_t<Tcomplex> p = input.read(idx_p);
+            const compute_t<Tcomplex> q = input.read(idx_q);
+            const compute_t<Tcomplex> u = 0.5 * (p + q);
+            const compute_t<Tcomplex> v = 0.5 * (p - q);
+
+            const compute_t<Tcomplex> twd_p = twiddles[idx_p];
+            // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
+
+            output.write(idx_p,
+                         make_complex<Tcomplex>(u.x + v.x * twd_p.y + u.y * twd_p.x,
+                                                v.y + u.y * twd_p.y - v.x * twd_p.x));
+            output.write(idx_q,
+                         make_complex<Tcomplex>(u.x - v.x * twd_p.y - u.y * twd_p.x,
+                                                -v.y + u.y * twd_p.y - v.x * twd_p.x));
+        }
+    }
+}
+
+// Launch the strided r2c post-process kernel for the node's array types
+template <typename Tcomplex, bool Ndiv4>
+static void real_post_process_strided_1D(const DeviceCallIn* data,
+                                         const dim3&         grid,
+                                         const dim3&         threads)
+{
+    typedef real_type_t<Tcomplex> Treal;
+
+    const auto& node   = *data->node;
+    const auto  half_N = node.length[0];
+
+    const strided_interleaved<Tcomplex> inI{(Tcomplex*)data->bufIn[0], node.inStride[0]};
+    const strided_planar<Tcomplex>      inP{
+        (Treal*)data->bufIn[0], (Treal*)data->bufIn[1], node.inStride[0]};
+    const strided_interleaved<Tcomplex> outI{(Tcomplex*)data->bufOut[0], node.outStride[0]};
+    const strided_planar<Tcomplex>      outP{
+        (Treal*)data->bufOut[0], (Treal*)data->bufOut[1], node.outStride[0]};
+
+    const bool planarIn  = node.inArrayType == rocfft_array_type_complex_planar;
+    const bool planarOut = node.outArrayType == rocfft_array_type_hermitian_planar;
+
+    const auto twiddles = node.twiddles.data();
+    const auto stream   = data->rocfft_stream;
+
+    if(planarIn && planarOut)
+        hipLaunchKernelGGL(
+            (real_post_process_kernel_strided_1D<Tcomplex,
+                                                 Ndiv4,
+                                                 strided_planar<Tcomplex>,
+                                                 strided_planar<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inP,
+            node.iDist,
+            outP,
+            node.oDist,
+            twiddles);
+    else if(planarIn)
+        hipLaunchKernelGGL(
+            (real_post_process_kernel_strided_1D<Tcomplex,
+                                                 Ndiv4,
+                                                 strided_planar<Tcomplex>,
+                                                 strided_interleaved<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inP,
+            node.iDist,
+            outI,
+            node.oDist,
+            twiddles);
+    else if(planarOut)
+        hipLaunchKernelGGL(
+            (real_post_process_kernel_strided_1D<Tcomplex,
+                                                 Ndiv4,
+                                                 strided_interleaved<Tcomplex>,
+                                                 strided_planar<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inI,
+            node.iDist,
+            outP,
+            node.oDist,
+            twiddles);
+    else
+        hipLaunchKernelGGL(
+            (real_post_process_kernel_strided_1D<Tcomplex,
+                                                 Ndiv4,
+                                                 strided_interleaved<Tcomplex>,
+                                                 strided_interleaved<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inI,
+            node.iDist,
+            outI,
+            node.oDist,
+            twiddles);
+}
+
 // Entrance function for r2c post-processing kernel
 void r2c_1d_post(const void* data_p, void*)
 {
@@ -267,6 +471,10 @@ void r2c_1d_post(const void* data_p, void*)
                                      &(real_post_process_kernel_interleaved_1D<double2, true>));
     kernelmap_interleaved_1D.emplace(std::make_tuple(rocfft_precision_double, false),
                                      &(real_post_process_kernel_interleaved_1D<double2, false>));
+    kernelmap_interleaved_1D.emplace(std::make_tuple(rocfft_precision_half, true),
+                                     &(real_post_process_kernel_interleaved_1D<rocfft_half2, true>));
+    kernelmap_interleaved_1D.emplace(std::make_tuple(rocfft_precision_half, false),
+                                     &(real_post_process_kernel_interleaved_1D<rocfft_half2, false>));
 
     // Map to interleaved kernels:
     std::map<std::tuple<rocfft_precision, bool>,
@@ -280,6 +488,10 @@ void r2c_1d_post(const void* data_p, void*)
                                   &(real_post_process_kernel_interleaved<double2, true>));
     kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_double, false),
                                   &(real_post_process_kernel_interleaved<double2, false>));
+    kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_half, true),
+                                  &(real_post_process_kernel_interleaved<rocfft_half2, true>));
+    kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_half, false),
+                                  &(real_post_process_kernel_interleaved<rocfft_half2, false>));
 
     // Map to planar 1D kernels:
     std::map<std::tuple<rocfft_precision, bool>,
@@ -293,6 +505,10 @@ void r2c_1d_post(const void* data_p, void*)
                                 &(real_post_process_kernel_planar_1D<double2, true>));
     kernelmap_planar_1D.emplace(std::make_tuple(rocfft_precision_double, false),
                                 &(real_post_process_kernel_planar_1D<double2, false>));
+    kernelmap_planar_1D.emplace(std::make_tuple(rocfft_precision_half, true),
+                                &(real_post_process_kernel_planar_1D<rocfft_half2, true>));
+    kernelmap_planar_1D.emplace(std::make_tuple(rocfft_precision_half, false),
+                                &(real_post_process_kernel_planar_1D<rocfft_half2, false>));
 
     // Map to planar kernels:
     std::map<std::tuple<rocfft_precision, bool>,
@@ -306,6 +522,10 @@ void r2c_1d_post(const void* data_p, void*)
                              &(real_post_process_kernel_planar<double2, true>));
     kernelmap_planar.emplace(std::make_tuple(rocfft_precision_double, false),
                              &(real_post_process_kernel_planar<double2, false>));
+    kernelmap_planar.emplace(std::make_tuple(rocfft_precision_half, true),
+                             &(real_post_process_kernel_planar<rocfft_half2, true>));
+    kernelmap_planar.emplace(std::make_tuple(rocfft_precision_half, false),
+                             &(real_post_process_kernel_planar<rocfft_half2, false>));
 
     const DeviceCallIn* data = (DeviceCallIn*)data_p;
 
@@ -337,9 +557,30 @@ void r2c_1d_post(const void* data_p, void*)
     const dim3 grid(blocks, high_dimension, batch);
     const dim3 threads(block_size, 1, 1);
 
+    // Non-unit innermost strides take the strided kernels
+    const bool strided = onedim && (data->node->inStride[0] != 1 || data->node->outStride[0] != 1);
+
     try
     {
-        if(onedim)
+        if(strided)
+        {
+            switch(data->node->precision)
+            {
+            case rocfft_precision_single:
+                Ndiv4 ? real_post_process_strided_1D<float2, true>(data, grid, threads)
+                      : real_post_process_strided_1D<float2, false>(data, grid, threads);
+                break;
+            case rocfft_precision_double:
+                Ndiv4 ? real_post_process_strided_1D<double2, true>(data, grid, threads)
+                      : real_post_process_strided_1D<double2, false>(data, grid, threads);
+                break;
+            case rocfft_precision_half:
+                Ndiv4 ? real_post_process_strided_1D<rocfft_half2, true>(data, grid, threads)
+                      : real_post_process_strided_1D<rocfft_half2, false>(data, grid, threads);
+                break;
+            }
+        }
+        else if(onedim)
         {
             if(data->node->outArrayType == rocfft_array_type_hermitian_interleaved)
             {
@@ -434,7 +675,7 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -450,8 +691,8 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
             // NB: multi-dimensional transforms may have non-zero
             // imaginary part at index 0 or at the Nyquist frequency.
 
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
+            const compute_t<Tcomplex> p = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_p]);
+            const compute_t<Tcomplex> q = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_q]);
             output[idx_p].x  = p.x - p.y + q.x + q.y;
             output[idx_p].y  = p.x + p.y - q.x + q.y;
 
@@ -463,13 +704,13 @@ __global__ static void real_pre_process_kernel(const size_t half_N,
         }
         else
         {
-            const Tcomplex p = input[idx_p];
-            const Tcomplex q = input[idx_q];
+            const compute_t<Tcomplex> p = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_p]);
+            const compute_t<Tcomplex> q = lib_convert_vector2<compute_t<Tcomplex>>(input[idx_q]);
 
-            const Tcomplex u = p + q;
-            const Tcomplex v = p - q;
+            const compute_t<Tcomplex> u = p + q;
+            const compute_t<Tcomplex> v = p - q;
 
-            const Tcomplex twd_p = twiddles[idx_p];
+            const compute_t<Tcomplex> twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
             output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
@@ -497,7 +738,7 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
     const size_t idx_q = half_N - idx_p;
 
     const auto quarter_N = (half_N + 1) / 2;
-    const auto twiddles  = (Tcomplex*)twiddles0;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
 
     if(idx_p < quarter_N)
     {
@@ -516,7 +757,7 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
             // NB: multi-dimensional transforms may have non-zero
             // imaginary part at index 0 or at the Nyquist frequency.
 
-            Tcomplex p, q;
+            compute_t<Tcomplex> p, q;
             p.x             = inputRe[idx_p];
             p.y             = inputIm[idx_p];
             q.x             = inputRe[idx_q];
@@ -532,16 +773,16 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
         }
         else
         {
-            Tcomplex p, q;
+            compute_t<Tcomplex> p, q;
             p.x = inputRe[idx_p];
             p.y = inputIm[idx_p];
             q.x = inputRe[idx_q];
             q.y = inputIm[idx_q];
 
-            const Tcomplex u = p + q;
-            const Tcomplex v = p - q;
+            const compute_t<Tcomplex> u = p + q;
+            const compute_t<Tcomplex> v = p - q;
 
-            const Tcomplex twd_p = twiddles[idx_p];
+            const compute_t<Tcomplex> twd_p = twiddles[idx_p];
             // NB: twd_q = -conj(twd_p);
 
             output[idx_p].x = u.x + v.x * twd_p.y - u.y * twd_p.x;
@@ -553,6 +794,151 @@ __global__ static void real_pre_process_kernel_planar(const size_t      half_N,
     }
 }
 
+// Strided version of c2r pre-process kernel, 1D.  Either side may be
+// interleaved or planar with any innermost stride; a strided real output
+// is written as planar data.
+template <typename Tcomplex, bool Ndiv4, typename Tin, typename Tout>
+__global__ static void real_pre_process_kernel_strided_1D(const size_t half_N,
+                                                          const Tin    input0,
+                                                          const size_t idist,
+                                                          const Tout   output0,
+                                                          const size_t odist,
+                                                          const void*  twiddles0)
+{
+    const size_t idx_p = blockIdx.x * blockDim.x + threadIdx.x;
+    const size_t idx_q = half_N - idx_p;
+
+    const auto quarter_N = (half_N + 1) / 2;
+    const auto twiddles  = (compute_t<Tcomplex>*)twiddles0;
+
+    if(idx_p < quarter_N)
+    {
+        // blockIdx.z gives the batch offset
+        const auto input  = input0.shift(blockIdx.z * idist);
+        const auto output = output0.shift(blockIdx.z * odist);
+
+        const compute_t<Tcomplex> p = input.read(idx_p);
+        const compute_t<Tcomplex> q = input.read(idx_q);
+
+        if(idx_p == 0)
+        {
+            output.write(idx_p,
+                         make_complex<Tcomplex>(p.x - p.y + q.x + q.y, p.x + p.y - q.x + q.y));
+
+            if(Ndiv4)
+            {
+                const compute_t<Tcomplex> r = input.read(quarter_N);
+                output.write(quarter_N, make_complex<Tcomplex>(2.0 * r.x, -2.0 * r.y));
+            }
+        }
+        else
+        {
+            const compute_t<Tcomplex> u = p + q;
+            const compute_t<Tcomplex> v = p - q;
+
+            const compute_t<Tcomplex> twd_p = twiddles[idx_p];
+            // NB: twd_q = -conj(twd_p);
+
+            output.write(idx_p,
+                         make_complex<Tcomplex>(u.x + v.x * twd_p.y - u.y * twd_p.x,
+                                                v.y + u.y * twd_p.y + v.x * twd_p.x));
+            output.write(idx_q,
+                         make_complex<Tcomplex>(u.x - v.x * twd_p.y + u.y * twd_p.x,
+                                                -v.y + u.y * twd_p.y + v.x * twd_p.x));
+        }
+    }
+}
+
+// Launch the strided c2r pre-process kernel for the node's array types
+template <typename Tcomplex, bool Ndiv4>
+static void real_pre_process_strided_1D(const DeviceCallIn* data,
+                                        const dim3&         grid,
+                                        const dim3&         threads)
+{
+    typedef real_type_t<Tcomplex> Treal;
+
+    const auto& node   = *data->node;
+    const auto  half_N = node.length[0];
+
+    const strided_interleaved<Tcomplex> inI{(Tcomplex*)data->bufIn[0], node.inStride[0]};
+    const strided_planar<Tcomplex>      inP{
+        (Treal*)data->bufIn[0], (Treal*)data->bufIn[1], node.inStride[0]};
+    const strided_interleaved<Tcomplex> outI{(Tcomplex*)data->bufOut[0], node.outStride[0]};
+    const strided_planar<Tcomplex>      outP{
+        (Treal*)data->bufOut[0], (Treal*)data->bufOut[1], node.outStride[0]};
+
+    const bool planarIn  = node.inArrayType == rocfft_array_type_hermitian_planar;
+    const bool planarOut = node.outArrayType == rocfft_array_type_complex_planar;
+
+    const auto twiddles = node.twiddles.data();
+    const auto stream   = data->rocfft_stream;
+
+    if(planarIn && planarOut)
+        hipLaunchKernelGGL(
+            (real_pre_process_kernel_strided_1D<Tcomplex,
+                                                Ndiv4,
+                                                strided_planar<Tcomplex>,
+                                                strided_planar<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inP,
+            node.iDist,
+            outP,
+            node.oDist,
+            twiddles);
+    else if(planarIn)
+        hipLaunchKernelGGL(
+            (real_pre_process_kernel_strided_1D<Tcomplex,
+                                                Ndiv4,
+                                                strided_planar<Tcomplex>,
+                                                strided_interleaved<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inP,
+            node.iDist,
+            outI,
+            node.oDist,
+            twiddles);
+    else if(planarOut)
+        hipLaunchKernelGGL(
+            (real_pre_process_kernel_strided_1D<Tcomplex,
+                                                Ndiv4,
+                                                strided_interleaved<Tcomplex>,
+                                                strided_planar<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inI,
+            node.iDist,
+            outP,
+            node.oDist,
+            twiddles);
+    else
+        hipLaunchKernelGGL(
+            (real_pre_process_kernel_strided_1D<Tcomplex,
+                                                Ndiv4,
+                                                strided_interleaved<Tcomplex>,
+                                                strided_interleaved<Tcomplex>>),
+            grid,
+            threads,
+            0,
+            stream,
+            half_N,
+            inI,
+            node.iDist,
+            outI,
+            node.oDist,
+            twiddles);
+}
+
 // Entrance function for c2r pre-processing kernel
 void c2r_1d_pre(const void* data_p, void*)
 {
@@ -567,6 +953,10 @@ void c2r_1d_pre(const void* data_p, void*)
                                   &(real_pre_process_kernel<double2, true>));
     kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_double, false),
                                   &(real_pre_process_kernel<double2, false>));
+    kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_half, true),
+                                  &(real_pre_process_kernel<rocfft_half2, true>));
+    kernelmap_interleaved.emplace(std::make_tuple(rocfft_precision_half, false),
+                                  &(real_pre_process_kernel<rocfft_half2, false>));
 
     // map to planar kernels
     std::map<std::tuple<rocfft_precision, bool>,
@@ -580,6 +970,10 @@ void c2r_1d_pre(const void* data_p, void*)
                              &(real_pre_process_kernel_planar<double2, true>));
     kernelmap_planar.emplace(std::make_tuple(rocfft_precision_double, false),
                              &(real_pre_process_kernel_planar<double2, false>));
+    kernelmap_planar.emplace(std::make_tuple(rocfft_precision_half, true),
+                             &(real_pre_process_kernel_planar<rocfft_half2, true>));
+    kernelmap_planar.emplace(std::make_tuple(rocfft_precision_half, false),
+                             &(real_pre_process_kernel_planar<rocfft_half2, false>));
 
     const DeviceCallIn* data = (DeviceCallIn*)data_p;
 
@@ -615,9 +1009,31 @@ void c2r_1d_pre(const void* data_p, void*)
     const size_t idist1D = istride;
     const size_t odist1D = ostride;
 
+    // Non-unit innermost strides take the strided kernels
+    const bool strided = high_dimension == 1
+                         && (data->node->inStride[0] != 1 || data->node->outStride[0] != 1);
+
     try
     {
-        if(data->node->inArrayType == rocfft_array_type_hermitian_interleaved)
+        if(strided)
+        {
+            switch(data->node->precision)
+            {
+            case rocfft_precision_single:
+                Ndiv4 ? real_pre_process_strided_1D<float2, true>(data, grid, threads)
+                      : real_pre_process_strided_1D<float2, false>(data, grid, threads);
+                break;
+            case rocfft_precision_double:
+                Ndiv4 ? real_pre_process_strided_1D<double2, true>(data, grid, threads)
+                      : real_pre_process_strided_1D<double2, false>(data, grid, threads);
+                break;
+            case rocfft_precision_half:
+                Ndiv4 ? real_pre_process_strided_1D<rocfft_half2, true>(data, grid, threads)
+                      : real_pre_process_strided_1D<rocfft_half2, false>(data, grid, threads);
+                break;
+            }
+        }
+        else if(data->node->inArrayType == rocfft_array_type_hermitian_interleaved)
         {
             hipLaunchKernelGGL(kernelmap_interleaved.at(params),
                                grid,
@@ -40,27 +40,28 @@ __device__ size_t output_row_base(size_t        dim,
 // R2C post-process kernel, 2D and 3D, transposed output.
 // lengths counts in complex elements
 template <typename T, typename T_I, typename T_O, size_t DIM_X, size_t DIM_Y>
-__global__ static void real_post_process_kernel_transpose(size_t        dim,
-                                                          const T_I*    input0,
-                                                          size_t        idist,
-                                                          T_O*          output0,
-                                                          size_t        odist,
-                                                          const void*   twiddles0,
-                                                          const size_t* lengths,
-                                                          const size_t* inStride,
-                                                          const size_t* outStride)
+__global__ static void real_post_process_kernel_transpose(size_t           dim,
+                                                          array_in_t<T_I>  input0,
+                                                          size_t           idist,
+                                                          array_out_t<T_O> output0,
+                                                          size_t           odist,
+                                                          const void*      twiddles0,
+                                                          const size_t*    lengths,
+                                                          const size_t*    inStride,
+                                                          const size_t*    outStride)
 {
     size_t idist1D            = inStride[1];
     size_t odist1D            = outStride[1];
     size_t input_batch_start  = idist * blockIdx.z;
     size_t output_batch_start = odist * blockIdx.z;
-    auto   twiddles           = static_cast<const T*>(twiddles0);
+    auto   twiddles           = static_cast<const compute_t<T>*>(twiddles0);
 
     // allocate 2 tiles so we can butterfly the values together.
     // left tile grabs values from towards the beginnings of the rows
-    // right tile grabs values from towards the ends
-    __shared__ T leftTile[DIM_X][DIM_Y];
-    __shared__ T rightTile[DIM_X][DIM_Y];
+    // right tile grabs values from towards the ends.  tiles hold the
+    // compute type, so half precision is butterflied in fp32.
+    __shared__ compute_t<T> leftTile[DIM_X][DIM_Y];
+    __shared__ compute_t<T> rightTile[DIM_X][DIM_Y];
 
     // take fastest dimension and partition it into lengths that will go into each tile
     const size_t len0 = lengths[0];
@@ -98,12 +99,12 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
     {
         auto v                     = Handler<T_I>::read(input0,
                                     input_batch_start + input_row_base + left_col_start + lds_col);
-        leftTile[lds_col][lds_row] = v;
+        leftTile[lds_col][lds_row] = lib_convert_vector2<compute_t<T>>(v);
 
         auto v2                     = Handler<T_I>::read(input0,
                                      input_batch_start + input_row_base
                                          + (len0 - (left_col_start + cols_to_read - 1)) + lds_col);
-        rightTile[lds_col][lds_row] = v2;
+        rightTile[lds_col][lds_row] = lib_convert_vector2<compute_t<T>>(v2);
     }
 
     // handle first + middle element (if there is a middle)
@@ -158,10 +159,10 @@ __global__ static void real_post_process_kernel_transpose(size_t        dim,
     {
         size_t col = blockIdx.x * tile_size + 1 + threadIdx.x;
 
-        const T p = leftTile[lds_col][lds_row];
-        const T q = rightTile[cols_to_read - lds_col - 1][lds_row];
-        const T u = 0.5 * (p + q);
-        const T v = 0.5 * (p - q);
+        const compute_t<T> p = leftTile[lds_col][lds_row];
+        const compute_t<T> q = rightTile[cols_to_read - lds_col - 1][lds_row];
+        const compute_t<T> u = 0.5 * (p + q);
+        const compute_t<T> v = 0.5 * (p - q);
 
         auto twd_p = twiddles[col];
         // NB: twd_q = -conj(twd_p) = (-twd_p.x, twd_p.y);
@@ -192,7 +193,6 @@ void r2c_1d_post_transpose(const void* data_p, void*)
 
     const void* bufIn0  = data->bufIn[0];
     void*       bufOut0 = data->bufOut[0];
-    void*       bufOut1 = data->bufOut[1];
 
     const size_t batch = data->node->batch;
 
@@ -232,7 +232,7 @@ void r2c_1d_post_transpose(const void* data_p, void*)
     {
         if(is_complex_planar(data->node->outArrayType))
         {
-            cmplx_planar_device_buffer<float2> out_planar(bufOut0, bufOut1);
+            const auto out_planar = array_arg<cmplx_float_planar>::make(data->bufOut);
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(real_post_process_kernel_transpose<cmplx_float,
                                                                    cmplx_float,
@@ -246,7 +246,7 @@ void r2c_1d_post_transpose(const void* data_p, void*)
                 dim,
                 static_cast<const cmplx_float*>(bufIn0),
                 idist,
-                out_planar.devicePtr(),
+                out_planar,
                 odist,
                 data->node->twiddles.data(),
                 data->node->devKernArg.data(),
@@ -275,11 +275,58 @@ void r2c_1d_post_transpose(const void* data_p, void*)
                                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
         }
     }
+    else if(data->node->precision == rocfft_precision_half)
+    {
+        if(is_complex_planar(data->node->outArrayType))
+        {
+            const auto out_planar = array_arg<cmplx_half_planar>::make(data->bufOut);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(real_post_process_kernel_transpose<cmplx_half,
+                                                                   cmplx_half,
+                                                                   cmplx_half_planar,
+                                                                   16,
+                                                                   16>),
+                grid,
+                threads,
+                0,
+                data->rocfft_stream,
+                dim,
+                static_cast<const cmplx_half*>(bufIn0),
+                idist,
+                out_planar,
+                odist,
+                data->node->twiddles.data(),
+                data->node->devKernArg.data(),
+                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
+        }
+        else
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(real_post_process_kernel_transpose<cmplx_half,
+                                                                                  cmplx_half,
+                                                                                  cmplx_half,
+                                                                                  16,
+                                                                                  16>),
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               dim,
+                               static_cast<const cmplx_half*>(bufIn0),
+                               idist,
+                               static_cast<cmplx_half*>(bufOut0),
+                               odist,
+                               data->node->twiddles.data(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
+        }
+    }
     else
     {
         if(is_complex_planar(data->node->outArrayType))
         {
-            cmplx_planar_device_buffer<double2> out_planar(bufOut0, bufOut1);
+            const auto out_planar = array_arg<cmplx_double_planar>::make(data->bufOut);
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(real_post_process_kernel_transpose<cmplx_double,
                                                                    cmplx_double,
@@ -293,7 +340,7 @@ void r2c_1d_post_transpose(const void* data_p, void*)
                 dim,
                 static_cast<const cmplx_double*>(bufIn0),
                 idist,
-                out_planar.devicePtr(),
+                out_planar,
                 odist,
                 data->node->twiddles.data(),
                 data->node->devKernArg.data(),
@@ -327,27 +374,28 @@ void r2c_1d_post_transpose(const void* data_p, void*)
 // C2R pre-process kernel, 2D and 3D, transposed input.
 // lengths counts in complex elements
 template <typename T, typename T_I, typename T_O, size_t DIM_X, size_t DIM_Y>
-__global__ static void transpose_real_pre_process_kernel(size_t        dim,
-                                                         const T_I*    input0,
-                                                         size_t        idist,
-                                                         T_O*          output0,
-                                                         size_t        odist,
-                                                         const void*   twiddles0,
-                                                         const size_t* lengths,
-                                                         const size_t* inStride,
-                                                         const size_t* outStride)
+__global__ static void transpose_real_pre_process_kernel(size_t           dim,
+                                                         array_in_t<T_I>  input0,
+                                                         size_t           idist,
+                                                         array_out_t<T_O> output0,
+                                                         size_t           odist,
+                                                         const void*      twiddles0,
+                                                         const size_t*    lengths,
+                                                         const size_t*    inStride,
+                                                         const size_t*    outStride)
 {
     size_t idist1D            = dim == 2 ? inStride[1] : inStride[2];
     size_t odist1D            = outStride[1];
     size_t input_batch_start  = idist * blockIdx.z;
     size_t output_batch_start = odist * blockIdx.z;
-    auto   twiddles           = static_cast<const T*>(twiddles0);
+    auto   twiddles           = static_cast<const compute_t<T>*>(twiddles0);
 
     // allocate 2 tiles so we can butterfly the values together.
     // top tile grabs values from towards the tops of the columns
-    // bottom tile grabs values from towards the bottoms
-    __shared__ T topTile[DIM_X][DIM_Y];
-    __shared__ T bottomTile[DIM_X][DIM_Y];
+    // bottom tile grabs values from towards the bottoms.  tiles hold the
+    // compute type, so half precision is butterflied in fp32.
+    __shared__ compute_t<T> topTile[DIM_X][DIM_Y];
+    __shared__ compute_t<T> bottomTile[DIM_X][DIM_Y];
 
     // take middle dimension and partition it into lengths that will go into each tile
     // note that last row effectively gets thrown away
@@ -387,7 +435,7 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
         auto v                    = Handler<T_I>::read(input0,
                                     input_batch_start + input_col_base + lds_col
                                         + (top_row_start + lds_row) * idist1D);
-        topTile[lds_col][lds_row] = v;
+        topTile[lds_col][lds_row] = lib_convert_vector2<compute_t<T>>(v);
 
         auto v2 = Handler<T_I>::read(input0,
                                      input_batch_start + input_col_base + lds_col
@@ -395,7 +443,7 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
         // TODO: reads values-to-butterfly into same col/row in LDS.
         // r2c kernel writes LDS in same order as input.  these
         // probably should be made consistent
-        bottomTile[lds_col][lds_row] = v2;
+        bottomTile[lds_col][lds_row] = lib_convert_vector2<compute_t<T>>(v2);
     }
 
     // handle first + last + middle element (if there is a middle)
@@ -442,10 +490,10 @@ __global__ static void transpose_real_pre_process_kernel(size_t        dim,
     {
         size_t col = col_start + lds_col;
 
-        const T p = topTile[lds_col][lds_row];
-        const T q = bottomTile[lds_col][lds_row];
-        const T u = p + q;
-        const T v = p - q;
+        const compute_t<T> p = topTile[lds_col][lds_row];
+        const compute_t<T> q = bottomTile[lds_col][lds_row];
+        const compute_t<T> u = p + q;
+        const compute_t<T> v = p - q;
 
         auto twd_p = twiddles[top_row_start + lds_row];
 
@@ -478,7 +526,6 @@ void transpose_c2r_1d_pre(const void* data_p, void*)
     const size_t odist = data->node->oDist;
 
     const void* bufIn0  = data->bufIn[0];
-    const void* bufIn1  = data->bufIn[1];
     void*       bufOut0 = data->bufOut[0];
 
     const size_t batch = data->node->batch;
@@ -530,7 +577,7 @@ void transpose_c2r_1d_pre(const void* data_p, void*)
     {
         if(is_complex_planar(data->node->inArrayType))
         {
-            cmplx_planar_device_buffer<float2> in_planar(bufIn0, bufIn1);
+            const auto in_planar = array_arg<cmplx_float_planar>::make(data->bufIn);
             hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_real_pre_process_kernel<cmplx_float,
                                                                                  cmplx_float_planar,
                                                                                  cmplx_float,
@@ -541,7 +588,7 @@ void transpose_c2r_1d_pre(const void* data_p, void*)
                                0,
                                data->rocfft_stream,
                                dim,
-                               in_planar.devicePtr(),
+                               in_planar,
                                idist,
                                static_cast<cmplx_float*>(bufOut0),
                                odist,
@@ -572,11 +619,57 @@ void transpose_c2r_1d_pre(const void* data_p, void*)
                                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
         }
     }
+    else if(data->node->precision == rocfft_precision_half)
+    {
+        if(is_complex_planar(data->node->inArrayType))
+        {
+            const auto in_planar = array_arg<cmplx_half_planar>::make(data->bufIn);
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_real_pre_process_kernel<cmplx_half,
+                                                                                 cmplx_half_planar,
+                                                                                 cmplx_half,
+                                                                                 32,
+                                                                                 16>),
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               dim,
+                               in_planar,
+                               idist,
+                               static_cast<cmplx_half*>(bufOut0),
+                               odist,
+                               data->node->twiddles.data(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
+        }
+        else
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(transpose_real_pre_process_kernel<cmplx_half,
+                                                                                 cmplx_half,
+                                                                                 cmplx_half,
+                                                                                 32,
+                                                                                 16>),
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               dim,
+                               static_cast<const cmplx_half*>(bufIn0),
+                               idist,
+                               static_cast<cmplx_half*>(bufOut0),
+                               odist,
+                               data->node->twiddles.data(),
+                               data->node->devKernArg.data(),
+                               data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+                               data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH);
+        }
+    }
     else
     {
         if(is_complex_planar(data->node->inArrayType))
         {
-            cmplx_planar_device_buffer<double2> in_planar(bufIn0, bufIn1);
+            const auto in_planar = array_arg<cmplx_double_planar>::make(data->bufIn);
             hipLaunchKernelGGL(
                 HIP_KERNEL_NAME(transpose_real_pre_process_kernel<cmplx_double,
                                                                   cmplx_double_planar,
@@ -588,7 +681,7 @@ void transpose_c2r_1d_pre(const void* data_p, void*)
                 0,
                 data->rocfft_stream,
                 dim,
-                in_planar.devicePtr(),
+                in_planar,
                 idist,
                 static_cast<cmplx_double*>(bufOut0),
                 odist,
@@ -26,6 +26,36 @@
 #include <iostream>
 #include <numeric>
 
+/// Offsets of the row of a pair kernel given by blockIdx.y, over the dimensions of the
+/// node above the first.
+__device__ inline void pair_row_offsets(const size_t  dim,
+                                        const size_t* lengths,
+                                        const size_t* stride_in,
+                                        const size_t* stride_out,
+                                        size_t&       iOffset,
+                                        size_t&       oOffset)
+{
+    size_t row = blockIdx.y;
+    iOffset    = 0;
+    oOffset    = 0;
+    for(size_t d = 1; d < dim; ++d)
+    {
+        const size_t index = row % lengths[d];
+        row /= lengths[d];
+        iOffset += index * stride_in[d];
+        oOffset += index * stride_out[d];
+    }
+}
+
+/// Distance between the two arrays of a pair.  The pairing is over the batch when pairdim is
+/// 0, and otherwise over dimension pairdim; the node's distance or stride along it is twice
+/// this.
+static size_t
+    pair_offset(const TreeNode& node, const size_t dist, const std::vector<size_t>& stride)
+{
+    return node.pairdim == 0 ? dist / 2 : stride[node.pairdim] / 2;
+}
+
 /// Kernels for unpacking two complex arrays with Hermitian symmetry from one complex array
 /// which is the output of a c2c transform where the input is two real arrays x and y.
 ///
@@ -35,11 +65,18 @@
 ///
 /// X_r = (Z_r + Z_{N - r}^*)/2,   Y_r = (Z_r - Z_{N - r}^*)/(2i)
 ///
-/// for r = 1, ... , \floor{N/2} + 1.
+/// for r = 1, ... , \floor{N/2}.
+///
+/// Rows along the first dimension may have any stride, and blockIdx.y runs over the higher
+/// dimensions.
 
 /// Interleaved data version.
 template <typename Treal>
 __global__ static void complex2pair_unpack_kernel(const size_t           N,
+                                                  const size_t           dim,
+                                                  const size_t*          lengths,
+                                                  const size_t*          stride_in,
+                                                  const size_t*          stride_out,
                                                   const Treal*           input,
                                                   const size_t           ioffset,
                                                   const size_t           idist,
@@ -48,22 +85,25 @@ __global__ static void complex2pair_unpack_kernel(const size_t           N,
                                                   const size_t           odist)
 {
     const size_t idx_p  = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    const auto   half_N = (N + 1) / 2;
+    const auto   half_N = N / 2 + 1;
 
     if(idx_p < half_N)
     {
-        const auto inputRe = input + blockIdx.z * idist;
+        size_t iOffset, oOffset;
+        pair_row_offsets(dim, lengths, stride_in, stride_out, iOffset, oOffset);
+
+        const auto inputRe = input + blockIdx.z * idist + iOffset;
         const auto inputIm = inputRe + ioffset;
 
-        auto outputX = output + blockIdx.z * odist;
+        auto outputX = output + blockIdx.z * odist + oOffset;
         auto outputY = outputX + ooffset;
 
-        const Treal Rep = inputRe[idx_p];
-        const Treal Imp = inputIm[idx_p];
+        const Treal Rep = inputRe[idx_p * stride_in[0]];
+        const Treal Imp = inputIm[idx_p * stride_in[0]];
 
-        const size_t idx_q = N - idx_p;
-        const Treal  Req   = inputRe[idx_q];
-        const Treal  Imq   = inputIm[idx_q];
+        const size_t idx_q = (N - idx_p) % N;
+        const Treal  Req   = inputRe[idx_q * stride_in[0]];
+        const Treal  Imq   = inputIm[idx_q * stride_in[0]];
 
         complex_type_t<Treal> X;
         complex_type_t<Treal> Y;
@@ -85,44 +125,51 @@ __global__ static void complex2pair_unpack_kernel(const size_t           N,
             Y.y = -0.5 * (Rep - Req);
         }
 
-        outputX[idx_p] = X;
-        outputY[idx_p] = Y;
+        outputX[idx_p * stride_out[0]] = X;
+        outputY[idx_p * stride_out[0]] = Y;
     }
 }
 
 /// Planar data version.
 template <typename Treal>
-__global__ static void complex2pair_unpack_kernel(const size_t N,
-                                                  const Treal* input,
-                                                  const size_t ioffset,
-                                                  const size_t idist,
-                                                  Treal*       outputRe,
-                                                  Treal*       outputIm,
-                                                  const size_t ooffset,
-                                                  const size_t odist)
+__global__ static void complex2pair_unpack_kernel(const size_t  N,
+                                                  const size_t  dim,
+                                                  const size_t* lengths,
+                                                  const size_t* stride_in,
+                                                  const size_t* stride_out,
+                                                  const Treal*  input,
+                                                  const size_t  ioffset,
+                                                  const size_t  idist,
+                                                  Treal*        outputRe,
+                                                  Treal*        outputIm,
+                                                  const size_t  ooffset,
+                                                  const size_t  odist)
 {
     const size_t idx_p  = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    const auto   half_N = (N + 1) / 2;
+    const auto   half_N = N / 2 + 1;
 
     // Planar data is assumed to be out-of-place, so we need only run
     // one set of indices.
 
     if(idx_p < half_N)
     {
-        const auto inputRe = input + blockIdx.z * idist;
+        size_t iOffset, oOffset;
+        pair_row_offsets(dim, lengths, stride_in, stride_out, iOffset, oOffset);
+
+        const auto inputRe = input + blockIdx.z * idist + iOffset;
         const auto inputIm = inputRe + ioffset;
 
-        const auto Rep = inputRe[idx_p];
-        const auto Imp = inputIm[idx_p];
+        const auto Rep = inputRe[idx_p * stride_in[0]];
+        const auto Imp = inputIm[idx_p * stride_in[0]];
 
-        const size_t idx_q = N - idx_p;
-        const auto   Req   = inputRe[idx_q];
-        const auto   Imq   = inputIm[idx_q];
+        const size_t idx_q = (N - idx_p) % N;
+        const auto   Req   = inputRe[idx_q * stride_in[0]];
+        const auto   Imq   = inputIm[idx_q * stride_in[0]];
 
-        auto outputXRe = outputRe + blockIdx.z * odist;
+        auto outputXRe = outputRe + blockIdx.z * odist + oOffset;
         auto outputYRe = outputXRe + ooffset;
 
-        auto outputXIm = outputIm + blockIdx.z * odist;
+        auto outputXIm = outputIm + blockIdx.z * odist + oOffset;
         auto outputYIm = outputXIm + ooffset;
 
         complex_type_t<Treal> X;
@@ -145,11 +192,11 @@ __global__ static void complex2pair_unpack_kernel(const size_t N,
             Y.y = -0.5 * (Rep - Req);
         }
 
-        outputXRe[idx_p] = X.x;
-        outputXIm[idx_p] = X.y;
+        outputXRe[idx_p * stride_out[0]] = X.x;
+        outputXIm[idx_p * stride_out[0]] = X.y;
 
-        outputYRe[idx_p] = Y.x;
-        outputYIm[idx_p] = Y.y;
+        outputYRe[idx_p * stride_out[0]] = Y.x;
+        outputYIm[idx_p * stride_out[0]] = Y.y;
     }
 }
 
@@ -166,22 +213,19 @@ void complex2pair_unpack(const void* data_p, void*)
     void* bufOut0 = data->bufOut[0];
     void* bufOut1 = data->bufOut[1];
 
-    const ptrdiff_t ioffset = (data->node->parent->batch % 2 == 0)
-                                  ? idist / 2
-                                  : data->node->inStride[data->node->pairdim];
-
-    const ptrdiff_t ooffset = (data->node->parent->batch % 2 == 0)
-                                  ? odist / 2
-                                  : data->node->outStride[data->node->pairdim];
-
-    // std::cout << "ioffset: " << ioffset << std::endl;
-    // std::cout << "ooffset: " << ooffset << std::endl;
+    const size_t ioffset = pair_offset(*data->node, idist, data->node->inStride);
+    const size_t ooffset = pair_offset(*data->node, odist, data->node->outStride);
 
     const size_t N              = data->node->length[0];
     const size_t high_dimension = std::accumulate(
         data->node->length.begin() + 1, data->node->length.end(), 1, std::multiplies<size_t>());
     const size_t batch = data->node->batch;
 
+    const size_t  dim        = data->node->length.size();
+    const size_t* lengths    = data->node->devKernArg.data();
+    const size_t* stride_in  = data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH;
+    const size_t* stride_out = data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH;
+
     const size_t block_size = 512;
     size_t       blocks     = (N + block_size - 1) / block_size;
 
@@ -200,6 +244,10 @@ void complex2pair_unpack(const void* data_p, void*)
                                0,
                                data->rocfft_stream,
                                N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (float*)bufIn0,
                                ioffset,
                                idist,
@@ -214,6 +262,10 @@ void complex2pair_unpack(const void* data_p, void*)
                                0,
                                data->rocfft_stream,
                                N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (double*)bufIn0,
                                ioffset,
                                idist,
@@ -221,6 +273,24 @@ void complex2pair_unpack(const void* data_p, void*)
                                ooffset,
                                odist);
             break;
+        case rocfft_precision_half:
+            hipLaunchKernelGGL(complex2pair_unpack_kernel<_Float16>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (_Float16*)bufIn0,
+                               ioffset,
+                               idist,
+                               (complex_type_t<_Float16>*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
         default:
             std::cerr << "invalid precision for complex2pair\n";
             assert(false);
@@ -236,6 +306,10 @@ void complex2pair_unpack(const void* data_p, void*)
                                0,
                                data->rocfft_stream,
                                N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (float*)bufIn0,
                                ioffset,
                                idist,
@@ -251,6 +325,10 @@ void complex2pair_unpack(const void* data_p, void*)
                                0,
                                data->rocfft_stream,
                                N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
                                (double*)bufIn0,
                                ioffset,
                                idist,
@@ -259,6 +337,25 @@ void complex2pair_unpack(const void* data_p, void*)
                                ooffset,
                                odist);
             break;
+        case rocfft_precision_half:
+            hipLaunchKernelGGL(complex2pair_unpack_kernel<_Float16>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (_Float16*)bufIn0,
+                               ioffset,
+                               idist,
+                               (_Float16*)bufOut0,
+                               (_Float16*)bufOut1,
+                               ooffset,
+                               odist);
+            break;
         default:
             std::cerr << "invalid precision for complex2pair\n";
             assert(false);
@@ -270,18 +367,267 @@ void complex2pair_unpack(const void* data_p, void*)
     }
 }
 
-// FIXME: document
+/// Kernels for packing two complex arrays with Hermitian symmetry into one complex array,
+/// whose inverse c2c transform is x + iy for the two real arrays x and y.
+///
+/// That is, given the halves X_r and Y_r for r = 0, ... , \floor{N/2}, we compute
+///
+/// Z_r = X_r + i Y_r,             Z_{N - r} = X_r^* + i Y_r^*
+///
+/// and store Z as planar reals, its imaginary part ooffset after its real part.
+
+/// Interleaved data version.
 template <typename Treal>
-__global__ static void pair2complex_pack_kernel()
+__global__ static void pair2complex_pack_kernel(const size_t                 N,
+                                                const size_t                 dim,
+                                                const size_t*                lengths,
+                                                const size_t*                stride_in,
+                                                const size_t*                stride_out,
+                                                const complex_type_t<Treal>* input,
+                                                const size_t                 ioffset,
+                                                const size_t                 idist,
+                                                Treal*                       output,
+                                                const size_t                 ooffset,
+                                                const size_t                 odist)
 {
-    // FIXME: implement
+    const size_t idx_p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx_p < N)
+    {
+        const bool   upper = idx_p > N / 2;
+        const size_t idx_r = upper ? N - idx_p : idx_p;
+
+        size_t iOffset, oOffset;
+        pair_row_offsets(dim, lengths, stride_in, stride_out, iOffset, oOffset);
+
+        const auto inputX = input + blockIdx.z * idist + iOffset;
+        const auto inputY = inputX + ioffset;
+
+        auto outputRe = output + blockIdx.z * odist + oOffset;
+        auto outputIm = outputRe + ooffset;
+
+        auto X = inputX[idx_r * stride_in[0]];
+        auto Y = inputY[idx_r * stride_in[0]];
+        if(upper)
+        {
+            X.y = -X.y;
+            Y.y = -Y.y;
+        }
+
+        outputRe[idx_p * stride_out[0]] = X.x - Y.y;
+        outputIm[idx_p * stride_out[0]] = X.y + Y.x;
+    }
+}
+
+/// Planar data version.
+template <typename Treal>
+__global__ static void pair2complex_pack_kernel(const size_t  N,
+                                                const size_t  dim,
+                                                const size_t* lengths,
+                                                const size_t* stride_in,
+                                                const size_t* stride_out,
+                                                const Treal*  inputRe,
+                                                const Treal*  inputIm,
+                                                const size_t  ioffset,
+                                                const size_t  idist,
+                                                Treal*        output,
+                                                const size_t  ooffset,
+                                                const size_t  odist)
+{
+    const size_t idx_p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx_p < N)
+    {
+        const bool   upper = idx_p > N / 2;
+        const size_t idx_r = upper ? N - idx_p : idx_p;
+
+        size_t iOffset, oOffset;
+        pair_row_offsets(dim, lengths, stride_in, stride_out, iOffset, oOffset);
+
+        const auto inputXRe = inputRe + blockIdx.z * idist + iOffset;
+        const auto inputXIm = inputIm + blockIdx.z * idist + iOffset;
+        const auto inputYRe = inputXRe + ioffset;
+        const auto inputYIm = inputXIm + ioffset;
+
+        auto outputRe = output + blockIdx.z * odist + oOffset;
+        auto outputIm = outputRe + ooffset;
+
+        complex_type_t<Treal> X;
+        complex_type_t<Treal> Y;
+
+        X.x = inputXRe[idx_r * stride_in[0]];
+        X.y = upper ? -inputXIm[idx_r * stride_in[0]] : inputXIm[idx_r * stride_in[0]];
+        Y.x = inputYRe[idx_r * stride_in[0]];
+        Y.y = upper ? -inputYIm[idx_r * stride_in[0]] : inputYIm[idx_r * stride_in[0]];
+
+        outputRe[idx_p * stride_out[0]] = X.x - Y.y;
+        outputIm[idx_p * stride_out[0]] = X.y + Y.x;
+    }
 }
 
 /// Pack two (Hermitian-symmetric) complex arrays into full-length complex array for a
 /// complex-to-real transform.
 void pair2complex_pack(const void* data_p, void*)
 {
-    // FIXME: implement
     const DeviceCallIn* data = (DeviceCallIn*)data_p;
-    assert(false);
+
+    const size_t idist = data->node->iDist;
+    const size_t odist = data->node->oDist;
+
+    void* bufIn0  = data->bufIn[0];
+    void* bufIn1  = data->bufIn[1];
+    void* bufOut0 = data->bufOut[0];
+
+    const size_t ioffset = pair_offset(*data->node, idist, data->node->inStride);
+    const size_t ooffset = pair_offset(*data->node, odist, data->node->outStride);
+
+    const size_t N              = data->node->length[0];
+    const size_t high_dimension = std::accumulate(
+        data->node->length.begin() + 1, data->node->length.end(), 1, std::multiplies<size_t>());
+    const size_t batch = data->node->batch;
+
+    const size_t  dim        = data->node->length.size();
+    const size_t* lengths    = data->node->devKernArg.data();
+    const size_t* stride_in  = data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH;
+    const size_t* stride_out = data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH;
+
+    const size_t block_size = 512;
+    size_t       blocks     = (N + block_size - 1) / block_size;
+
+    dim3 grid(blocks, high_dimension, batch);
+    dim3 threads(block_size, 1, 1);
+
+    switch(data->node->inArrayType)
+    {
+    case rocfft_array_type_hermitian_interleaved:
+        switch(data->node->precision)
+        {
+        case rocfft_precision_single:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<float>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (complex_type_t<float>*)bufIn0,
+                               ioffset,
+                               idist,
+                               (float*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        case rocfft_precision_double:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<double>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (complex_type_t<double>*)bufIn0,
+                               ioffset,
+                               idist,
+                               (double*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        case rocfft_precision_half:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<_Float16>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (complex_type_t<_Float16>*)bufIn0,
+                               ioffset,
+                               idist,
+                               (_Float16*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        default:
+            std::cerr << "invalid precision for pair2complex\n";
+            assert(false);
+        }
+        break;
+    case rocfft_array_type_hermitian_planar:
+        switch(data->node->precision)
+        {
+        case rocfft_precision_single:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<float>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (float*)bufIn0,
+                               (float*)bufIn1,
+                               ioffset,
+                               idist,
+                               (float*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        case rocfft_precision_double:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<double>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (double*)bufIn0,
+                               (double*)bufIn1,
+                               ioffset,
+                               idist,
+                               (double*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        case rocfft_precision_half:
+            hipLaunchKernelGGL(pair2complex_pack_kernel<_Float16>,
+                               grid,
+                               threads,
+                               0,
+                               data->rocfft_stream,
+                               N,
+                               dim,
+                               lengths,
+                               stride_in,
+                               stride_out,
+                               (_Float16*)bufIn0,
+                               (_Float16*)bufIn1,
+                               ioffset,
+                               idist,
+                               (_Float16*)bufOut0,
+                               ooffset,
+                               odist);
+            break;
+        default:
+            std::cerr << "invalid precision for pair2complex\n";
+            assert(false);
+        }
+        break;
+    default:
+        std::cerr << "invalid input type for pair2complex" << std::endl;
+        assert(false);
+    }
 }
@@ -29,27 +29,27 @@
 ///
 /// @param[in]    m size_t.
 /// @param[in]    n size_t.
-/// @param[in]    A pointer storing batch_count of A matrix on the GPU.
-/// @param[inout] B pointer storing batch_count of B matrix on the GPU.
+/// @param[in]    A batch_count of A matrix on the GPU, a pointer or planar struct.
+/// @param[inout] B batch_count of B matrix on the GPU, a pointer or planar struct.
 /// @param[in]    count size_t number of matrices processed
 template <typename T, typename TA, typename TB, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
-rocfft_status rocfft_transpose_outofplace_template(size_t      m,
-                                                   size_t      n,
-                                                   const TA*   A,
-                                                   TB*         B,
-                                                   void*       twiddles_large,
-                                                   size_t      count,
-                                                   size_t*     lengths,
-                                                   size_t*     stride_in,
-                                                   size_t*     stride_out,
-                                                   int         twl,
-                                                   int         dir,
-                                                   int         scheme,
-                                                   bool        unit_stride0,
-                                                   bool        diagonal,
-                                                   size_t      ld_in,
-                                                   size_t      ld_out,
-                                                   hipStream_t rocfft_stream)
+rocfft_status rocfft_transpose_outofplace_template(size_t          m,
+                                                   size_t          n,
+                                                   array_in_t<TA>  A,
+                                                   array_out_t<TB> B,
+                                                   void*           twiddles_large,
+                                                   size_t          count,
+                                                   size_t*         lengths,
+                                                   size_t*         stride_in,
+                                                   size_t*         stride_out,
+                                                   int             twl,
+                                                   int             dir,
+                                                   int             scheme,
+                                                   bool            unit_stride0,
+                                                   bool            diagonal,
+                                                   size_t          ld_in,
+                                                   size_t          ld_out,
+                                                   hipStream_t     rocfft_stream)
 {
 
     dim3 grid((n - 1) / TRANSPOSE_DIM_X + 1, ((m - 1) / TRANSPOSE_DIM_X + 1), count);
@@ -357,6 +357,76 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
             std::make_tuple(4, 1, false, false, false),
             &HIP_KERNEL_NAME(
                 transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, 4, 1, false, false, false>));
+
+        // twl=TWL_SINCOS:
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, true, true, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, true, true, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, false, true, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, false, true, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, true, false, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, true, false, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, false, false, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, false, false, true>));
+
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, true, true, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, true, true, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, false, true, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, false, true, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, true, false, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, true, false, true>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, false, false, true),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, false, false, true>));
+
+
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, true, true, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, true, true, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, false, true, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, false, true, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, true, false, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, true, false, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, -1, false, false, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, -1, false, false, false>));
+
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, true, true, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, true, true, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, false, true, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, false, true, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, true, false, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, true, false, false>));
+        tmap.emplace(
+            std::make_tuple(TWL_SINCOS, 1, false, false, false),
+            &HIP_KERNEL_NAME(
+                transpose_kernel2<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y, true, TWL_SINCOS, 1, false, false, false>));
         // clang-format on
 
         // Tuple containing template parameters for transpose TWL, DIR, ALL, UNIT_STRIDE_0, DIAGONAL
@@ -372,7 +442,7 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
                                rocfft_stream,
                                A,
                                B,
-                               (T*)twiddles_large,
+                               (compute_t<T>*)twiddles_large,
                                lengths,
                                stride_in,
                                stride_out);
@@ -491,7 +561,7 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
                                rocfft_stream,
                                A,
                                B,
-                               (T*)twiddles_large,
+                               (compute_t<T>*)twiddles_large,
                                lengths,
                                stride_in,
                                stride_out,
@@ -514,6 +584,71 @@ rocfft_status rocfft_transpose_outofplace_template(size_t      m,
     return rocfft_status_success;
 }
 
+// Launch the transpose of a node on buffers of formats TA and TB
+template <typename T, typename TA, typename TB, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
+static void rocfft_transpose_launch(const DeviceCallIn* data,
+                                    size_t              m,
+                                    size_t              n,
+                                    size_t              count,
+                                    int                 twl,
+                                    int                 dir,
+                                    int                 scheme,
+                                    bool                unit_stride0,
+                                    bool                diagonal,
+                                    size_t              ld_in,
+                                    size_t              ld_out)
+{
+    rocfft_transpose_outofplace_template<T, TA, TB, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>(
+        m,
+        n,
+        array_arg<TA>::make(data->bufIn),
+        array_arg<TB>::make(data->bufOut),
+        data->node->twiddles_large.data(),
+        count,
+        data->node->devKernArg.data(),
+        data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
+        data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
+        twl,
+        dir,
+        scheme,
+        unit_stride0,
+        diagonal,
+        ld_in,
+        ld_out,
+        data->rocfft_stream);
+}
+
+// Planar buffers are read and written in place by the transpose
+// kernels, with their real and imaginary pointers passed by value.
+template <typename T, int TRANSPOSE_DIM_X, int TRANSPOSE_DIM_Y>
+static void rocfft_transpose_formats(const DeviceCallIn* data,
+                                     size_t              m,
+                                     size_t              n,
+                                     size_t              count,
+                                     int                 twl,
+                                     int                 dir,
+                                     int                 scheme,
+                                     bool                unit_stride0,
+                                     bool                diagonal,
+                                     size_t              ld_in,
+                                     size_t              ld_out)
+{
+    const bool planarIn  = is_complex_planar(data->node->inArrayType);
+    const bool planarOut = is_complex_planar(data->node->outArrayType);
+    if(planarIn && planarOut)
+        rocfft_transpose_launch<T, planar<T>, planar<T>, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
+    else if(planarIn)
+        rocfft_transpose_launch<T, planar<T>, T, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
+    else if(planarOut)
+        rocfft_transpose_launch<T, T, planar<T>, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
+    else
+        rocfft_transpose_launch<T, T, T, TRANSPOSE_DIM_X, TRANSPOSE_DIM_Y>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
+}
+
 void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
 {
     DeviceCallIn* data = (DeviceCallIn*)data_p;
@@ -567,6 +702,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
     else
         twl = 0;
 
+    if(data->node->largeTwdSincos)
+        twl = TWL_SINCOS;
+
     int dir = data->node->direction;
 
     size_t count = data->node->batch;
@@ -575,8 +713,6 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
     if(scheme != 0)
         extraDimStart = 3;
 
-    hipStream_t rocfft_stream = data->rocfft_stream;
-
     bool unit_stride0
         = (data->node->inStride[0] == 1 && data->node->outStride[0] == 1) ? true : false;
 
@@ -584,298 +720,13 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p)
         count *= data->node->length[i];
 
     // double2 must use 32 otherwise exceed the shared memory (LDS) size
-
-    // FIXME: push planar ptr on device in better way!!!
-    if((data->node->inArrayType == rocfft_array_type_complex_planar
-        || data->node->inArrayType == rocfft_array_type_hermitian_planar)
-       && (data->node->outArrayType == rocfft_array_type_complex_interleaved
-           || data->node->outArrayType == rocfft_array_type_hermitian_interleaved))
-    {
-        if(data->node->precision == rocfft_precision_single)
-        {
-            cmplx_float_planar in_planar;
-            in_planar.R = (real_type_t<float2>*)data->bufIn[0];
-            in_planar.I = (real_type_t<float2>*)data->bufIn[1];
-
-            void* d_in_planar;
-            hipMalloc(&d_in_planar, sizeof(cmplx_float_planar));
-            hipMemcpy(d_in_planar, &in_planar, sizeof(cmplx_float_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_float,
-                                                 cmplx_float_planar,
-                                                 cmplx_float,
-                                                 64,
-                                                 16>(
-                m,
-                n,
-                (const cmplx_float_planar*)d_in_planar,
-                (cmplx_float*)data->bufOut[0],
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_in_planar);
-        }
-        else
-        {
-            cmplx_double_planar in_planar;
-            in_planar.R = (real_type_t<double2>*)data->bufIn[0];
-            in_planar.I = (real_type_t<double2>*)data->bufIn[1];
-
-            void* d_in_planar;
-            hipMalloc(&d_in_planar, sizeof(cmplx_double_planar));
-            hipMemcpy(d_in_planar, &in_planar, sizeof(cmplx_double_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_double,
-                                                 cmplx_double_planar,
-                                                 cmplx_double,
-                                                 32,
-                                                 32>(
-                m,
-                n,
-                (const cmplx_double_planar*)d_in_planar,
-                (double2*)data->bufOut[0],
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_in_planar);
-        }
-    }
-    else if((data->node->inArrayType == rocfft_array_type_complex_interleaved
-             || data->node->inArrayType == rocfft_array_type_hermitian_interleaved)
-            && (data->node->outArrayType == rocfft_array_type_complex_planar
-                || data->node->outArrayType == rocfft_array_type_hermitian_planar))
-    {
-        if(data->node->precision == rocfft_precision_single)
-        {
-            cmplx_float_planar out_planar;
-            out_planar.R = (real_type_t<float2>*)data->bufOut[0];
-            out_planar.I = (real_type_t<float2>*)data->bufOut[1];
-
-            void* d_out_planar;
-            hipMalloc(&d_out_planar, sizeof(cmplx_float_planar));
-            hipMemcpy(d_out_planar, &out_planar, sizeof(cmplx_float_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_float,
-                                                 cmplx_float,
-                                                 cmplx_float_planar,
-                                                 64,
-                                                 16>(
-                m,
-                n,
-                (const cmplx_float*)data->bufIn[0],
-                (cmplx_float_planar*)d_out_planar,
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_out_planar);
-        }
-        else
-        {
-            cmplx_double_planar out_planar;
-            out_planar.R = (real_type_t<double2>*)data->bufOut[0];
-            out_planar.I = (real_type_t<double2>*)data->bufOut[1];
-
-            void* d_out_planar;
-            hipMalloc(&d_out_planar, sizeof(cmplx_double_planar));
-            hipMemcpy(
-                d_out_planar, &out_planar, sizeof(cmplx_double_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_double,
-                                                 cmplx_double,
-                                                 cmplx_double_planar,
-                                                 32,
-                                                 32>(
-                m,
-                n,
-                (const cmplx_double*)data->bufIn[0],
-                (cmplx_double_planar*)d_out_planar,
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_out_planar);
-        }
-    }
-    else if((data->node->inArrayType == rocfft_array_type_complex_planar
-             || data->node->inArrayType == rocfft_array_type_hermitian_planar)
-            && (data->node->outArrayType == rocfft_array_type_complex_planar
-                || data->node->outArrayType == rocfft_array_type_hermitian_planar))
-    {
-        if(data->node->precision == rocfft_precision_single)
-        {
-            cmplx_float_planar in_planar;
-            in_planar.R = (real_type_t<float2>*)data->bufIn[0];
-            in_planar.I = (real_type_t<float2>*)data->bufIn[1];
-            cmplx_float_planar out_planar;
-            out_planar.R = (real_type_t<float2>*)data->bufOut[0];
-            out_planar.I = (real_type_t<float2>*)data->bufOut[1];
-
-            void* d_in_planar;
-            hipMalloc(&d_in_planar, sizeof(cmplx_float_planar));
-            hipMemcpy(d_in_planar, &in_planar, sizeof(cmplx_float_planar), hipMemcpyHostToDevice);
-
-            void* d_out_planar;
-            hipMalloc(&d_out_planar, sizeof(cmplx_float_planar));
-            hipMemcpy(d_out_planar, &out_planar, sizeof(cmplx_float_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_float,
-                                                 cmplx_float_planar,
-                                                 cmplx_float_planar,
-                                                 64,
-                                                 16>(
-                m,
-                n,
-                (const cmplx_float_planar*)d_in_planar,
-                (cmplx_float_planar*)d_out_planar,
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_in_planar);
-            hipFree(d_out_planar);
-        }
-        else
-        {
-            cmplx_double_planar in_planar;
-            in_planar.R = (real_type_t<double2>*)data->bufIn[0];
-            in_planar.I = (real_type_t<double2>*)data->bufIn[1];
-            cmplx_double_planar out_planar;
-            out_planar.R = (real_type_t<double2>*)data->bufOut[0];
-            out_planar.I = (real_type_t<double2>*)data->bufOut[1];
-
-            void* d_in_planar;
-            hipMalloc(&d_in_planar, sizeof(cmplx_double_planar));
-            hipMemcpy(d_in_planar, &in_planar, sizeof(cmplx_double_planar), hipMemcpyHostToDevice);
-
-            void* d_out_planar;
-            hipMalloc(&d_out_planar, sizeof(cmplx_double_planar));
-            hipMemcpy(
-                d_out_planar, &out_planar, sizeof(cmplx_double_planar), hipMemcpyHostToDevice);
-
-            rocfft_transpose_outofplace_template<cmplx_double,
-                                                 cmplx_double_planar,
-                                                 cmplx_double_planar,
-                                                 32,
-                                                 32>(
-                m,
-                n,
-                (const cmplx_double_planar*)(&in_planar),
-                (cmplx_double_planar*)(&out_planar),
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-
-            hipFree(d_in_planar);
-            hipFree(d_out_planar);
-        }
-    }
+    if(data->node->precision == rocfft_precision_single)
+        rocfft_transpose_formats<cmplx_float, 64, 16>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
+    else if(data->node->precision == rocfft_precision_half)
+        rocfft_transpose_formats<cmplx_half, 64, 16>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
     else
-    {
-        //FIXME:
-        //  there are more cases than
-        //      if(data->node->inArrayType == rocfft_array_type_complex_interleaved
-        //      && data->node->outArrayType == rocfft_array_type_complex_interleaved)
-        //  fall into this default case which might to correct
-        if(data->node->precision == rocfft_precision_single)
-            rocfft_transpose_outofplace_template<cmplx_float, cmplx_float, cmplx_float, 64, 16>(
-                m,
-                n,
-                (const cmplx_float*)data->bufIn[0],
-                (cmplx_float*)data->bufOut[0],
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-        else
-            rocfft_transpose_outofplace_template<cmplx_double, cmplx_double, cmplx_double, 32, 32>(
-                m,
-                n,
-                (const cmplx_double*)data->bufIn[0],
-                (cmplx_double*)data->bufOut[0],
-                data->node->twiddles_large.data(),
-                count,
-                data->node->devKernArg.data(),
-                data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,
-                data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,
-                twl,
-                dir,
-                scheme,
-                unit_stride0,
-                diagonal,
-                ld_in,
-                ld_out,
-                rocfft_stream);
-    }
+        rocfft_transpose_formats<cmplx_double, 32, 32>(
+            data, m, n, count, twl, dir, scheme, unit_stride0, diagonal, ld_in, ld_out);
 }
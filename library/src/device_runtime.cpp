@@ -0,0 +1,266 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "batch_copy.h"
+#include "device_runtime.h"
+#include "kernel_launch.h"
+#include "logging.h"
+#include "plan.h"
+
+namespace
+{
+    class HipRuntime : public DeviceRuntime
+    {
+    public:
+        hipError_t malloc(void** ptr, size_t size) override
+        {
+            return hipMalloc(ptr, size);
+        }
+        hipError_t free(void* ptr) override
+        {
+            return hipFree(ptr);
+        }
+        hipError_t memcpy(void* dst, const void* src, size_t size, hipMemcpyKind kind) override
+        {
+            return hipMemcpy(dst, src, size, kind);
+        }
+
+        hipError_t get_device(int* device) override
+        {
+            return hipGetDevice(device);
+        }
+        hipError_t device_attribute(int* value, hipDeviceAttribute_t attr, int device) override
+        {
+            return hipDeviceGetAttribute(value, attr, device);
+        }
+
+        hipError_t event_create(hipEvent_t* event) override
+        {
+            return hipEventCreate(event);
+        }
+        hipError_t event_destroy(hipEvent_t event) override
+        {
+            return hipEventDestroy(event);
+        }
+        hipError_t event_record(hipEvent_t event, hipStream_t stream) override
+        {
+            return hipEventRecord(event, stream);
+        }
+        hipError_t event_synchronize(hipEvent_t event) override
+        {
+            return hipEventSynchronize(event);
+        }
+        hipError_t event_elapsed_time(float* ms, hipEvent_t start, hipEvent_t stop) override
+        {
+            return hipEventElapsedTime(ms, start, stop);
+        }
+        hipError_t stream_create(hipStream_t* stream) override
+        {
+            return hipStreamCreateWithFlags(stream, hipStreamNonBlocking);
+        }
+        hipError_t stream_destroy(hipStream_t stream) override
+        {
+            return hipStreamDestroy(stream);
+        }
+        hipError_t stream_synchronize(hipStream_t stream) override
+        {
+            return hipStreamSynchronize(stream);
+        }
+        hipError_t stream_wait_event(hipStream_t stream, hipEvent_t event) override
+        {
+            return hipStreamWaitEvent(stream, event, 0);
+        }
+
+        void launch(DevFnCall fn, const DeviceCallIn& data, DeviceCallOut& back) override
+        {
+            fn(&data, &back);
+        }
+
+        void batch_copy(const BatchCopy& copy, hipStream_t stream) override
+        {
+            ::batch_copy(copy, stream);
+        }
+    };
+
+    // Stand-in for a GPU.  "Device" memory is host memory, device
+    // attributes all read as 0 (which the planner takes as current
+    // hardware), events take no time and launches are not run.
+    class RecordingRuntime : public DeviceRuntime
+    {
+        std::atomic<size_t> malloc_calls{0}, malloc_bytes{0}, free_calls{0};
+        std::atomic<size_t> memcpy_calls{0}, memcpy_bytes{0};
+        std::atomic<size_t> query_calls{0}, event_calls{0}, launch_calls{0};
+
+    public:
+        hipError_t malloc(void** ptr, size_t size) override
+        {
+            ++malloc_calls;
+            malloc_bytes += size;
+            *ptr = std::malloc(size ? size : 1);
+            return *ptr ? hipSuccess : hipErrorOutOfMemory;
+        }
+        hipError_t free(void* ptr) override
+        {
+            ++free_calls;
+            std::free(ptr);
+            return hipSuccess;
+        }
+        hipError_t memcpy(void* dst, const void* src, size_t size, hipMemcpyKind kind) override
+        {
+            ++memcpy_calls;
+            memcpy_bytes += size;
+            std::memcpy(dst, src, size);
+            return hipSuccess;
+        }
+
+        hipError_t get_device(int* device) override
+        {
+            ++query_calls;
+            *device = 0;
+            return hipSuccess;
+        }
+        hipError_t device_attribute(int* value, hipDeviceAttribute_t attr, int device) override
+        {
+            ++query_calls;
+            *value = 0;
+            return hipSuccess;
+        }
+
+        hipError_t event_create(hipEvent_t* event) override
+        {
+            ++event_calls;
+            *event = nullptr;
+            return hipSuccess;
+        }
+        hipError_t event_destroy(hipEvent_t event) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+        hipError_t event_record(hipEvent_t event, hipStream_t stream) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+        hipError_t event_synchronize(hipEvent_t event) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+        hipError_t event_elapsed_time(float* ms, hipEvent_t start, hipEvent_t stop) override
+        {
+            ++event_calls;
+            *ms = 0.0f;
+            return hipSuccess;
+        }
+        hipError_t stream_create(hipStream_t* stream) override
+        {
+            ++event_calls;
+            *stream = nullptr;
+            return hipSuccess;
+        }
+        hipError_t stream_destroy(hipStream_t stream) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+        hipError_t stream_synchronize(hipStream_t stream) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+        hipError_t stream_wait_event(hipStream_t stream, hipEvent_t event) override
+        {
+            ++event_calls;
+            return hipSuccess;
+        }
+
+        void launch(DevFnCall fn, const DeviceCallIn& data, DeviceCallOut& back) override
+        {
+            ++launch_calls;
+            const auto& grid = data.gridParam;
+            log_trace("device_launch",
+                      "scheme",
+                      PrintScheme(data.node->scheme),
+                      "blocks",
+                      grid.b_x,
+                      grid.b_y,
+                      grid.b_z,
+                      "threads",
+                      grid.tpb_x,
+                      grid.tpb_y,
+                      grid.tpb_z);
+            back.err = 0;
+        }
+
+        void batch_copy(const BatchCopy& copy, hipStream_t stream) override
+        {
+            for(size_t i = 0; i < copy.count; ++i)
+            {
+                ++memcpy_calls;
+                memcpy_bytes += copy.bytes;
+                char* slot   = copy.staging + i * copy.slot;
+                void* buffer = copy.buffer_array ? copy.buffer_array[i] : copy.buffers[i];
+                if(copy.gather)
+                    std::memcpy(slot, buffer, copy.bytes);
+                else
+                    std::memcpy(buffer, slot, copy.bytes);
+            }
+        }
+
+        void log_summary() override
+        {
+            log_trace("device_runtime",
+                      "malloc_calls",
+                      malloc_calls.load(),
+                      "malloc_bytes",
+                      malloc_bytes.load(),
+                      "free_calls",
+                      free_calls.load(),
+                      "memcpy_calls",
+                      memcpy_calls.load(),
+                      "memcpy_bytes",
+                      memcpy_bytes.load(),
+                      "query_calls",
+                      query_calls.load(),
+                      "event_calls",
+                      event_calls.load(),
+                      "launch_calls",
+                      launch_calls.load());
+        }
+    };
+}
+
+DeviceRuntime& device_runtime()
+{
+    // never destroyed, since plans held by static objects may still
+    // free their buffers during static destruction
+    static DeviceRuntime* runtime = []() -> DeviceRuntime* {
+        const char* name = getenv("ROCFFT_DEVICE_RUNTIME");
+        if(name && strcmp(name, "record") == 0)
+            return new RecordingRuntime;
+        return new HipRuntime;
+    }();
+    return *runtime;
+}
@@ -0,0 +1,438 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "coalesce.h"
+#include "device_runtime.h"
+#include "grouped.h"
+#include "logging.h"
+#include "private.h"
+#include "radix_table.h"
+#include "repo.h"
+#include "transform.h"
+
+namespace
+{
+    bool IsPlanar(rocfft_array_type type)
+    {
+        return type == rocfft_array_type_complex_planar
+               || type == rocfft_array_type_hermitian_planar;
+    }
+
+    // elements a plan transforms, to balance the streams' shares
+    size_t PlanElements(const rocfft_plan_t& plan)
+    {
+        size_t elements = plan.batch;
+        for(size_t i = 0; i < plan.rank; ++i)
+            elements *= plan.lengths[i];
+        return elements;
+    }
+
+    // How a group runs: one launch for each kernel shared by several
+    // plans, and each other plan on its own.  Those launches are spread
+    // over the library's streams, so that launches of different kernels
+    // overlap on the device.
+    struct GroupSchedule
+    {
+        // most streams a group is spread over
+        static const size_t max_streams = 8;
+
+        // plans computed by each shared kernel, by the parameters of
+        // one of its transforms, and the plans run on their own
+        std::map<rocfft_plan_t, std::vector<size_t>> shared;
+        std::vector<size_t>                          alone;
+
+        // stream of each shared kernel, in the order of 'shared', and
+        // of each plan in 'alone'
+        std::vector<size_t> sharedStream;
+        std::vector<size_t> aloneStream;
+        size_t              streams = 0;
+
+        // pointer table entries of the shared kernels, and each lone
+        // plan's part of the work buffer
+        std::vector<size_t> workOffset;
+        size_t              tableCount = 0;
+        size_t              workSize   = 0;
+
+        GroupSchedule(size_t                       count,
+                      const rocfft_plan            plans[],
+                      const std::vector<ExecPlan>& execPlans)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                if(BatchPointersSupported(execPlans[i]))
+                {
+                    rocfft_plan_t single = *plans[i];
+                    single.batch         = 1;
+                    single.desc.inDist   = 0;
+                    single.desc.outDist  = 0;
+                    shared[single].push_back(i);
+                    // up to two planes each of input and output
+                    tableCount += 4 * plans[i]->batch;
+                }
+                else
+                {
+                    alone.push_back(i);
+                    // keep each plan's work buffer aligned for any
+                    // element type
+                    workOffset.push_back(workSize);
+                    workSize += (execPlans[i].workBufSize * 2 * plans[i]->base_type_size + 255)
+                                / 256 * 256;
+                }
+            }
+
+            // elements of each launch, shared kernels first
+            std::vector<size_t> elements;
+            for(const auto& kernel : shared)
+            {
+                size_t e = 0;
+                for(auto i : kernel.second)
+                    e += PlanElements(*plans[i]);
+                elements.push_back(e);
+            }
+            for(auto i : alone)
+                elements.push_back(PlanElements(*plans[i]));
+
+            // largest launches first, each to the stream with the least
+            // work so far
+            std::vector<size_t> order(elements.size());
+            for(size_t l = 0; l < order.size(); ++l)
+                order[l] = l;
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return elements[a] > elements[b];
+            });
+
+            streams = std::min(elements.size(), max_streams);
+            std::vector<size_t> load(streams, 0);
+            std::vector<size_t> streamOf(elements.size());
+            for(auto l : order)
+            {
+                const size_t s = std::min_element(load.begin(), load.end()) - load.begin();
+                load[s] += elements[l];
+                streamOf[l] = s;
+            }
+            sharedStream.assign(streamOf.begin(), streamOf.begin() + shared.size());
+            aloneStream.assign(streamOf.begin() + shared.size(), streamOf.end());
+        }
+    };
+
+    // State shared by all grouped executions, which are serialized on
+    // 'mutex'
+    struct GroupState
+    {
+        std::mutex mutex;
+
+        // plans for the transforms of a group's plans that share a
+        // kernel, by the parameters of one transform and the total batch
+        std::map<std::pair<rocfft_plan_t, size_t>, ExecPlan> plans;
+
+        // the library's streams, each with an event recorded at the
+        // end of its share of a group, and the event they start from
+        std::vector<hipStream_t> streams;
+        std::vector<hipEvent_t>  done;
+        hipEvent_t               fork = nullptr;
+
+        // pointer tables of the shared kernels, and the work buffers of
+        // the plans run on their own
+        devbuf table;
+        devbuf work;
+        size_t tableSize = 0;
+        size_t workSize  = 0;
+
+        // recorded once the last group is done with the table and the
+        // work buffer
+        hipEvent_t idle = nullptr;
+
+        // plan for a batch of 'batch' transforms like 'single', built on
+        // first use
+        const ExecPlan* BatchPlan(const rocfft_plan_t& single, size_t batch)
+        {
+            auto key = std::make_pair(single, batch);
+            auto it  = plans.find(key);
+            if(it == plans.end())
+            {
+                // the kernel takes each transform's address from the
+                // table, so the distances only need to be valid
+                rocfft_plan_t batched = single;
+                batched.batch         = batch;
+                batched.desc.inDist   = single.lengths[0] * single.desc.inStrides[0];
+                batched.desc.outDist  = single.lengths[0] * single.desc.outStrides[0];
+                batched.desc.backend  = rocfft_backend_device;
+
+                ExecPlan execPlan;
+                if(!Repo::BuildExecPlan(batched, execPlan))
+                    return nullptr;
+                it = plans.emplace(key, std::move(execPlan)).first;
+            }
+            return &it->second;
+        }
+
+        // create the events, and streams up to 'count' of them
+        bool ReserveStreams(size_t count)
+        {
+            auto& runtime = device_runtime();
+            if(!idle && runtime.event_create(&idle) != hipSuccess)
+            {
+                idle = nullptr;
+                return false;
+            }
+            if(!fork && runtime.event_create(&fork) != hipSuccess)
+            {
+                fork = nullptr;
+                return false;
+            }
+            while(streams.size() < count)
+            {
+                hipStream_t s;
+                hipEvent_t  e;
+                if(runtime.stream_create(&s) != hipSuccess)
+                    return false;
+                if(runtime.event_create(&e) != hipSuccess)
+                {
+                    runtime.stream_destroy(s);
+                    return false;
+                }
+                streams.push_back(s);
+                done.push_back(e);
+            }
+            return true;
+        }
+    };
+
+    // never destroyed, like the device runtime, so its streams and
+    // buffers stay valid for the life of the process
+    GroupState& group_state()
+    {
+        static GroupState* group = new GroupState;
+        return *group;
+    }
+
+    // grow a table or work buffer to at least 'size' bytes
+    bool Reserve(devbuf& buf, size_t& bufSize, size_t size)
+    {
+        if(bufSize >= size)
+            return true;
+        bufSize = 0;
+        if(buf.alloc(size) != hipSuccess)
+            return false;
+        bufSize = size;
+        return true;
+    }
+
+    // check every plan of a group, and look up their execution plans
+    rocfft_status CheckGroup(size_t                 count,
+                             const rocfft_plan      plans[],
+                             void**                 in_buffers[],
+                             void**                 out_buffers[],
+                             rocfft_execution_info  info,
+                             std::vector<ExecPlan>& execPlans)
+    {
+        Repo& repo = Repo::GetRepo();
+        execPlans.resize(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(plans[i] == nullptr || (in_buffers && in_buffers[i] == nullptr))
+                return rocfft_status_invalid_arg_value;
+            if(in_buffers && plans[i]->placement == rocfft_placement_notinplace
+               && (out_buffers == nullptr || out_buffers[i] == nullptr))
+                return rocfft_status_invalid_arg_value;
+
+            repo.GetPlan(plans[i], execPlans[i]);
+            const rocfft_execution_backend backend
+                = (info && info->backend != rocfft_backend_default) ? info->backend
+                                                                     : execPlans[i].backend;
+            if(execPlans[i].backend == rocfft_backend_host || backend == rocfft_backend_host)
+                return rocfft_status_invalid_arg_value;
+        }
+        return rocfft_status_success;
+    }
+}
+
+rocfft_status TransformGrouped(size_t                count,
+                               const rocfft_plan     plans[],
+                               void**                in_buffers[],
+                               void**                out_buffers[],
+                               rocfft_execution_info info)
+{
+    // check every plan before running any of them
+    std::vector<ExecPlan> execPlans;
+    const rocfft_status   status
+        = CheckGroup(count, plans, in_buffers, out_buffers, info, execPlans);
+    if(status != rocfft_status_success)
+        return status;
+
+    const GroupSchedule schedule(count, plans, execPlans);
+    const auto&         shared = schedule.shared;
+    const auto&         alone  = schedule.alone;
+
+    log_trace(__func__,
+              "count",
+              count,
+              "shared_kernels",
+              shared.size(),
+              "alone",
+              alone.size(),
+              "streams",
+              schedule.streams);
+
+    auto&                       group = group_state();
+    std::lock_guard<std::mutex> lck(group.mutex);
+    auto&                       runtime = device_runtime();
+    const hipStream_t           stream  = info->rocfft_stream;
+
+    if(!group.ReserveStreams(schedule.streams))
+        return rocfft_status_failure;
+
+    // the table is written from the host, so wait for the last group
+    // to be done reading it
+    runtime.event_synchronize(group.idle);
+    if(!Reserve(group.table, group.tableSize, schedule.tableCount * sizeof(void*))
+       || !Reserve(group.work, group.workSize, schedule.workSize))
+        return rocfft_status_failure;
+
+    // each shared kernel's input planes, then its output planes
+    std::vector<void*>  table;
+    std::vector<size_t> tableOffset;
+    table.reserve(schedule.tableCount);
+    for(const auto& kernel : shared)
+    {
+        const rocfft_plan_t& single    = kernel.first;
+        const size_t         inPlanes  = IsPlanar(single.desc.inArrayType) ? 2 : 1;
+        const size_t         outPlanes = IsPlanar(single.desc.outArrayType) ? 2 : 1;
+        const size_t         inElem    = RealTypeSize(single.precision) * (3 - inPlanes);
+        const size_t         outElem   = RealTypeSize(single.precision) * (3 - outPlanes);
+        const bool           inplace   = single.placement == rocfft_placement_inplace;
+
+        tableOffset.push_back(table.size());
+        for(size_t p = 0; p < inPlanes; ++p)
+            for(auto i : kernel.second)
+                for(size_t b = 0; b < plans[i]->batch; ++b)
+                    table.push_back(static_cast<char*>(in_buffers[i][p])
+                                    + b * plans[i]->desc.inDist * inElem);
+        if(!inplace)
+            for(size_t p = 0; p < outPlanes; ++p)
+                for(auto i : kernel.second)
+                    for(size_t b = 0; b < plans[i]->batch; ++b)
+                        table.push_back(static_cast<char*>(out_buffers[i][p])
+                                        + b * plans[i]->desc.outDist * outElem);
+    }
+    const size_t tableBytes = table.size() * sizeof(void*);
+    if(tableBytes > 0
+       && runtime.memcpy(group.table.data(), table.data(), tableBytes, hipMemcpyHostToDevice)
+              != hipSuccess)
+        return rocfft_status_failure;
+
+    // build the shared kernels' batched plans before any stream starts
+    std::vector<const ExecPlan*> batchPlans;
+    std::vector<size_t>          batches;
+    for(const auto& kernel : shared)
+    {
+        size_t batch = 0;
+        for(auto i : kernel.second)
+            batch += plans[i]->batch;
+        batchPlans.push_back(group.BatchPlan(kernel.first, batch));
+        batches.push_back(batch);
+        if(!batchPlans.back())
+            return rocfft_status_failure;
+    }
+
+    // the library's streams start once the caller's stream reaches
+    // this point, and the caller's stream continues once they finish
+    runtime.event_record(group.fork, stream);
+    for(size_t s = 0; s < schedule.streams; ++s)
+        runtime.stream_wait_event(group.streams[s], group.fork);
+
+    // launch each shared kernel on the whole of its plans' transforms
+    auto   tableOf = static_cast<void**>(group.table.data());
+    size_t k       = 0;
+    for(const auto& kernel : shared)
+    {
+        const rocfft_plan_t& single    = kernel.first;
+        const size_t         inPlanes  = IsPlanar(single.desc.inArrayType) ? 2 : 1;
+        const size_t         outPlanes = IsPlanar(single.desc.outArrayType) ? 2 : 1;
+        const bool           inplace   = single.placement == rocfft_placement_inplace;
+        const size_t         batch     = batches[k];
+
+        // the kernel's buffer arguments are not dereferenced; pass the
+        // tables so that none of them is null
+        rocfft_execution_info_t tableInfo = *info;
+        void*                   in[2]     = {};
+        void*                   out[2]    = {};
+        void**                  entry     = tableOf + tableOffset[k];
+        for(size_t p = 0; p < inPlanes; ++p, entry += batch)
+        {
+            tableInfo.batchPointers.in[p] = entry;
+            in[p]                         = entry;
+        }
+        for(size_t p = 0; p < outPlanes; ++p, entry += inplace ? 0 : batch)
+        {
+            tableInfo.batchPointers.out[p] = inplace ? tableInfo.batchPointers.in[p] : entry;
+            out[p]                         = inplace ? in[p] : entry;
+        }
+        tableInfo.rocfft_stream = group.streams[schedule.sharedStream[k]];
+        tableInfo.backend       = rocfft_backend_device;
+        TransformPowX(*batchPlans[k], in, out, &tableInfo);
+        ++k;
+    }
+
+    for(size_t a = 0; a < alone.size(); ++a)
+    {
+        const size_t            i        = alone[a];
+        const size_t            planWork = execPlans[i].workBufSize * 2 * plans[i]->base_type_size;
+        char*                   work     = static_cast<char*>(group.work.data());
+        rocfft_execution_info_t planInfo = *info;
+        planInfo.rocfft_stream           = group.streams[schedule.aloneStream[a]];
+        planInfo.workBuffer              = work + schedule.workOffset[a];
+        planInfo.workBufferSize          = planWork;
+        planInfo.backend                 = rocfft_backend_device;
+
+        void** out = (plans[i]->placement == rocfft_placement_inplace) ? in_buffers[i]
+                                                                        : out_buffers[i];
+        TransformPowX(execPlans[i], in_buffers[i], out, &planInfo);
+    }
+
+    for(size_t s = 0; s < schedule.streams; ++s)
+    {
+        runtime.event_record(group.done[s], group.streams[s]);
+        runtime.stream_wait_event(stream, group.done[s]);
+    }
+    runtime.event_record(group.idle, stream);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execute_grouped_schedule_internal(size_t            count,
+                                                       const rocfft_plan plans[],
+                                                       size_t*           launches,
+                                                       size_t*           streams)
+{
+    std::vector<ExecPlan> execPlans;
+    const rocfft_status   status = CheckGroup(count, plans, nullptr, nullptr, nullptr, execPlans);
+    if(status != rocfft_status_success)
+        return status;
+
+    const GroupSchedule schedule(count, plans, execPlans);
+    *launches = schedule.shared.size() + schedule.alone.size();
+    *streams  = schedule.streams;
+    return rocfft_status_success;
+}
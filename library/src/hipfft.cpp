@@ -26,6 +26,9 @@
 #include "rocfft.h"
 #include "transform.h"
 #include "tree_node.h"
+#include <limits>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #define ROC_FFT_CHECK_ALLOC_FAILED(ret)  \
@@ -44,6 +47,14 @@
         }                                \
     }
 
+#define ROC_FFT_CHECK_INVALID_SIZE(ret)  \
+    {                                    \
+        if(ret != rocfft_status_success) \
+        {                                \
+            return HIPFFT_INVALID_SIZE;  \
+        }                                \
+    }
+
 #define ROC_FFT_CHECK_EXEC_FAILED(ret)   \
     {                                    \
         if(ret != rocfft_status_success) \
@@ -67,8 +78,14 @@ struct hipfftHandle_t
     rocfft_plan           ip_inverse;
     rocfft_plan           op_inverse;
     rocfft_execution_info info;
-    void*                 workBuffer;
-    bool                  autoAllocate;
+    // only recorded: without a work area rocFFT lends one from its pool
+    bool autoAllocate;
+    // kind of transform the plan was made for
+    hipfftType type;
+    // the rocFFT plans described for the type, and whether each has
+    // been built; a plan is only built on its first execution
+    std::map<rocfft_plan, bool> variants;
+    std::mutex                  variantsMutex;
 
     hipfftHandle_t()
         : ip_forward(nullptr)
@@ -76,8 +93,8 @@ struct hipfftHandle_t
         , ip_inverse(nullptr)
         , op_inverse(nullptr)
         , info(nullptr)
-        , workBuffer(nullptr)
         , autoAllocate(true)
+        , type(HIPFFT_C2C)
     {
     }
 };
@@ -138,10 +155,46 @@ hipfftResult hipfftPlanMany(hipfftHandle* plan,
         *plan, rank, n, inembed, istride, idist, onembed, ostride, odist, type, batch, nullptr);
 }
 
+// Returns the precision implied by a (non-Xt) hipfftType
+static rocfft_precision hipfftTypePrecision(hipfftType type)
+{
+    switch(type)
+    {
+    case HIPFFT_D2Z:
+    case HIPFFT_Z2D:
+    case HIPFFT_Z2Z:
+        return rocfft_precision_double;
+    default:
+        return rocfft_precision_single;
+    }
+}
+
+// Returns the rocFFT plan for a direction and placement, building it
+// on its first execution; null if the plan's type has no such variant
+// or it could not be built
+static rocfft_plan hipfftGetVariant(hipfftHandle plan, bool forward, bool inplace)
+{
+    rocfft_plan variant = forward ? (inplace ? plan->ip_forward : plan->op_forward)
+                                  : (inplace ? plan->ip_inverse : plan->op_inverse);
+
+    std::lock_guard<std::mutex> lck(plan->variantsMutex);
+    auto                        it = plan->variants.find(variant);
+    if(it == plan->variants.end())
+        return nullptr;
+    if(!it->second)
+    {
+        if(rocfft_plan_build_internal(variant) != rocfft_status_success)
+            return nullptr;
+        it->second = true;
+    }
+    return variant;
+}
+
 hipfftResult hipfftMakePlan_internal(hipfftHandle            plan,
                                      size_t                  dim,
                                      size_t*                 lengths,
                                      hipfftType              type,
+                                     rocfft_precision        precision,
                                      size_t                  number_of_transforms,
                                      rocfft_plan_description desc,
                                      size_t*                 workSize,
@@ -149,200 +202,79 @@ hipfftResult hipfftMakePlan_internal(hipfftHandle            plan,
 {
     size_t workBufferSize = 0;
 
+    // describe a variant; building it waits for its first execution
+    auto describe = [&](rocfft_plan variant, rocfft_result_placement placement,
+                        rocfft_transform_type transformType) {
+        rocfft_status ret = rocfft_plan_describe_internal(variant,
+                                                          placement,
+                                                          transformType,
+                                                          precision,
+                                                          dim,
+                                                          lengths,
+                                                          number_of_transforms,
+                                                          desc);
+        if(ret == rocfft_status_success)
+            plan->variants[variant] = false;
+        return ret;
+    };
+
+    std::lock_guard<std::mutex> lck(plan->variantsMutex);
+    plan->variants.clear();
+
+    // the type only selects the kind of transform here; precision
+    // is passed separately so that the Xt API can request half
     switch(type)
     {
     case HIPFFT_R2C:
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->ip_forward,
-                                                                rocfft_placement_inplace,
-                                                                rocfft_transform_type_real_forward,
-                                                                rocfft_precision_single,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->op_forward,
-                                                                rocfft_placement_notinplace,
-                                                                rocfft_transform_type_real_forward,
-                                                                rocfft_precision_single,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        break;
-    case HIPFFT_C2R:
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->ip_inverse,
-                                                                rocfft_placement_inplace,
-                                                                rocfft_transform_type_real_inverse,
-                                                                rocfft_precision_single,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->op_inverse,
-                                                                rocfft_placement_notinplace,
-                                                                rocfft_transform_type_real_inverse,
-                                                                rocfft_precision_single,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        break;
-    case HIPFFT_C2C:
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->ip_forward,
-                                        rocfft_placement_inplace,
-                                        rocfft_transform_type_complex_forward,
-                                        rocfft_precision_single,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->op_forward,
-                                        rocfft_placement_notinplace,
-                                        rocfft_transform_type_complex_forward,
-                                        rocfft_precision_single,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->ip_inverse,
-                                        rocfft_placement_inplace,
-                                        rocfft_transform_type_complex_inverse,
-                                        rocfft_precision_single,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->op_inverse,
-                                        rocfft_placement_notinplace,
-                                        rocfft_transform_type_complex_inverse,
-                                        rocfft_precision_single,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        break;
-
     case HIPFFT_D2Z:
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->ip_forward,
-                                                                rocfft_placement_inplace,
-                                                                rocfft_transform_type_real_forward,
-                                                                rocfft_precision_double,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->op_forward,
-                                                                rocfft_placement_notinplace,
-                                                                rocfft_transform_type_real_forward,
-                                                                rocfft_precision_double,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->ip_forward, rocfft_placement_inplace, rocfft_transform_type_real_forward));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->op_forward, rocfft_placement_notinplace, rocfft_transform_type_real_forward));
         break;
+    case HIPFFT_C2R:
     case HIPFFT_Z2D:
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->ip_inverse,
-                                                                rocfft_placement_inplace,
-                                                                rocfft_transform_type_real_inverse,
-                                                                rocfft_precision_double,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_create_internal(plan->op_inverse,
-                                                                rocfft_placement_notinplace,
-                                                                rocfft_transform_type_real_inverse,
-                                                                rocfft_precision_double,
-                                                                dim,
-                                                                lengths,
-                                                                number_of_transforms,
-                                                                desc));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->ip_inverse, rocfft_placement_inplace, rocfft_transform_type_real_inverse));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->op_inverse, rocfft_placement_notinplace, rocfft_transform_type_real_inverse));
         break;
+    case HIPFFT_C2C:
     case HIPFFT_Z2Z:
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->ip_forward,
-                                        rocfft_placement_inplace,
-                                        rocfft_transform_type_complex_forward,
-                                        rocfft_precision_double,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->op_forward,
-                                        rocfft_placement_notinplace,
-                                        rocfft_transform_type_complex_forward,
-                                        rocfft_precision_double,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->ip_inverse,
-                                        rocfft_placement_inplace,
-                                        rocfft_transform_type_complex_inverse,
-                                        rocfft_precision_double,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_create_internal(plan->op_inverse,
-                                        rocfft_placement_notinplace,
-                                        rocfft_transform_type_complex_inverse,
-                                        rocfft_precision_double,
-                                        dim,
-                                        lengths,
-                                        number_of_transforms,
-                                        desc));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->ip_forward, rocfft_placement_inplace, rocfft_transform_type_complex_forward));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->op_forward, rocfft_placement_notinplace, rocfft_transform_type_complex_forward));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->ip_inverse, rocfft_placement_inplace, rocfft_transform_type_complex_inverse));
+        ROC_FFT_CHECK_INVALID_VALUE(describe(
+            plan->op_inverse, rocfft_placement_notinplace, rocfft_transform_type_complex_inverse));
         break;
     default:
         return HIPFFT_PARSE_ERROR;
     }
+    plan->type = type;
 
-    size_t tmpBufferSize = 0;
-    if(plan->ip_forward)
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_get_work_buffer_size(plan->ip_forward, &tmpBufferSize));
-        workBufferSize = std::max(workBufferSize, tmpBufferSize);
-    }
-    if(plan->op_forward)
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_get_work_buffer_size(plan->op_forward, &tmpBufferSize));
-        workBufferSize = std::max(workBufferSize, tmpBufferSize);
-    }
-    if(plan->ip_inverse)
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_get_work_buffer_size(plan->ip_inverse, &tmpBufferSize));
-        workBufferSize = std::max(workBufferSize, tmpBufferSize);
-    }
-    if(plan->op_inverse)
+    // the caller only wants the description
+    if(dry_run)
+        return HIPFFT_SUCCESS;
+
+    // the work size comes from each variant's tree, without building
+    // the variant on the device; sizes that have no tree fail here
+    // rather than on first execution
+    for(const auto& variant : plan->variants)
     {
-        ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_plan_get_work_buffer_size(plan->op_inverse, &tmpBufferSize));
+        size_t tmpBufferSize = 0;
+        ROC_FFT_CHECK_INVALID_SIZE(
+            rocfft_plan_estimate_work_buffer_size_internal(variant.first, &tmpBufferSize));
         workBufferSize = std::max(workBufferSize, tmpBufferSize);
     }
 
+    // no work area until the caller sets one, so rocFFT lends one
+    // from its pool for the stream
     if(workBufferSize > 0)
-    {
-        if(plan->autoAllocate)
-        {
-            if(plan->workBuffer)
-                if(hipFree(plan->workBuffer) != hipSuccess)
-                    return HIPFFT_ALLOC_FAILED;
-            if(hipMalloc(&plan->workBuffer, workBufferSize) != hipSuccess)
-                return HIPFFT_ALLOC_FAILED;
-        }
         ROC_FFT_CHECK_INVALID_VALUE(
-            rocfft_execution_info_set_work_buffer(plan->info, plan->workBuffer, workBufferSize));
-    }
+            rocfft_execution_info_set_work_buffer(plan->info, nullptr, workBufferSize));
 
     if(workSize != nullptr)
         *workSize = workBufferSize;
@@ -370,8 +302,15 @@ hipfftResult
     size_t                  number_of_transforms = batch;
     rocfft_plan_description desc                 = nullptr;
 
-    return hipfftMakePlan_internal(
-        plan, 1, lengths, type, number_of_transforms, desc, workSize, false);
+    return hipfftMakePlan_internal(plan,
+                                   1,
+                                   lengths,
+                                   type,
+                                   hipfftTypePrecision(type),
+                                   number_of_transforms,
+                                   desc,
+                                   workSize,
+                                   false);
 }
 
 /*! \brief Assume hipfftCreate has been called. Creates a 2D FFT plan
@@ -391,8 +330,15 @@ hipfftResult hipfftMakePlan2d(hipfftHandle plan, int nx, int ny, hipfftType type
     size_t                  number_of_transforms = 1;
     rocfft_plan_description desc                 = nullptr;
 
-    return hipfftMakePlan_internal(
-        plan, 2, lengths, type, number_of_transforms, desc, workSize, false);
+    return hipfftMakePlan_internal(plan,
+                                   2,
+                                   lengths,
+                                   type,
+                                   hipfftTypePrecision(type),
+                                   number_of_transforms,
+                                   desc,
+                                   workSize,
+                                   false);
 }
 
 /*! \brief Assume hipfftCreate has been called. Creates a 3D FFT plan
@@ -414,8 +360,15 @@ hipfftResult
     size_t                  number_of_transforms = 1;
     rocfft_plan_description desc                 = nullptr;
 
-    return hipfftMakePlan_internal(
-        plan, 3, lengths, type, number_of_transforms, desc, workSize, false);
+    return hipfftMakePlan_internal(plan,
+                                   3,
+                                   lengths,
+                                   type,
+                                   hipfftTypePrecision(type),
+                                   number_of_transforms,
+                                   desc,
+                                   workSize,
+                                   false);
 }
 
 /*! \brief
@@ -461,20 +414,24 @@ hipfftResult
 
     batch 	    number of transforms
  */
-hipfftResult hipfftMakePlanMany(hipfftHandle plan,
-                                int          rank,
-                                int*         n,
-                                int*         inembed,
-                                int          istride,
-                                int          idist,
-                                int*         onembed,
-                                int          ostride,
-                                int          odist,
-                                hipfftType   type,
-                                int          batch,
-                                size_t*      workSize)
+static hipfftResult hipfftMakePlanMany_internal(hipfftHandle     plan,
+                                                int              rank,
+                                                int*             n,
+                                                int*             inembed,
+                                                int              istride,
+                                                int              idist,
+                                                int*             onembed,
+                                                int              ostride,
+                                                int              odist,
+                                                hipfftType       type,
+                                                rocfft_precision precision,
+                                                int              batch,
+                                                size_t*          workSize)
 {
-    size_t lengths[3];
+    if(rank < 1 || rank > MAX_PLAN_RANK)
+        return HIPFFT_INVALID_SIZE;
+
+    size_t lengths[MAX_PLAN_RANK];
     for(size_t i = 0; i < rank; i++)
         lengths[i] = n[rank - 1 - i];
 
@@ -485,13 +442,13 @@ hipfftResult hipfftMakePlanMany(hipfftHandle plan,
     {
         rocfft_plan_description_create(&desc);
 
-        size_t i_strides[3] = {1, 1, 1};
-        size_t o_strides[3] = {1, 1, 1};
+        size_t i_strides[MAX_PLAN_RANK] = {1};
+        size_t o_strides[MAX_PLAN_RANK] = {1};
 
         // pre-fetch the default params in case one of inembed and onembed
         // is NULL
         hipfftMakePlan_internal(
-            plan, rank, lengths, type, number_of_transforms, nullptr, workSize, true);
+            plan, rank, lengths, type, precision, number_of_transforms, nullptr, workSize, true);
 
         if(inembed == nullptr) // restore the default strides
         {
@@ -502,7 +459,7 @@ hipfftResult hipfftMakePlanMany(hipfftHandle plan,
         {
             i_strides[0] = istride;
 
-            size_t inembed_lengths[3];
+            size_t inembed_lengths[MAX_PLAN_RANK];
             for(size_t i = 0; i < rank; i++)
                 inembed_lengths[i] = inembed[rank - 1 - i];
 
@@ -519,7 +476,7 @@ hipfftResult hipfftMakePlanMany(hipfftHandle plan,
         {
             o_strides[0] = ostride;
 
-            size_t onembed_lengths[3];
+            size_t onembed_lengths[MAX_PLAN_RANK];
             for(size_t i = 0; i < rank; i++)
                 onembed_lengths[i] = onembed[rank - 1 - i];
 
@@ -562,13 +519,41 @@ hipfftResult hipfftMakePlanMany(hipfftHandle plan,
     }
 
     hipfftResult ret = hipfftMakePlan_internal(
-        plan, rank, lengths, type, number_of_transforms, desc, workSize, false);
+        plan, rank, lengths, type, precision, number_of_transforms, desc, workSize, false);
 
     ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_description_destroy(desc));
 
     return ret;
 }
 
+hipfftResult hipfftMakePlanMany(hipfftHandle plan,
+                                int          rank,
+                                int*         n,
+                                int*         inembed,
+                                int          istride,
+                                int          idist,
+                                int*         onembed,
+                                int          ostride,
+                                int          odist,
+                                hipfftType   type,
+                                int          batch,
+                                size_t*      workSize)
+{
+    return hipfftMakePlanMany_internal(plan,
+                                       rank,
+                                       n,
+                                       inembed,
+                                       istride,
+                                       idist,
+                                       onembed,
+                                       ostride,
+                                       odist,
+                                       type,
+                                       hipfftTypePrecision(type),
+                                       batch,
+                                       workSize);
+}
+
 hipfftResult hipfftMakePlanMany64(hipfftHandle   plan,
                                   int            rank,
                                   long long int* n,
@@ -660,19 +645,8 @@ hipfftResult hipfftCreate(hipfftHandle* plan)
 
 hipfftResult hipfftGetSize_internal(hipfftHandle plan, hipfftType type, size_t* workSize)
 {
-
-    if(type == HIPFFT_C2C || type == HIPFFT_Z2Z) // TODO
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_get_work_buffer_size(plan->op_forward, workSize));
-    }
-    else if(type == HIPFFT_C2R || type == HIPFFT_Z2D)
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_get_work_buffer_size(plan->op_forward, workSize));
-    }
-    else // R2C or D2Z
-    {
-        ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_get_work_buffer_size(plan->op_forward, workSize));
-    }
+    // every variant of the plan shares one work area
+    *workSize = plan->info->workBufferSize;
 
     return HIPFFT_SUCCESS;
 }
@@ -754,7 +728,7 @@ hipfftResult hipfftGetSizeMany(hipfftHandle plan,
     hipfftHandle p;
     HIP_FFT_CHECK_AND_RETURN(
         hipfftPlanMany(&p, rank, n, inembed, istride, idist, onembed, ostride, odist, type, batch));
-    ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_get_work_buffer_size(p->ip_forward, workSize));
+    *workSize = p->info->workBufferSize;
     HIP_FFT_CHECK_AND_RETURN(hipfftDestroy(p));
 
     return HIPFFT_SUCCESS;
@@ -804,6 +778,136 @@ hipfftResult hipfftSetAutoAllocation(hipfftHandle plan, int autoAllocate)
 
 /*============================================================================================*/
 
+// Whether a 64-bit plan parameter survives narrowing to the int the
+// plan is built from
+static bool fits_int(long long int v)
+{
+    return v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max();
+}
+
+/*! \brief
+    Creates a plan from explicit input, output and execution data
+   types.  This is the only way to create a half-precision plan.
+ */
+hipfftResult hipfftXtMakePlanMany(hipfftHandle   plan,
+                                  int            rank,
+                                  long long int* n,
+                                  long long int* inembed,
+                                  long long int  istride,
+                                  long long int  idist,
+                                  hipfftDataType inputtype,
+                                  long long int* onembed,
+                                  long long int  ostride,
+                                  long long int  odist,
+                                  hipfftDataType outputtype,
+                                  long long int  batch,
+                                  size_t*        workSize,
+                                  hipfftDataType executiontype)
+{
+    if(rank < 1 || rank > MAX_PLAN_RANK)
+        return HIPFFT_INVALID_SIZE;
+
+    // execution type must be the complex type of the transform's precision
+    rocfft_precision precision;
+    hipfftDataType   realtype;
+    switch(executiontype)
+    {
+    case HIPFFT_C_16F:
+        precision = rocfft_precision_half;
+        realtype  = HIPFFT_R_16F;
+        break;
+    case HIPFFT_C_32F:
+        precision = rocfft_precision_single;
+        realtype  = HIPFFT_R_32F;
+        break;
+    case HIPFFT_C_64F:
+        precision = rocfft_precision_double;
+        realtype  = HIPFFT_R_64F;
+        break;
+    default:
+        return HIPFFT_INVALID_TYPE;
+    }
+
+    // work out the kind of transform from the input and output types
+    hipfftType type;
+    if(inputtype == executiontype && outputtype == executiontype)
+        type = HIPFFT_C2C;
+    else if(inputtype == realtype && outputtype == executiontype)
+        type = HIPFFT_R2C;
+    else if(inputtype == executiontype && outputtype == realtype)
+        type = HIPFFT_C2R;
+    else
+        return HIPFFT_INVALID_TYPE;
+
+    if(!fits_int(istride) || !fits_int(idist) || !fits_int(ostride) || !fits_int(odist)
+       || !fits_int(batch))
+        return HIPFFT_INVALID_SIZE;
+
+    int n_int[MAX_PLAN_RANK], inembed_int[MAX_PLAN_RANK], onembed_int[MAX_PLAN_RANK];
+    for(int i = 0; i < rank; ++i)
+    {
+        if(!fits_int(n[i]) || (inembed && !fits_int(inembed[i]))
+           || (onembed && !fits_int(onembed[i])))
+            return HIPFFT_INVALID_SIZE;
+        n_int[i] = n[i];
+        if(inembed)
+            inembed_int[i] = inembed[i];
+        if(onembed)
+            onembed_int[i] = onembed[i];
+    }
+
+    return hipfftMakePlanMany_internal(plan,
+                                       rank,
+                                       n_int,
+                                       inembed ? inembed_int : nullptr,
+                                       istride,
+                                       idist,
+                                       onembed ? onembed_int : nullptr,
+                                       ostride,
+                                       odist,
+                                       type,
+                                       precision,
+                                       batch,
+                                       workSize);
+}
+
+/*! \brief
+    executes a plan created with hipfftXtMakePlanMany.  direction is
+   ignored for real-to-complex and complex-to-real plans.
+ */
+hipfftResult hipfftXtExec(hipfftHandle plan, void* input, void* output, int direction)
+{
+    void* in[1];
+    in[0] = input;
+
+    void* out[1];
+    out[0] = output;
+
+    bool forward;
+    switch(plan->type)
+    {
+    case HIPFFT_R2C:
+    case HIPFFT_D2Z:
+        forward = true;
+        break;
+    case HIPFFT_C2R:
+    case HIPFFT_Z2D:
+        forward = false;
+        break;
+    default:
+        if(direction != HIPFFT_FORWARD && direction != HIPFFT_BACKWARD)
+            return HIPFFT_INVALID_VALUE;
+        forward = direction == HIPFFT_FORWARD;
+    }
+
+    rocfft_plan variant = hipfftGetVariant(plan, forward, input == output);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
+
+    return HIPFFT_SUCCESS;
+}
+
 /*! \brief
     executes a single-precision complex-to-complex transform plan in the
    transform direction as specified by direction parameter.
@@ -819,16 +923,10 @@ hipfftResult
     void* out[1];
     out[0] = (void*)odata;
 
-    if(direction == HIPFFT_FORWARD)
-    {
-        ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(
-            idata == odata ? plan->ip_forward : plan->op_forward, in, out, plan->info));
-    }
-    else
-    {
-        ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(
-            idata == odata ? plan->ip_inverse : plan->op_inverse, in, out, plan->info));
-    }
+    rocfft_plan variant = hipfftGetVariant(plan, direction == HIPFFT_FORWARD, idata == odata);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -845,8 +943,10 @@ hipfftResult hipfftExecR2C(hipfftHandle plan, hipfftReal* idata, hipfftComplex*
     void* out[1];
     out[0] = (void*)odata;
 
-    ROC_FFT_CHECK_EXEC_FAILED(
-        rocfft_execute(in[0] == out[0] ? plan->ip_forward : plan->op_forward, in, out, plan->info));
+    rocfft_plan variant = hipfftGetVariant(plan, true, in[0] == out[0]);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -863,8 +963,10 @@ hipfftResult hipfftExecC2R(hipfftHandle plan, hipfftComplex* idata, hipfftReal*
     void* out[1];
     out[0] = (void*)odata;
 
-    ROC_FFT_CHECK_EXEC_FAILED(
-        rocfft_execute(in[0] == out[0] ? plan->ip_inverse : plan->op_inverse, in, out, plan->info));
+    rocfft_plan variant = hipfftGetVariant(plan, false, in[0] == out[0]);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -887,16 +989,10 @@ hipfftResult hipfftExecZ2Z(hipfftHandle         plan,
     void* out[1];
     out[0] = (void*)odata;
 
-    if(direction == HIPFFT_FORWARD)
-    {
-        ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(
-            idata == odata ? plan->ip_forward : plan->op_forward, in, out, plan->info));
-    }
-    else
-    {
-        ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(
-            idata == odata ? plan->ip_inverse : plan->op_inverse, in, out, plan->info));
-    }
+    rocfft_plan variant = hipfftGetVariant(plan, direction == HIPFFT_FORWARD, idata == odata);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -913,8 +1009,10 @@ hipfftResult hipfftExecD2Z(hipfftHandle plan, hipfftDoubleReal* idata, hipfftDou
     void* out[1];
     out[0] = (void*)odata;
 
-    ROC_FFT_CHECK_EXEC_FAILED(
-        rocfft_execute(in[0] == out[0] ? plan->ip_forward : plan->op_forward, in, out, plan->info));
+    rocfft_plan variant = hipfftGetVariant(plan, true, in[0] == out[0]);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -928,8 +1026,10 @@ hipfftResult hipfftExecZ2D(hipfftHandle plan, hipfftDoubleComplex* idata, hipfft
     void* out[1];
     out[0] = (void*)odata;
 
-    ROC_FFT_CHECK_EXEC_FAILED(
-        rocfft_execute(in[0] == out[0] ? plan->ip_inverse : plan->op_inverse, in, out, plan->info));
+    rocfft_plan variant = hipfftGetVariant(plan, false, in[0] == out[0]);
+    if(variant == nullptr)
+        return HIPFFT_EXEC_FAILED;
+    ROC_FFT_CHECK_EXEC_FAILED(rocfft_execute(variant, in, out, plan->info));
 
     return HIPFFT_SUCCESS;
 }
@@ -970,9 +1070,6 @@ hipfftResult hipfftDestroy(hipfftHandle plan)
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_destroy(plan->ip_inverse));
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_plan_destroy(plan->op_inverse));
 
-        if(plan->autoAllocate)
-            hipFree(plan->workBuffer);
-
         ROC_FFT_CHECK_INVALID_VALUE(rocfft_execution_info_destroy(plan->info));
 
         delete plan;
@@ -0,0 +1,1449 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "host_kernels.h"
+#include "kernel_launch.h"
+#include "radix_table.h"
+#include "rocfft_butterfly_host.h"
+
+// Host implementations of the leaf kernels.  Each one reproduces the
+// indexing of its device counterpart, but walks every dimension with
+// its own stride where the device kernels assume contiguous higher
+// dimensions.
+
+namespace
+{
+    // Complex value the host kernels compute with.  The generated
+    // butterflies need .x/.y, a two-real constructor, the compound
+    // operators and multiplication by a real of any type.
+    template <typename Treal>
+    struct hcomplex
+    {
+        Treal x, y;
+
+        hcomplex() = default;
+        hcomplex(Treal re, Treal im)
+            : x(re)
+            , y(im)
+        {
+        }
+
+        hcomplex& operator+=(const hcomplex& b)
+        {
+            x += b.x;
+            y += b.y;
+            return *this;
+        }
+        hcomplex& operator-=(const hcomplex& b)
+        {
+            x -= b.x;
+            y -= b.y;
+            return *this;
+        }
+        hcomplex& operator*=(Treal s)
+        {
+            x *= s;
+            y *= s;
+            return *this;
+        }
+        hcomplex operator-() const
+        {
+            return hcomplex(-x, -y);
+        }
+    };
+
+    template <typename Treal>
+    hcomplex<Treal> operator+(const hcomplex<Treal>& a, const hcomplex<Treal>& b)
+    {
+        return hcomplex<Treal>(a.x + b.x, a.y + b.y);
+    }
+
+    template <typename Treal>
+    hcomplex<Treal> operator-(const hcomplex<Treal>& a, const hcomplex<Treal>& b)
+    {
+        return hcomplex<Treal>(a.x - b.x, a.y - b.y);
+    }
+
+    template <typename Treal, typename Tscalar>
+    hcomplex<Treal> operator*(Tscalar s, const hcomplex<Treal>& a)
+    {
+        return hcomplex<Treal>(static_cast<Treal>(s) * a.x, static_cast<Treal>(s) * a.y);
+    }
+
+    template <typename Treal>
+    hcomplex<Treal> operator*(const hcomplex<Treal>& a, Treal s)
+    {
+        return hcomplex<Treal>(s * a.x, s * a.y);
+    }
+
+    // a * b, where b may hold plain reals when a holds hsimd lanes
+    template <typename Ta, typename Tb>
+    hcomplex<Ta> cmul(const hcomplex<Ta>& a, const hcomplex<Tb>& b)
+    {
+        return hcomplex<Ta>(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+    }
+
+    // W reals of one precision, one per row of a group of rows that
+    // are transformed together.  hcomplex<hsimd> keeps the real and
+    // imaginary parts of the group in separate vectors, so the
+    // generated butterflies run on W rows at once unchanged.
+    template <typename Treal, size_t W>
+    struct hsimd
+    {
+        // element-aligned, since std::vector does not honour wider
+        // alignments before C++17
+        typedef Treal vec_t
+            __attribute__((vector_size(W * sizeof(Treal)), aligned(sizeof(Treal))));
+
+        vec_t v;
+
+        hsimd() = default;
+        hsimd(Treal s)
+            : v(vec_t{} + s)
+        {
+        }
+
+        Treal lane(size_t l) const
+        {
+            return v[l];
+        }
+        void set_lane(size_t l, Treal s)
+        {
+            v[l] = s;
+        }
+
+        hsimd& operator+=(const hsimd& b)
+        {
+            v += b.v;
+            return *this;
+        }
+        hsimd& operator-=(const hsimd& b)
+        {
+            v -= b.v;
+            return *this;
+        }
+        hsimd& operator*=(const hsimd& b)
+        {
+            v *= b.v;
+            return *this;
+        }
+        hsimd operator-() const
+        {
+            hsimd r;
+            r.v = -v;
+            return r;
+        }
+
+        friend hsimd operator+(hsimd a, const hsimd& b)
+        {
+            return a += b;
+        }
+        friend hsimd operator-(hsimd a, const hsimd& b)
+        {
+            return a -= b;
+        }
+        friend hsimd operator*(hsimd a, const hsimd& b)
+        {
+            return a *= b;
+        }
+    };
+
+    // a * conj(b)
+    template <typename Treal>
+    hcomplex<Treal> cmul_conj(const hcomplex<Treal>& a, const hcomplex<Treal>& b)
+    {
+        return hcomplex<Treal>(a.x * b.x + a.y * b.y, -a.x * b.y + a.y * b.x);
+    }
+
+    // exp(direction * 2 * pi * i * k / N), computed in double
+    template <typename Treal>
+    hcomplex<Treal> host_twiddle(size_t N, size_t k, int direction)
+    {
+        const double angle = 2.0 * M_PI * static_cast<double>(k % N) / static_cast<double>(N);
+        return hcomplex<Treal>(static_cast<Treal>(std::cos(angle)),
+                               static_cast<Treal>(direction * std::sin(angle)));
+    }
+
+    // One operand of a kernel, in units of its elements: interleaved
+    // or planar complex, or real when there is no imaginary part.
+    template <typename Tstore, typename Treal>
+    struct HostArray
+    {
+        Tstore* re   = nullptr;
+        Tstore* im   = nullptr;
+        size_t  step = 2; // distance between consecutive elements' parts
+
+        hcomplex<Treal> load(size_t i) const
+        {
+            return hcomplex<Treal>(static_cast<Treal>(re[i * step]),
+                                   im ? static_cast<Treal>(im[i * step]) : Treal(0));
+        }
+        void store(size_t i, const hcomplex<Treal>& v) const
+        {
+            re[i * step] = static_cast<Tstore>(v.x);
+            if(im)
+                im[i * step] = static_cast<Tstore>(v.y);
+        }
+        HostArray offset(size_t elems) const
+        {
+            HostArray a = *this;
+            a.re += elems * step;
+            if(a.im)
+                a.im += elems * step;
+            return a;
+        }
+    };
+
+    // Complex view of a node buffer; like the device kernels, anything
+    // that is not planar is read as interleaved
+    template <typename Tstore, typename Treal>
+    HostArray<Tstore, Treal> complex_array(void* const buf[2], rocfft_array_type type)
+    {
+        HostArray<Tstore, Treal> a;
+        a.re = static_cast<Tstore*>(buf[0]);
+        if(type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar)
+        {
+            a.im   = static_cast<Tstore*>(buf[1]);
+            a.step = 1;
+        }
+        else
+            a.im = a.re + 1;
+        return a;
+    }
+
+    template <typename Tstore, typename Treal>
+    HostArray<Tstore, Treal> real_array(void* buf)
+    {
+        HostArray<Tstore, Treal> a;
+        a.re   = static_cast<Tstore*>(buf);
+        a.step = 1;
+        return a;
+    }
+
+    // Enumerates the rows a kernel works on: every combination of
+    // indices of some of the node's dimensions and of the batch, with
+    // the input and output offsets of each.  Earlier dimensions vary
+    // fastest.
+    struct HostRows
+    {
+        std::vector<size_t> lengths, iStrides, oStrides;
+        size_t              count = 1;
+
+        void add(size_t length, size_t iStride, size_t oStride)
+        {
+            lengths.push_back(length);
+            iStrides.push_back(iStride);
+            oStrides.push_back(oStride);
+            count *= length;
+        }
+
+        void offsets(size_t row, size_t& iOffset, size_t& oOffset) const
+        {
+            iOffset = 0;
+            oOffset = 0;
+            for(size_t d = 0; d < lengths.size(); ++d)
+            {
+                const size_t index = row % lengths[d];
+                row /= lengths[d];
+                iOffset += index * iStrides[d];
+                oOffset += index * oStrides[d];
+            }
+        }
+    };
+
+    // Rows over the node's dimensions from 'first' on, except 'skip',
+    // then the batch
+    HostRows node_rows(const TreeNode&            node,
+                       size_t                     first,
+                       const std::vector<size_t>& iStride,
+                       size_t                     iDist,
+                       const std::vector<size_t>& oStride,
+                       size_t                     oDist,
+                       size_t                     skip = SIZE_MAX)
+    {
+        HostRows rows;
+        for(size_t d = first; d < node.length.size(); ++d)
+        {
+            if(d != skip)
+                rows.add(node.length[d], iStride[d], oStride[d]);
+        }
+        rows.add(node.batch, iDist, oDist);
+        return rows;
+    }
+
+    // Run fn(begin, end) over [0, count) split across the host's
+    // hardware threads.  Small jobs stay on the calling thread, where
+    // starting threads would cost more than it saves.
+    template <typename Tfn>
+    void parallel_for(size_t count, size_t cost_per_item, Tfn fn)
+    {
+        // elements of work that are worth a thread of their own
+        static const size_t min_thread_cost = 1 << 15;
+        static const size_t max_threads
+            = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        const size_t nthreads = std::min(
+            {max_threads, count, std::max<size_t>(1, count * cost_per_item / min_thread_cost)});
+        if(nthreads <= 1)
+        {
+            fn(size_t(0), count);
+            return;
+        }
+
+        const size_t             chunk = (count + nthreads - 1) / nthreads;
+        std::vector<std::thread> threads;
+        for(size_t begin = chunk; begin < count; begin += chunk)
+            threads.emplace_back(fn, begin, std::min(count, begin + chunk));
+        fn(size_t(0), chunk);
+        for(auto& t : threads)
+            t.join();
+    }
+
+    // Generated butterfly for the radix, in place on v[0..radix).
+    // Returns false for radices without one.
+    template <typename T>
+    bool butterfly(size_t radix, bool forward, T* v)
+    {
+        using namespace host_butterfly;
+        switch(radix)
+        {
+        case 2:
+            forward ? FwdRad2B1(v, v + 1) : InvRad2B1(v, v + 1);
+            return true;
+        case 3:
+            forward ? FwdRad3B1(v, v + 1, v + 2) : InvRad3B1(v, v + 1, v + 2);
+            return true;
+        case 4:
+            forward ? FwdRad4B1(v, v + 1, v + 2, v + 3) : InvRad4B1(v, v + 1, v + 2, v + 3);
+            return true;
+        case 5:
+            forward ? FwdRad5B1(v, v + 1, v + 2, v + 3, v + 4)
+                    : InvRad5B1(v, v + 1, v + 2, v + 3, v + 4);
+            return true;
+        case 6:
+            forward ? FwdRad6B1(v, v + 1, v + 2, v + 3, v + 4, v + 5)
+                    : InvRad6B1(v, v + 1, v + 2, v + 3, v + 4, v + 5);
+            return true;
+        case 7:
+            forward ? FwdRad7B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6)
+                    : InvRad7B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6);
+            return true;
+        case 8:
+            forward ? FwdRad8B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6, v + 7)
+                    : InvRad8B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6, v + 7);
+            return true;
+        case 10:
+            forward ? FwdRad10B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6, v + 7, v + 8, v + 9)
+                    : InvRad10B1(v, v + 1, v + 2, v + 3, v + 4, v + 5, v + 6, v + 7, v + 8, v + 9);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Stockham autosort FFT of one length.  Lengths factor over the
+    // radices with generated butterflies; any other prime factor is
+    // done as a direct DFT.
+    template <typename Treal>
+    class HostFFT
+    {
+        using complex_t = hcomplex<Treal>;
+
+        size_t                 length;
+        int                    direction;
+        std::vector<size_t>    radices;
+        size_t                 maxRadix = 1;
+        std::vector<complex_t> twiddles; // exp(direction * 2 * pi * i * k / length)
+
+    public:
+        HostFFT(size_t N, int dir)
+            : length(N)
+            , direction(dir)
+        {
+            size_t remaining = N;
+            for(auto radix : HostButterflyRadices())
+            {
+                while(remaining % radix == 0)
+                {
+                    radices.push_back(radix);
+                    remaining /= radix;
+                }
+            }
+            for(size_t factor = 2; remaining > 1; ++factor)
+            {
+                while(remaining % factor == 0)
+                {
+                    radices.push_back(factor);
+                    remaining /= factor;
+                }
+            }
+            for(auto radix : radices)
+                maxRadix = std::max(maxRadix, radix);
+
+            twiddles.reserve(N);
+            for(size_t k = 0; k < N; ++k)
+                twiddles.push_back(host_twiddle<Treal>(N, k, direction));
+        }
+
+        // elements of scratch space operator() needs
+        size_t work_size() const
+        {
+            return length + 2 * maxRadix;
+        }
+
+        // transform 'data' in place; Tcomplex is complex_t, or an
+        // hcomplex of hsimd lanes to transform one row per lane
+        template <typename Tcomplex>
+        void operator()(Tcomplex* data, Tcomplex* work) const
+        {
+            Tcomplex* x   = data;
+            Tcomplex* y   = work;
+            Tcomplex* v   = work + length;
+            Tcomplex* dft = v + maxRadix;
+
+            size_t Ns = 1;
+            for(auto radix : radices)
+            {
+                const size_t stride  = length / radix;
+                const size_t twStep  = length / (Ns * radix);
+                const size_t dftStep = length / radix;
+                for(size_t j = 0; j < stride; ++j)
+                {
+                    const size_t k = j % Ns;
+                    for(size_t r = 0; r < radix; ++r)
+                        v[r] = x[j + r * stride];
+                    if(k != 0)
+                    {
+                        for(size_t r = 1; r < radix; ++r)
+                            v[r] = cmul(v[r], twiddles[r * k * twStep]);
+                    }
+
+                    if(!butterfly(radix, direction == -1, v))
+                    {
+                        for(size_t m = 0; m < radix; ++m)
+                        {
+                            Tcomplex sum = v[0];
+                            for(size_t n = 1; n < radix; ++n)
+                                sum += cmul(v[n], twiddles[(n * m % radix) * dftStep]);
+                            dft[m] = sum;
+                        }
+                        std::copy(dft, dft + radix, v);
+                    }
+
+                    const size_t base = (j / Ns) * Ns * radix + k;
+                    for(size_t r = 0; r < radix; ++r)
+                        y[base + r * Ns] = v[r];
+                }
+                std::swap(x, y);
+                Ns *= radix;
+            }
+            if(x != data)
+                std::copy(x, x + length, data);
+        }
+    };
+
+    // Plan for the FFT of one length and direction, shared by every
+    // call on that shape so that the twiddle table is built once.  The
+    // cache is emptied when it outgrows its bound; callers still
+    // holding a plan keep it alive.
+    template <typename Treal>
+    std::shared_ptr<const HostFFT<Treal>> cached_fft(size_t N, int direction)
+    {
+        typedef std::shared_ptr<const HostFFT<Treal>> plan_t;
+
+        static const size_t                              max_plans = 64;
+        static std::mutex                                mutex;
+        static std::map<std::pair<size_t, int>, plan_t> plans;
+
+        std::lock_guard<std::mutex> lck(mutex);
+        const auto                  key = std::make_pair(N, direction);
+        auto                        it  = plans.find(key);
+        if(it != plans.end())
+            return it->second;
+        if(plans.size() >= max_plans)
+            plans.clear();
+        plan_t plan = std::make_shared<HostFFT<Treal>>(N, direction);
+        plans.emplace(key, plan);
+        return plan;
+    }
+
+    // The FFTs of one fft_rows call: along dimension 'dim' of each
+    // of 'rows', then times the large 1D twiddle if 'large1D' is set
+    template <typename Tstore, typename Treal>
+    struct HostRowFFT
+    {
+        const TreeNode&                 node;
+        size_t                          dim;
+        const HostFFT<Treal>&           fft;
+        const HostRows&                 rows;
+        const HostArray<Tstore, Treal>& in;
+        const std::vector<size_t>&      iStride;
+        const HostArray<Tstore, Treal>& out;
+        const std::vector<size_t>&      oStride;
+        size_t                          large1D;
+
+        // store element k of the transformed row
+        void store(size_t row, size_t oOffset, size_t k, hcomplex<Treal> v) const
+        {
+            if(large1D)
+            {
+                const size_t b = row % node.length[1];
+                v = cmul(v, host_twiddle<Treal>(large1D, k * b, node.direction));
+            }
+            out.store(oOffset + k * oStride[dim], v);
+        }
+
+        // transform rows [begin, end) one at a time
+        void rows_scalar(size_t begin, size_t end) const
+        {
+            const size_t                 N = node.length[dim];
+            std::vector<hcomplex<Treal>> x(N), work(fft.work_size());
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                for(size_t k = 0; k < N; ++k)
+                    x[k] = in.load(iOffset + k * iStride[dim]);
+                fft(x.data(), work.data());
+                for(size_t k = 0; k < N; ++k)
+                    store(row, oOffset, k, x[k]);
+            }
+        }
+
+        // transform rows from 'begin' W at a time, one per hsimd lane,
+        // while W of them remain before 'end'; returns the first row
+        // left over
+        template <size_t W>
+        size_t rows_simd(size_t begin, size_t end) const
+        {
+            if(end - begin < W)
+                return begin;
+
+            const size_t                           N = node.length[dim];
+            std::vector<hcomplex<hsimd<Treal, W>>> x(N), work(fft.work_size());
+            size_t                                 iOffset[W], oOffset[W];
+            for(; end - begin >= W; begin += W)
+            {
+                for(size_t l = 0; l < W; ++l)
+                    rows.offsets(begin + l, iOffset[l], oOffset[l]);
+                for(size_t k = 0; k < N; ++k)
+                {
+                    for(size_t l = 0; l < W; ++l)
+                    {
+                        const auto v = in.load(iOffset[l] + k * iStride[dim]);
+                        x[k].x.set_lane(l, v.x);
+                        x[k].y.set_lane(l, v.y);
+                    }
+                }
+                fft(x.data(), work.data());
+                for(size_t k = 0; k < N; ++k)
+                {
+                    for(size_t l = 0; l < W; ++l)
+                        store(begin + l,
+                              oOffset[l],
+                              k,
+                              hcomplex<Treal>(x[k].x.lane(l), x[k].y.lane(l)));
+                }
+            }
+            return begin;
+        }
+    };
+
+    // Instruction sets rows_simd is compiled for.  The portable
+    // version uses 16-byte vectors, which any SIMD unit the compiler
+    // targets by default can hold.
+    enum class HostSimd
+    {
+        portable,
+        avx2,
+        avx512,
+    };
+
+    // widest of them the host supports
+    HostSimd host_simd()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        static const HostSimd isa = []() {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f"))
+                return HostSimd::avx512;
+            if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                return HostSimd::avx2;
+            return HostSimd::portable;
+        }();
+        return isa;
+#else
+        return HostSimd::portable;
+#endif
+    }
+
+    // rows_simd with vectors of the instruction set.  Flattening
+    // inlines the FFT and the generated butterflies, so that they are
+    // compiled for that instruction set too.
+#if defined(__x86_64__) || defined(__i386__)
+    template <typename Tstore, typename Treal>
+    __attribute__((target("avx512f"), flatten)) size_t
+        rows_avx512(const HostRowFFT<Tstore, Treal>& job, size_t begin, size_t end)
+    {
+        return job.template rows_simd<64 / sizeof(Treal)>(begin, end);
+    }
+
+    template <typename Tstore, typename Treal>
+    __attribute__((target("avx2,fma"), flatten)) size_t
+        rows_avx2(const HostRowFFT<Tstore, Treal>& job, size_t begin, size_t end)
+    {
+        return job.template rows_simd<32 / sizeof(Treal)>(begin, end);
+    }
+#endif
+
+    template <typename Tstore, typename Treal>
+    __attribute__((flatten)) size_t
+        rows_portable(const HostRowFFT<Tstore, Treal>& job, size_t begin, size_t end)
+    {
+        return job.template rows_simd<16 / sizeof(Treal)>(begin, end);
+    }
+
+    // FFTs along dimension 'dim' of every row of the node.  When
+    // 'large1D' is set, element k of the row with index b along
+    // dimension 1 is then multiplied by the large 1D twiddle
+    // exp(direction * 2 * pi * i * k * b / large1D).  Rows go through
+    // the widest SIMD instruction set of the host, several at a time,
+    // and any left over one at a time.
+    template <typename Tstore, typename Treal>
+    void fft_rows(const TreeNode&                 node,
+                  size_t                          dim,
+                  const HostArray<Tstore, Treal>& in,
+                  const std::vector<size_t>&      iStride,
+                  size_t                          iDist,
+                  const HostArray<Tstore, Treal>& out,
+                  const std::vector<size_t>&      oStride,
+                  size_t                          oDist,
+                  size_t                          large1D)
+    {
+        const size_t N    = node.length[dim];
+        const auto   fft  = cached_fft<Treal>(N, node.direction);
+        const auto   rows = node_rows(node, 0, iStride, iDist, oStride, oDist, dim);
+
+        const HostRowFFT<Tstore, Treal> job{
+            node, dim, *fft, rows, in, iStride, out, oStride, large1D};
+        parallel_for(rows.count, N, [&](size_t begin, size_t end) {
+            switch(host_simd())
+            {
+#if defined(__x86_64__) || defined(__i386__)
+            case HostSimd::avx512:
+                begin = rows_avx512(job, begin, end);
+                break;
+            case HostSimd::avx2:
+                begin = rows_avx2(job, begin, end);
+                break;
+#endif
+            default:
+                begin = rows_portable(job, begin, end);
+                break;
+            }
+            job.rows_scalar(begin, end);
+        });
+    }
+
+    // STOCKHAM, SBCC and SBRC: 1D FFTs along dimension 0, with any
+    // transposition expressed by the output strides.  In-place nodes
+    // write through the input layout, as the device kernels do.
+    template <typename Tstore, typename Treal>
+    void stockham_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node    = *data.node;
+        const bool      inplace = node.placement == rocfft_placement_inplace;
+        const auto      in      = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out
+            = inplace ? in : complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+
+        fft_rows(node,
+                 0,
+                 in,
+                 node.inStride,
+                 node.iDist,
+                 out,
+                 inplace ? node.inStride : node.outStride,
+                 inplace ? node.iDist : node.oDist,
+                 node.large1D);
+    }
+
+    // 2D_SINGLE and 3D_SINGLE: a 1D FFT along each dimension in turn,
+    // the first from the input and the rest in place on the output
+    template <typename Tstore, typename Treal>
+    void multi_dim_single_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node    = *data.node;
+        const bool      inplace = node.placement == rocfft_placement_inplace;
+        const auto      in      = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out
+            = inplace ? in : complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const auto& oStride = inplace ? node.inStride : node.outStride;
+        const auto  oDist   = inplace ? node.iDist : node.oDist;
+
+        const size_t dims = node.scheme == CS_KERNEL_3D_SINGLE ? 3 : 2;
+        fft_rows(node, 0, in, node.inStride, node.iDist, out, oStride, oDist, 0);
+        for(size_t dim = 1; dim < dims; ++dim)
+            fft_rows(node, dim, out, oStride, oDist, out, oStride, oDist, 0);
+    }
+
+    // TRANSPOSE, TRANSPOSE_XY_Z and TRANSPOSE_Z_XY.  Each moves element
+    // (c, r) of an n x m matrix per row of the remaining dimensions;
+    // a plain transpose also applies the large 1D twiddle when set.
+    template <typename Tstore, typename Treal>
+    void transpose_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        const auto      in   = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out  = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+
+        size_t n = node.length[0], m = node.length[1];
+        size_t inRowStride = node.inStride[1], outColStride = node.outStride[1];
+        size_t first = 2;
+        if(node.scheme == CS_KERNEL_TRANSPOSE_XY_Z)
+        {
+            n           = node.length[0] * node.length[1];
+            m           = node.length[2];
+            inRowStride = node.inStride[2];
+            first       = 3;
+        }
+        else if(node.scheme == CS_KERNEL_TRANSPOSE_Z_XY)
+        {
+            m            = node.length[1] * node.length[2];
+            outColStride = node.outStride[2];
+            first        = 3;
+        }
+        const size_t large1D = node.scheme == CS_KERNEL_TRANSPOSE ? node.large1D : 0;
+
+        const auto rows
+            = node_rows(node, first, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count * m, n, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+            {
+                const size_t r = i % m;
+                size_t       iOffset, oOffset;
+                rows.offsets(i / m, iOffset, oOffset);
+                for(size_t c = 0; c < n; ++c)
+                {
+                    auto v = in.load(iOffset + c * node.inStride[0] + r * inRowStride);
+                    if(large1D)
+                        v = cmul(v, host_twiddle<Treal>(large1D, c * r, node.direction));
+                    out.store(oOffset + c * outColStride + r * node.outStride[0], v);
+                }
+            }
+        });
+    }
+
+    // Element-wise copy of every row of length[0] elements, between
+    // the given views
+    template <typename Tstore, typename Treal>
+    void copy_rows(const TreeNode&                 node,
+                   size_t                          count,
+                   const HostArray<Tstore, Treal>& in,
+                   const HostArray<Tstore, Treal>& out)
+    {
+        const auto rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, count, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                for(size_t k = 0; k < count; ++k)
+                    out.store(oOffset + k * node.outStride[0],
+                              in.load(iOffset + k * node.inStride[0]));
+            }
+        });
+    }
+
+    template <typename Tstore, typename Treal>
+    void real2complex_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        copy_rows(node,
+                  node.length[0],
+                  real_array<Tstore, Treal>(data.bufIn[0]),
+                  complex_array<Tstore, Treal>(data.bufOut, node.outArrayType));
+    }
+
+    template <typename Tstore, typename Treal>
+    void complex2real_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        copy_rows(node,
+                  node.length[0],
+                  complex_array<Tstore, Treal>(data.bufIn, node.inArrayType),
+                  real_array<Tstore, Treal>(data.bufOut[0]));
+    }
+
+    template <typename Tstore, typename Treal>
+    void complex2hermitian_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        copy_rows(node,
+                  node.length[0] / 2 + 1,
+                  complex_array<Tstore, Treal>(data.bufIn, node.inArrayType),
+                  complex_array<Tstore, Treal>(data.bufOut, node.outArrayType));
+    }
+
+    // Expand Hermitian-symmetric rows of any number of dimensions to
+    // full complex rows, writing each element and its conjugate mirror
+    template <typename Tstore, typename Treal>
+    void hermitian2complex_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        const auto      in   = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out  = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+
+        const size_t len0 = node.length[0];
+        const size_t rows = std::accumulate(
+            node.length.begin() + 1, node.length.end(), size_t(1), std::multiplies<size_t>());
+        const size_t hermitian_size = len0 / 2 + 1;
+
+        parallel_for(rows * node.batch, hermitian_size, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                // straight and conjugate offsets along the higher dimensions
+                size_t counter = row;
+                size_t iOffset = 0, oOffset = 0, cOffset = 0;
+                for(size_t d = 1; d < node.length.size(); ++d)
+                {
+                    const size_t len = node.length[d];
+                    const size_t i   = counter % len;
+                    counter /= len;
+
+                    iOffset += i * node.inStride[d];
+                    oOffset += i * node.outStride[d];
+                    cOffset += ((len - i) % len) * node.outStride[d];
+                }
+                iOffset += counter * node.iDist;
+                oOffset += counter * node.oDist;
+                cOffset += counter * node.oDist;
+
+                for(size_t k = 0; k < hermitian_size; ++k)
+                {
+                    auto v = in.load(iOffset + k * node.inStride[0]);
+                    out.store(oOffset + k * node.outStride[0], v);
+                    if(k != 0 && 2 * k != len0)
+                    {
+                        v.y = -v.y;
+                        out.store(cOffset + (len0 - k) * node.outStride[0], v);
+                    }
+                }
+            }
+        });
+    }
+
+    // exp(-2 * pi * i * p / (2 * half_N)) for p < half_N, the table
+    // the even-length real pre/post-processing uses
+    template <typename Treal>
+    std::vector<hcomplex<Treal>> real_twiddles(size_t half_N)
+    {
+        std::vector<hcomplex<Treal>> twiddles;
+        twiddles.reserve(half_N);
+        for(size_t p = 0; p < half_N; ++p)
+            twiddles.push_back(host_twiddle<Treal>(2 * half_N, p, -1));
+        return twiddles;
+    }
+
+    // Turn the half-length complex FFT of a real row into its
+    // half_N + 1 Hermitian outputs.  load(k) and store(k, v) address
+    // element k of the row; a row may be processed in place.
+    template <typename Treal, typename Tload, typename Tstore>
+    void r2c_post_row(size_t                              half_N,
+                      const std::vector<hcomplex<Treal>>& twiddles,
+                      Tload                               load,
+                      Tstore                              store)
+    {
+        using complex_t        = hcomplex<Treal>;
+        const size_t quarter_N = (half_N + 1) / 2;
+
+        const complex_t first = load(0);
+        store(half_N, complex_t(first.x - first.y, 0));
+        store(0, complex_t(first.x + first.y, 0));
+        if(half_N % 2 == 0)
+        {
+            const complex_t middle = load(quarter_N);
+            store(quarter_N, complex_t(middle.x, -middle.y));
+        }
+
+        for(size_t idx_p = 1; idx_p < quarter_N; ++idx_p)
+        {
+            const size_t    idx_q = half_N - idx_p;
+            const complex_t p     = load(idx_p);
+            const complex_t q     = load(idx_q);
+            const complex_t u     = Treal(0.5) * (p + q);
+            const complex_t v     = Treal(0.5) * (p - q);
+            const complex_t twd_p = twiddles[idx_p];
+
+            store(idx_p,
+                  complex_t(u.x + v.x * twd_p.y + u.y * twd_p.x,
+                            v.y + u.y * twd_p.y - v.x * twd_p.x));
+            store(idx_q,
+                  complex_t(u.x - v.x * twd_p.y - u.y * twd_p.x,
+                            -v.y + u.y * twd_p.y - v.x * twd_p.x));
+        }
+    }
+
+    // Inverse of r2c_post_row: half_N + 1 Hermitian inputs to the
+    // half-length complex row whose inverse FFT gives the real output
+    template <typename Treal, typename Tload, typename Tstore>
+    void c2r_pre_row(size_t                              half_N,
+                     const std::vector<hcomplex<Treal>>& twiddles,
+                     Tload                               load,
+                     Tstore                              store)
+    {
+        using complex_t        = hcomplex<Treal>;
+        const size_t quarter_N = (half_N + 1) / 2;
+
+        // NB: multi-dimensional transforms may have non-zero
+        // imaginary part at index 0 or at the Nyquist frequency.
+        const complex_t first = load(0);
+        const complex_t last  = load(half_N);
+        store(0,
+              complex_t(first.x - first.y + last.x + last.y, first.x + first.y - last.x + last.y));
+        if(half_N % 2 == 0)
+        {
+            const complex_t middle = load(quarter_N);
+            store(quarter_N, complex_t(2 * middle.x, -2 * middle.y));
+        }
+
+        for(size_t idx_p = 1; idx_p < quarter_N; ++idx_p)
+        {
+            const size_t    idx_q = half_N - idx_p;
+            const complex_t p     = load(idx_p);
+            const complex_t q     = load(idx_q);
+            const complex_t u     = p + q;
+            const complex_t v     = p - q;
+            const complex_t twd_p = twiddles[idx_p];
+
+            store(idx_p,
+                  complex_t(u.x + v.x * twd_p.y - u.y * twd_p.x,
+                            v.y + u.y * twd_p.y + v.x * twd_p.x));
+            store(idx_q,
+                  complex_t(u.x - v.x * twd_p.y + u.y * twd_p.x,
+                            -v.y + u.y * twd_p.y + v.x * twd_p.x));
+        }
+    }
+
+    template <typename Tstore, typename Treal>
+    void r2c_1d_post_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    half_N   = node.length[0];
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+
+        const auto rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, half_N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                r2c_post_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return in.load(iOffset + k * node.inStride[0]); },
+                    [&](size_t k, const hcomplex<Treal>& v) {
+                        out.store(oOffset + k * node.outStride[0], v);
+                    });
+            }
+        });
+    }
+
+    // r2c post-processing of rows along dimension 0, writing row r of
+    // the output transposed: element k goes to column r of row k
+    template <typename Tstore, typename Treal>
+    void r2c_1d_post_transpose_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    half_N   = node.length[0];
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+        const size_t    outRow   = node.outStride[node.length.size() - 1];
+
+        const size_t nrows = std::accumulate(
+            node.length.begin() + 1, node.length.end(), size_t(1), std::multiplies<size_t>());
+        parallel_for(nrows * node.batch, half_N, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+            {
+                const size_t r       = i % nrows;
+                const size_t b       = i / nrows;
+                const size_t iOffset = b * node.iDist + r * node.inStride[1];
+                const size_t oOffset = b * node.oDist + r;
+                r2c_post_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return in.load(iOffset + k); },
+                    [&](size_t k, const hcomplex<Treal>& v) {
+                        out.store(oOffset + k * outRow, v);
+                    });
+            }
+        });
+    }
+
+    template <typename Tstore, typename Treal>
+    void c2r_1d_pre_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    half_N   = node.length[0];
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+
+        const auto rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, half_N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                c2r_pre_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return in.load(iOffset + k * node.inStride[0]); },
+                    [&](size_t k, const hcomplex<Treal>& v) {
+                        out.store(oOffset + k * node.outStride[0], v);
+                    });
+            }
+        });
+    }
+
+    // c2r pre-processing along the last dimension, whose length is
+    // half_N + 1, writing each column c as row c of the output
+    template <typename Tstore, typename Treal>
+    void transpose_c2r_1d_pre_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    last     = node.length.size() - 1;
+        const size_t    half_N   = node.length[last] - 1;
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+        const size_t    inRow    = node.inStride[last];
+
+        const size_t ncols = std::accumulate(
+            node.length.begin(), node.length.end() - 1, size_t(1), std::multiplies<size_t>());
+        parallel_for(ncols * node.batch, half_N, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+            {
+                const size_t c       = i % ncols;
+                const size_t b       = i / ncols;
+                const size_t iOffset = b * node.iDist + c;
+                const size_t oOffset = b * node.oDist + c * node.outStride[1];
+                c2r_pre_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return in.load(iOffset + k * inRow); },
+                    [&](size_t k, const hcomplex<Treal>& v) { out.store(oOffset + k, v); });
+            }
+        });
+    }
+
+    // Contiguous rows of dimension 0 that the fused real kernels keep
+    // between their FFT and the real processing, as the device kernels
+    // do in LDS
+    template <typename Tstore, typename Treal>
+    struct HostRowBuffer
+    {
+        std::vector<Tstore>      data;
+        std::vector<size_t>      stride;
+        size_t                   dist = 1;
+        HostArray<Tstore, Treal> array;
+
+        explicit HostRowBuffer(const TreeNode& node)
+        {
+            for(auto len : node.length)
+            {
+                stride.push_back(dist);
+                dist *= len;
+            }
+            data.resize(2 * dist * node.batch);
+            array.re = data.data();
+            array.im = array.re + 1;
+        }
+    };
+
+    // STOCKHAM_R_TO_CMPLX: the half-length FFT of each real row, then
+    // its post-processing into half_N + 1 Hermitian outputs
+    template <typename Tstore, typename Treal>
+    void stockham_r2c_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    half_N   = node.length[0];
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+
+        HostRowBuffer<Tstore, Treal> rowBuf(node);
+        const auto&                  tmp = rowBuf.array;
+        fft_rows(node, 0, in, node.inStride, node.iDist, tmp, rowBuf.stride, rowBuf.dist, 0);
+
+        const auto rows
+            = node_rows(node, 1, rowBuf.stride, rowBuf.dist, node.outStride, node.oDist);
+        parallel_for(rows.count, half_N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                r2c_post_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return tmp.load(iOffset + k); },
+                    [&](size_t k, const hcomplex<Treal>& v) {
+                        out.store(oOffset + k * node.outStride[0], v);
+                    });
+            }
+        });
+    }
+
+    // CMPLX_TO_R_STOCKHAM: pre-processing of each row's half_N + 1
+    // Hermitian inputs, then the half-length inverse FFT
+    template <typename Tstore, typename Treal>
+    void c2r_stockham_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node     = *data.node;
+        const auto      in       = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      out      = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    half_N   = node.length[0];
+        const auto      twiddles = real_twiddles<Treal>(half_N);
+
+        HostRowBuffer<Tstore, Treal> rowBuf(node);
+        const auto&                  tmp = rowBuf.array;
+
+        const auto rows = node_rows(node, 1, node.inStride, node.iDist, rowBuf.stride, rowBuf.dist);
+        parallel_for(rows.count, half_N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                c2r_pre_row<Treal>(
+                    half_N,
+                    twiddles,
+                    [&](size_t k) { return in.load(iOffset + k * node.inStride[0]); },
+                    [&](size_t k, const hcomplex<Treal>& v) { tmp.store(oOffset + k, v); });
+            }
+        });
+
+        fft_rows(node, 0, tmp, rowBuf.stride, rowBuf.dist, out, node.outStride, node.oDist, 0);
+    }
+
+    // Distance between the two arrays of a paired transform: half the
+    // distance when pairing over the batch (pairdim 0), otherwise half
+    // the stride of the pairing dimension
+    size_t pair_offset(const TreeNode& node, size_t dist, const std::vector<size_t>& stride)
+    {
+        return node.pairdim == 0 ? dist / 2 : stride[node.pairdim] / 2;
+    }
+
+    // Split Z = FFT(x + iy) of two real arrays x, y stored as planar
+    // reals into the Hermitian halves X and Y:
+    //   X_p = (Z_p + conj(Z_{N-p})) / 2,  Y_p = (Z_p - conj(Z_{N-p})) / 2i
+    template <typename Tstore, typename Treal>
+    void complex2pair_unpack_host(const DeviceCallIn& data)
+    {
+        using complex_t       = hcomplex<Treal>;
+        const TreeNode& node  = *data.node;
+        const auto      inRe  = real_array<Tstore, Treal>(data.bufIn[0]);
+        const auto      out   = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    N     = node.length[0];
+        const size_t    iPair = pair_offset(node, node.iDist, node.inStride);
+        const size_t    oPair = pair_offset(node, node.oDist, node.outStride);
+        const auto      inIm  = inRe.offset(iPair);
+        const auto      outY  = out.offset(oPair);
+        const size_t    is    = node.inStride[0];
+        const size_t    os    = node.outStride[0];
+
+        const auto rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                for(size_t idx_p = 0; idx_p <= N / 2; ++idx_p)
+                {
+                    const size_t idx_q = (N - idx_p) % N;
+                    const Treal  Rep   = inRe.load(iOffset + idx_p * is).x;
+                    const Treal  Imp   = inIm.load(iOffset + idx_p * is).x;
+                    const Treal  Req   = inRe.load(iOffset + idx_q * is).x;
+                    const Treal  Imq   = inIm.load(iOffset + idx_q * is).x;
+
+                    out.store(oOffset + idx_p * os,
+                              complex_t(Treal(0.5) * (Rep + Req), Treal(0.5) * (Imp - Imq)));
+                    outY.store(oOffset + idx_p * os,
+                               complex_t(Treal(0.5) * (Imp + Imq), Treal(-0.5) * (Rep - Req)));
+                }
+            }
+        });
+    }
+
+    // Inverse of complex2pair_unpack_host: Z_p = X_p + i Y_p over the
+    // full length, extending X and Y by Hermitian symmetry, stored as
+    // planar reals
+    template <typename Tstore, typename Treal>
+    void pair2complex_pack_host(const DeviceCallIn& data)
+    {
+        using complex_t       = hcomplex<Treal>;
+        const TreeNode& node  = *data.node;
+        const auto      in    = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        const auto      outRe = real_array<Tstore, Treal>(data.bufOut[0]);
+        const size_t    N     = node.length[0];
+        const auto      inY   = in.offset(pair_offset(node, node.iDist, node.inStride));
+        const auto      outIm = outRe.offset(pair_offset(node, node.oDist, node.outStride));
+        const size_t    is    = node.inStride[0];
+        const size_t    os    = node.outStride[0];
+
+        const auto rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, N, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                for(size_t p = 0; p < N; ++p)
+                {
+                    const bool   upper = p > N / 2;
+                    const size_t r     = upper ? N - p : p;
+                    auto         X     = in.load(iOffset + r * is);
+                    auto         Y     = inY.load(iOffset + r * is);
+                    if(upper)
+                    {
+                        X.y = -X.y;
+                        Y.y = -Y.y;
+                    }
+                    outRe.store(oOffset + p * os, complex_t(X.x - Y.y, 0));
+                    outIm.store(oOffset + p * os, complex_t(X.y + Y.x, 0));
+                }
+            }
+        });
+    }
+
+    // Bluestein chirp exp(-direction * pi * i * t^2 / N), written twice
+    // (at 0 and M) as a length M sequence symmetric about 0 and padded
+    // with zeros
+    template <typename Tstore, typename Treal>
+    void chirp_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        const auto      out  = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        const size_t    N    = node.length[0];
+        const size_t    M    = node.lengthBlue;
+
+        const hcomplex<Treal> zero(0, 0);
+        for(size_t t = 0; t <= M - N; ++t)
+        {
+            if(t < N)
+            {
+                const auto val = host_twiddle<Treal>(2 * N, t * t, -node.direction);
+                out.store(t, val);
+                out.store(t + M, val);
+                if(t != 0)
+                {
+                    out.store(M - t, val);
+                    out.store(M - t + M, val);
+                }
+            }
+            else
+            {
+                out.store(t, zero);
+                out.store(t + M, zero);
+            }
+        }
+    }
+
+    // PAD_MUL, FFT_MUL and RES_MUL: the element-wise products of the
+    // Bluestein algorithm, over the same work buffer layout as the
+    // device (chirp at 0, its FFT at M, the padded data at 2M).  The
+    // 1/M normalization is applied in FFT_MUL, as on the device.
+    template <typename Tstore, typename Treal>
+    void mul_host(const DeviceCallIn& data)
+    {
+        const TreeNode& node = *data.node;
+        const size_t    N    = node.length[0];
+        const size_t    M    = node.lengthBlue;
+        auto            in   = complex_array<Tstore, Treal>(data.bufIn, node.inArrayType);
+        auto            out  = complex_array<Tstore, Treal>(data.bufOut, node.outArrayType);
+        HostArray<Tstore, Treal> chirp;
+
+        size_t numof = M;
+        if(node.scheme == CS_KERNEL_FFT_MUL)
+        {
+            in  = in.offset(M);
+            out = out.offset(2 * M);
+        }
+        else if(node.scheme == CS_KERNEL_PAD_MUL)
+        {
+            chirp = out.offset(M);
+            out   = out.offset(2 * M);
+        }
+        else
+        {
+            chirp = in;
+            in    = in.offset(2 * M);
+            numof = N;
+        }
+
+        const Treal scale = Treal(1) / static_cast<Treal>(M);
+        const auto  rows
+            = node_rows(node, 1, node.inStride, node.iDist, node.outStride, node.oDist);
+        parallel_for(rows.count, numof, [&](size_t begin, size_t end) {
+            for(size_t row = begin; row < end; ++row)
+            {
+                size_t iOffset, oOffset;
+                rows.offsets(row, iOffset, oOffset);
+                for(size_t tx = 0; tx < numof; ++tx)
+                {
+                    const size_t iIdx = tx * node.inStride[0];
+                    const size_t oIdx = oOffset + tx * node.outStride[0];
+                    if(node.scheme == CS_KERNEL_FFT_MUL)
+                        out.store(oIdx, cmul(in.load(iIdx), out.load(oIdx)) * scale);
+                    else if(node.scheme == CS_KERNEL_PAD_MUL)
+                        out.store(oIdx,
+                                  tx < N ? cmul_conj(in.load(iOffset + iIdx), chirp.load(tx))
+                                         : hcomplex<Treal>(0, 0));
+                    else
+                        out.store(oIdx, cmul_conj(in.load(iOffset + iIdx), chirp.load(tx)));
+                }
+            }
+        });
+    }
+}
+
+// Wrap a host kernel template in a DevFnCall for the node's precision.
+// Half precision is stored as _Float16 and computed in float, or in
+// double like every precision for the reference kernels.
+template <bool reference>
+using host_compute_t = typename std::conditional<reference, double, float>::type;
+
+#define HOST_KERNEL(NAME)                                              \
+    template <bool reference>                                          \
+    void host_##NAME(const void* data_p, void*)                        \
+    {                                                                  \
+        auto data = static_cast<const DeviceCallIn*>(data_p);          \
+        switch(data->node->precision)                                  \
+        {                                                              \
+        case rocfft_precision_single:                                  \
+            NAME##_host<float, host_compute_t<reference>>(*data);      \
+            break;                                                     \
+        case rocfft_precision_double:                                  \
+            NAME##_host<double, double>(*data);                        \
+            break;                                                     \
+        case rocfft_precision_half:                                    \
+            NAME##_host<_Float16, host_compute_t<reference>>(*data);   \
+            break;                                                     \
+        }                                                              \
+    }
+
+namespace
+{
+    HOST_KERNEL(stockham)
+    HOST_KERNEL(multi_dim_single)
+    HOST_KERNEL(transpose)
+    HOST_KERNEL(real2complex)
+    HOST_KERNEL(complex2real)
+    HOST_KERNEL(complex2hermitian)
+    HOST_KERNEL(hermitian2complex)
+    HOST_KERNEL(r2c_1d_post)
+    HOST_KERNEL(r2c_1d_post_transpose)
+    HOST_KERNEL(c2r_1d_pre)
+    HOST_KERNEL(transpose_c2r_1d_pre)
+    HOST_KERNEL(stockham_r2c)
+    HOST_KERNEL(c2r_stockham)
+    HOST_KERNEL(complex2pair_unpack)
+    HOST_KERNEL(pair2complex_pack)
+    HOST_KERNEL(chirp)
+    HOST_KERNEL(mul)
+
+    template <bool reference>
+    DevFnCall host_kernel(ComputeScheme scheme)
+    {
+        switch(scheme)
+        {
+        case CS_KERNEL_STOCKHAM:
+        case CS_KERNEL_STOCKHAM_BLOCK_CC:
+        case CS_KERNEL_STOCKHAM_BLOCK_RC:
+            return &host_stockham<reference>;
+        case CS_KERNEL_TRANSPOSE:
+        case CS_KERNEL_TRANSPOSE_XY_Z:
+        case CS_KERNEL_TRANSPOSE_Z_XY:
+            return &host_transpose<reference>;
+        case CS_KERNEL_COPY_R_TO_CMPLX:
+            return &host_real2complex<reference>;
+        case CS_KERNEL_COPY_CMPLX_TO_R:
+            return &host_complex2real<reference>;
+        case CS_KERNEL_COPY_HERM_TO_CMPLX:
+            return &host_hermitian2complex<reference>;
+        case CS_KERNEL_COPY_CMPLX_TO_HERM:
+            return &host_complex2hermitian<reference>;
+        case CS_KERNEL_R_TO_CMPLX:
+            return &host_r2c_1d_post<reference>;
+        case CS_KERNEL_R_TO_CMPLX_TRANSPOSE:
+            return &host_r2c_1d_post_transpose<reference>;
+        case CS_KERNEL_CMPLX_TO_R:
+            return &host_c2r_1d_pre<reference>;
+        case CS_KERNEL_TRANSPOSE_CMPLX_TO_R:
+            return &host_transpose_c2r_1d_pre<reference>;
+        case CS_KERNEL_STOCKHAM_R_TO_CMPLX:
+            return &host_stockham_r2c<reference>;
+        case CS_KERNEL_CMPLX_TO_R_STOCKHAM:
+            return &host_c2r_stockham<reference>;
+        case CS_KERNEL_PAIR_UNPACK:
+            return &host_complex2pair_unpack<reference>;
+        case CS_KERNEL_PAIR_PACK:
+            return &host_pair2complex_pack<reference>;
+        case CS_KERNEL_CHIRP:
+            return &host_chirp<reference>;
+        case CS_KERNEL_PAD_MUL:
+        case CS_KERNEL_FFT_MUL:
+        case CS_KERNEL_RES_MUL:
+            return &host_mul<reference>;
+        case CS_KERNEL_2D_SINGLE:
+        case CS_KERNEL_3D_SINGLE:
+            return &host_multi_dim_single<reference>;
+        default:
+            return nullptr;
+        }
+    }
+}
+
+DevFnCall host_function(ComputeScheme scheme)
+{
+    return host_kernel<false>(scheme);
+}
+
+DevFnCall host_reference_function(ComputeScheme scheme)
+{
+    return host_kernel<true>(scheme);
+}
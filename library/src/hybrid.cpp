@@ -0,0 +1,195 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "device_runtime.h"
+#include "hybrid.h"
+#include "logging.h"
+#include "private.h"
+#include "radix_table.h"
+#include "repo.h"
+#include "transform.h"
+
+HybridState::HybridState(const rocfft_plan_t& plan)
+    : plan(plan)
+    , quantum(std::max<size_t>(1, plan.batch / 64))
+    , hostShare(0.125)
+{
+}
+
+const ExecPlan* HybridState::SubPlan(size_t batch, rocfft_execution_backend backend)
+{
+    auto& plans = (backend == rocfft_backend_host) ? hostPlans : devicePlans;
+    auto  it    = plans.find(batch);
+    if(it == plans.end())
+    {
+        rocfft_plan_t sub = plan;
+        sub.batch         = batch;
+        sub.desc.backend  = backend;
+
+        ExecPlan execPlan;
+        if(!Repo::BuildExecPlan(sub, execPlan))
+            return nullptr;
+        it = plans.emplace(batch, std::move(execPlan)).first;
+    }
+    return &it->second;
+}
+
+size_t HybridState::HostBatch() const
+{
+    const size_t quanta = std::lround(hostShare * plan.batch / quantum);
+    return std::min(std::max<size_t>(quanta, 1) * quantum, plan.batch - quantum);
+}
+
+void HybridState::Learn(size_t hostBatch, double hostSeconds, double deviceSeconds)
+{
+    // a side too quick for the clock to see still has a finite rate
+    const double tick       = 1e-9;
+    const double hostRate   = hostBatch / std::max(hostSeconds, tick);
+    const double deviceRate = (plan.batch - hostBatch) / std::max(deviceSeconds, tick);
+
+    const double minShare = static_cast<double>(quantum) / plan.batch;
+    hostShare             = 0.5 * hostShare + 0.5 * hostRate / (hostRate + deviceRate);
+    hostShare             = std::min(std::max(hostShare, minShare), 1.0 - minShare);
+}
+
+// Point 'offset' at the transform 'skip' places into the batch held
+// in 'buffer'.  Distances count elements of the array type.
+static void OffsetBuffers(void*             buffer[],
+                          void*             offset[],
+                          rocfft_array_type type,
+                          rocfft_precision  precision,
+                          size_t            dist,
+                          size_t            skip)
+{
+    const bool planar = type == rocfft_array_type_complex_planar
+                        || type == rocfft_array_type_hermitian_planar;
+    const bool interleaved = type == rocfft_array_type_complex_interleaved
+                             || type == rocfft_array_type_hermitian_interleaved;
+
+    const size_t bytes = skip * dist * RealTypeSize(precision) * (interleaved ? 2 : 1);
+    offset[0]          = static_cast<char*>(buffer[0]) + bytes;
+    if(planar)
+        offset[1] = static_cast<char*>(buffer[1]) + bytes;
+}
+
+rocfft_status TransformHybrid(const ExecPlan&       execPlan,
+                              void*                 in_buffer[],
+                              void*                 out_buffer[],
+                              rocfft_execution_info info)
+{
+    auto&                       state = *execPlan.hybrid;
+    std::lock_guard<std::mutex> lck(state.mutex);
+
+    const rocfft_plan_t& plan  = state.plan;
+    const size_t         batch = plan.batch;
+
+    const size_t hostBatch   = state.HostBatch();
+    const size_t deviceBatch = batch - hostBatch;
+
+    log_trace("hybrid_split",
+              "device_batch",
+              deviceBatch,
+              "host_batch",
+              hostBatch,
+              "host_share",
+              state.hostShare);
+
+    rocfft_execution_info_t deviceInfo;
+    if(info)
+        deviceInfo = *info;
+    deviceInfo.backend = rocfft_backend_device;
+
+    const ExecPlan* hostPlan   = state.SubPlan(hostBatch, rocfft_backend_host);
+    const ExecPlan* devicePlan = state.SubPlan(deviceBatch, rocfft_backend_device);
+    if(!hostPlan || !devicePlan)
+        return rocfft_status_failure;
+
+    rocfft_execution_info_t hostInfo;
+    hostInfo.backend = rocfft_backend_host;
+    if(hostPlan->workBufSize > 0)
+    {
+        state.hostWork.resize(hostPlan->workBufSize * 2 * plan.base_type_size);
+        hostInfo.workBuffer     = state.hostWork.data();
+        hostInfo.workBufferSize = state.hostWork.size();
+    }
+
+    // the host takes the end of the batch
+    void* hostIn[2]  = {};
+    void* hostOut[2] = {};
+    OffsetBuffers(
+        in_buffer, hostIn, plan.desc.inArrayType, plan.precision, plan.desc.inDist, deviceBatch);
+    OffsetBuffers(out_buffer,
+                  hostOut,
+                  plan.desc.outArrayType,
+                  plan.precision,
+                  plan.desc.outDist,
+                  deviceBatch);
+
+    // don't time work queued on the stream before this execution
+    device_runtime().stream_synchronize(deviceInfo.rocfft_stream);
+
+    typedef std::chrono::steady_clock clock;
+    double                            hostSeconds = 0.0;
+
+    const auto start = clock::now();
+    std::thread hostThread([&]() {
+        TransformPowX(*hostPlan, hostIn, hostOut, &hostInfo);
+        hostSeconds = std::chrono::duration<double>(clock::now() - start).count();
+    });
+    const rocfft_status status
+        = TransformPowXBorrowing(*devicePlan, in_buffer, out_buffer, &deviceInfo);
+    device_runtime().stream_synchronize(deviceInfo.rocfft_stream);
+    const double deviceSeconds = std::chrono::duration<double>(clock::now() - start).count();
+    hostThread.join();
+    if(status != rocfft_status_success)
+        return status;
+
+    state.Learn(hostBatch, hostSeconds, deviceSeconds);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_plan_get_hybrid_share_internal(const rocfft_plan plan, double* share)
+{
+    ExecPlan execPlan;
+    Repo::GetPlan(plan, execPlan);
+    if(!execPlan.hybrid)
+        return rocfft_status_invalid_arg_value;
+
+    std::lock_guard<std::mutex> lck(execPlan.hybrid->mutex);
+    *share = execPlan.hybrid->hostShare;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_plan_set_hybrid_share_internal(rocfft_plan plan, double share)
+{
+    ExecPlan execPlan;
+    Repo::GetPlan(plan, execPlan);
+    if(!execPlan.hybrid)
+        return rocfft_status_invalid_arg_value;
+
+    std::lock_guard<std::mutex> lck(execPlan.hybrid->mutex);
+    execPlan.hybrid->hostShare = share;
+    return rocfft_status_success;
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef BATCH_COPY_H
+#define BATCH_COPY_H
+
+#include "rocfft_hip.h"
+
+// Copy of 'bytes' from each of 'count' separate buffers into
+// consecutive slots of one staging buffer ('gather'), or back out of
+// the slots into the buffers.  The buffer pointers travel as a kernel
+// argument, or in a device array, so one launch covers every buffer.
+struct BatchCopy
+{
+    static const size_t max_count = 256;
+
+    void* buffers[max_count];
+
+    // device array of the buffers, used instead of 'buffers' when set
+    // and then not limited to max_count, with the alignment its
+    // buffers are known to have
+    void* const* buffer_array = nullptr;
+    size_t       buffer_align = 1;
+
+    size_t count   = 0;
+    char*  staging = nullptr;
+    size_t slot    = 0; // bytes between consecutive slots
+    size_t bytes   = 0;
+    bool   gather  = true;
+};
+
+void batch_copy(const BatchCopy& copy, hipStream_t stream);
+
+#endif // BATCH_COPY_H
@@ -0,0 +1,51 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef COALESCE_H
+#define COALESCE_H
+
+#include "plan.h"
+#include "tree_node.h"
+
+// Run one execution of 'plan' as part of a batch gathered from
+// concurrent executions of plans with the same shape, within the
+// window set by rocfft_execution_info_set_coalescing.  Returns once
+// the batch is enqueued, with the caller's stream made to wait for it.
+rocfft_status TransformCoalesced(const rocfft_plan_t&  plan,
+                                 const ExecPlan&       execPlan,
+                                 void*                 in_buffer[],
+                                 void*                 out_buffer[],
+                                 rocfft_execution_info info);
+
+// True if the plan is a single small 1D complex kernel, which can take
+// each transform's address from the BatchPointers of the execution info
+bool BatchPointersSupported(const ExecPlan& execPlan);
+
+// Run 'plan' on a batch of separately allocated transforms, given as
+// device arrays of pointers per plane.  A plan of one small 1D complex
+// kernel indexes the arrays by transform; others stage the transforms
+// through one contiguous batch.  Enqueued on the stream of 'info'.
+rocfft_status TransformPointerArray(const rocfft_plan_t&  plan,
+                                    const ExecPlan&       execPlan,
+                                    void**                in_buffer[],
+                                    void**                out_buffer[],
+                                    rocfft_execution_info info);
+
+#endif // COALESCE_H
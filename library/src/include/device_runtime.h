@@ -0,0 +1,100 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef DEVICE_RUNTIME_H
+#define DEVICE_RUNTIME_H
+
+#include "gpubuf.h"
+#include "rocfft_hip.h"
+
+struct BatchCopy;
+struct DeviceCallIn;
+struct DeviceCallOut;
+typedef void (*DevFnCall)(const void*, void*);
+
+// The device runtime calls made by plan creation and by the execute
+// path.  Kernel launchers still call HIP themselves, but are only
+// reached through launch().
+//
+// HIP is the production runtime.  Setting the environment variable
+// ROCFFT_DEVICE_RUNTIME to "record" before the first call into the
+// library selects a stand-in that needs no GPU: it allocates host
+// memory, counts calls and bytes, and logs each launch with its grid
+// to the trace log instead of running it.  The counts go to the trace
+// log at rocfft_cleanup.
+class DeviceRuntime
+{
+public:
+    virtual ~DeviceRuntime() = default;
+
+    virtual hipError_t malloc(void** ptr, size_t size)                                     = 0;
+    virtual hipError_t free(void* ptr)                                                     = 0;
+    virtual hipError_t memcpy(void* dst, const void* src, size_t size, hipMemcpyKind kind) = 0;
+
+    virtual hipError_t get_device(int* device)                                             = 0;
+    virtual hipError_t device_attribute(int* value, hipDeviceAttribute_t attr, int device) = 0;
+
+    virtual hipError_t event_create(hipEvent_t* event)                                  = 0;
+    virtual hipError_t event_destroy(hipEvent_t event)                                  = 0;
+    virtual hipError_t event_record(hipEvent_t event, hipStream_t stream)               = 0;
+    virtual hipError_t event_synchronize(hipEvent_t event)                              = 0;
+    virtual hipError_t event_elapsed_time(float* ms, hipEvent_t start, hipEvent_t stop) = 0;
+
+    // streams the library creates are non-blocking
+    virtual hipError_t stream_create(hipStream_t* stream)                      = 0;
+    virtual hipError_t stream_destroy(hipStream_t stream)                      = 0;
+    virtual hipError_t stream_synchronize(hipStream_t stream)                  = 0;
+    virtual hipError_t stream_wait_event(hipStream_t stream, hipEvent_t event) = 0;
+
+    // run a leaf node's kernel launcher
+    virtual void launch(DevFnCall fn, const DeviceCallIn& data, DeviceCallOut& back) = 0;
+
+    // gather buffers into, or scatter them out of, a staging buffer
+    virtual void batch_copy(const BatchCopy& copy, hipStream_t stream) = 0;
+
+    // write what the runtime has recorded, if anything, to the trace log
+    virtual void log_summary()
+    {
+    }
+};
+
+// the runtime the library uses, chosen on first use
+DeviceRuntime& device_runtime();
+
+// gpubuf allocator that goes through device_runtime()
+struct device_runtime_allocator
+{
+    static hipError_t malloc(void** ptr, size_t size)
+    {
+        return device_runtime().malloc(ptr, size);
+    }
+    static hipError_t free(void* ptr)
+    {
+        return device_runtime().free(ptr);
+    }
+};
+
+// buffers the library itself owns, such as twiddle tables and kernel
+// arguments
+template <class T = void>
+using devbuf_t = gpubuf_t<T, device_runtime_allocator>;
+typedef devbuf_t<> devbuf;
+
+#endif // DEVICE_RUNTIME_H
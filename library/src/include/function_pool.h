@@ -24,6 +24,7 @@
 #define FUNCTION_POOL_H
 
 #include "tree_node.h"
+#include <stdexcept>
 #include <unordered_map>
 
 struct SimpleHash
@@ -45,6 +46,18 @@ struct SimpleHash
         return h1 ^ h2 ^ h3;
     }
 
+    std::size_t operator()(const std::tuple<size_t, size_t, size_t, ComputeScheme>& p) const
+        noexcept
+    {
+        std::size_t h1 = std::hash<size_t>{}(std::get<0>(p));
+        std::size_t h2 = std::hash<size_t>{}(std::get<1>(p));
+        std::size_t h3 = std::hash<size_t>{}(std::get<2>(p));
+        std::size_t h4 = std::hash<ComputeScheme>{}(std::get<3>(p));
+        // the lengths are usually permutations of each other, so
+        // don't let them cancel out
+        return h1 ^ (h2 << 1) ^ (h3 << 2) ^ h4;
+    }
+
     // example usage:  function_map_single[std::make_pair(64,CS_KERNEL_STOCKHAM)]
     // = &rocfft_internal_dfn_sp_ci_ci_stoc_1_64;
 };
@@ -53,11 +66,23 @@ class function_pool
 {
     using Key   = std::pair<size_t, ComputeScheme>;
     using Key2D = std::tuple<size_t, size_t, ComputeScheme>;
+    using Key3D = std::tuple<size_t, size_t, size_t, ComputeScheme>;
+    // length, transforms per thread block and scheme of a kernel
+    // variant, see StockhamTransformsPerBlock
+    using KeyNT = std::tuple<size_t, size_t, ComputeScheme>;
 
     std::unordered_map<Key, DevFnCall, SimpleHash>   function_map_single;
     std::unordered_map<Key, DevFnCall, SimpleHash>   function_map_double;
+    std::unordered_map<Key, DevFnCall, SimpleHash>   function_map_half;
     std::unordered_map<Key2D, DevFnCall, SimpleHash> function_map_single_2D;
     std::unordered_map<Key2D, DevFnCall, SimpleHash> function_map_double_2D;
+    std::unordered_map<Key2D, DevFnCall, SimpleHash> function_map_half_2D;
+    std::unordered_map<Key3D, DevFnCall, SimpleHash> function_map_single_3D;
+    std::unordered_map<Key3D, DevFnCall, SimpleHash> function_map_double_3D;
+    std::unordered_map<Key3D, DevFnCall, SimpleHash> function_map_half_3D;
+    std::unordered_map<KeyNT, DevFnCall, SimpleHash> function_map_single_nt;
+    std::unordered_map<KeyNT, DevFnCall, SimpleHash> function_map_double_nt;
+    std::unordered_map<KeyNT, DevFnCall, SimpleHash> function_map_half_nt;
 
     function_pool();
 
@@ -89,6 +114,44 @@ public:
         return func_pool.function_map_double.at(mykey);
     }
 
+    static DevFnCall get_function_half(Key mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return func_pool.function_map_half.at(mykey);
+    }
+
+    // look up a kernel in the map for the given precision
+    static DevFnCall get_function(rocfft_precision precision, Key mykey)
+    {
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return get_function_single(mykey);
+        case rocfft_precision_double:
+            return get_function_double(mykey);
+        case rocfft_precision_half:
+            return get_function_half(mykey);
+        }
+        throw std::out_of_range("invalid precision");
+    }
+
+    // true if a kernel is registered for the key in the map for the
+    // given precision; unlike get_function, never throws
+    static bool has_function(rocfft_precision precision, Key mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return func_pool.function_map_single.count(mykey) != 0;
+        case rocfft_precision_double:
+            return func_pool.function_map_double.count(mykey) != 0;
+        case rocfft_precision_half:
+            return func_pool.function_map_half.count(mykey) != 0;
+        }
+        return false;
+    }
+
     static DevFnCall get_function_single_2D(Key2D mykey)
     {
         function_pool& func_pool = get_function_pool();
@@ -101,6 +164,73 @@ public:
         return func_pool.function_map_double_2D.at(mykey);
     }
 
+    static DevFnCall get_function_half_2D(Key2D mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        return func_pool.function_map_half_2D.at(mykey);
+    }
+
+    static DevFnCall get_function_2D(rocfft_precision precision, Key2D mykey)
+    {
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return get_function_single_2D(mykey);
+        case rocfft_precision_double:
+            return get_function_double_2D(mykey);
+        case rocfft_precision_half:
+            return get_function_half_2D(mykey);
+        }
+        throw std::out_of_range("invalid precision");
+    }
+
+    static DevFnCall get_function_3D(rocfft_precision precision, Key3D mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return func_pool.function_map_single_3D.at(mykey);
+        case rocfft_precision_double:
+            return func_pool.function_map_double_3D.at(mykey);
+        case rocfft_precision_half:
+            return func_pool.function_map_half_3D.at(mykey);
+        }
+        throw std::out_of_range("invalid precision");
+    }
+
+    static DevFnCall get_function_nt(rocfft_precision precision, KeyNT mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return func_pool.function_map_single_nt.at(mykey);
+        case rocfft_precision_double:
+            return func_pool.function_map_double_nt.at(mykey);
+        case rocfft_precision_half:
+            return func_pool.function_map_half_nt.at(mykey);
+        }
+        throw std::out_of_range("invalid precision");
+    }
+
+    // true if the kernel variant is registered for the given
+    // precision; unlike get_function_nt, never throws
+    static bool has_function_nt(rocfft_precision precision, KeyNT mykey)
+    {
+        function_pool& func_pool = get_function_pool();
+        switch(precision)
+        {
+        case rocfft_precision_single:
+            return func_pool.function_map_single_nt.count(mykey) != 0;
+        case rocfft_precision_double:
+            return func_pool.function_map_double_nt.count(mykey) != 0;
+        case rocfft_precision_half:
+            return func_pool.function_map_half_nt.count(mykey) != 0;
+        }
+        return false;
+    }
+
     static void verify_no_null_functions()
     {
         function_pool& func_pool = get_function_pool();
@@ -124,6 +254,15 @@ public:
                 rocfft_cout << "null ptr registered in function_map_double" << std::endl;
             }
         }
+
+        for(auto it = func_pool.function_map_half.begin(); it != func_pool.function_map_half.end();
+            ++it)
+        {
+            if(it->second == nullptr)
+            {
+                rocfft_cout << "null ptr registered in function_map_half" << std::endl;
+            }
+        }
     }
 };
 
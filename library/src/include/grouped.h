@@ -0,0 +1,39 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef GROUPED_H
+#define GROUPED_H
+
+#include "plan.h"
+
+// Run 'count' plans as one step on the stream of 'info'.  Plans that
+// share a small 1D kernel run as one launch of it, which takes each of
+// their transforms' addresses from a device table; the others run on
+// their own.  The launches are spread over streams of the library,
+// forked from and joined back to the info's stream, so that launches
+// of different kernels overlap.  No plan runs unless all of them are
+// valid.
+rocfft_status TransformGrouped(size_t                count,
+                               const rocfft_plan     plans[],
+                               void**                in_buffers[],
+                               void**                out_buffers[],
+                               rocfft_execution_info info);
+
+#endif // GROUPED_H
@@ -0,0 +1,78 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HYBRID_H
+#define HYBRID_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "plan.h"
+#include "tree_node.h"
+
+// Batch split of a plan created for rocfft_backend_hybrid.  Each
+// execution gives the first transforms of the batch to the device and
+// the rest to the host, which run concurrently.  The host's share
+// follows the throughput each side achieved in earlier executions.
+struct HybridState
+{
+    explicit HybridState(const rocfft_plan_t& plan);
+
+    // plan for 'batch' transforms of this plan's problem on the
+    // device or host backend, built on first use
+    const ExecPlan* SubPlan(size_t batch, rocfft_execution_backend backend);
+
+    // transforms to give to the host: hostShare of the batch rounded to
+    // whole quanta, leaving at least one quantum to each side so that
+    // every execution measures both throughputs
+    size_t HostBatch() const;
+
+    // move hostShare halfway towards the split at which both sides
+    // would have finished together
+    void Learn(size_t hostBatch, double hostSeconds, double deviceSeconds);
+
+    const rocfft_plan_t plan;
+
+    // splits are multiples of this many transforms, which bounds the
+    // number of sub-plans
+    const size_t quantum;
+
+    // executions of one plan are serialized on this
+    std::mutex mutex;
+
+    // fraction of the batch to give to the host, kept within
+    // [quantum, batch - quantum] / batch
+    double hostShare;
+
+    std::map<size_t, ExecPlan> devicePlans;
+    std::map<size_t, ExecPlan> hostPlans;
+
+    // the host side needs its own work buffer, since the caller's is
+    // in use by the device side
+    std::vector<char> hostWork;
+};
+
+rocfft_status TransformHybrid(const ExecPlan&       execPlan,
+                              void*                 in_buffer[],
+                              void*                 out_buffer[],
+                              rocfft_execution_info info);
+
+#endif // HYBRID_H
@@ -24,13 +24,19 @@
 #if !defined(KARGS_H)
 #define KARGS_H
 
-#include "gpubuf.h"
+#include "device_runtime.h"
 #include <cstddef>
 #include <vector>
 
 #define KERN_ARGS_ARRAY_WIDTH 16
 
-gpubuf_t<size_t> kargs_create(std::vector<size_t> length,
+// Highest rank of a plan.  A node has the plan's lengths, plus one when
+// a large 1D length is split in two, and its distance after them.
+#define MAX_PLAN_RANK 8
+static_assert(MAX_PLAN_RANK + 2 <= KERN_ARGS_ARRAY_WIDTH,
+              "kernel arguments cannot hold the lengths of the highest rank");
+
+devbuf_t<size_t> kargs_create(std::vector<size_t> length,
                               std::vector<size_t> inStride,
                               std::vector<size_t> outStride,
                               size_t              iDist,
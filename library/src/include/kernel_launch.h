@@ -43,6 +43,10 @@ struct DeviceCallIn
 
     hipStream_t rocfft_stream;
     GridParam   gridParam;
+
+    // set only for a CS_KERNEL_STOCKHAM node run by
+    // rocfft_execute_pointer_array
+    BatchPointers batchPointers = {};
 };
 
 // FIXME: documentation
@@ -69,6 +73,8 @@ ci – complex-interleaved (format of input buffer)
 ci – complex-interleaved (format of output buffer)
 
 stoc – stockham fft kernel
+stoc_real - stockham fft kernel with the even-length real pre/post-processing
+fused in
 bcc - block column column
 
 1(2) – one (two) dimension data from kernel viewpoint, but 2D may transform into
@@ -124,13 +130,14 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            dim3(data->gridParam.tpb_x),                            \
                                            0,                                                      \
                                            rocfft_stream,                                          \
-                                           (PRECISION*)data->node->twiddles.data(),                \
+                                           (compute_t<PRECISION>*)data->node->twiddles.data(),     \
                                            data->node->length.size(),                              \
                                            data->node->devKernArg.data(),                          \
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
-                                           (PRECISION*)data->bufIn[0]);                            \
+                                           (PRECISION*)data->bufIn[0],                             \
+                                           data->batchPointers);                                   \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -143,14 +150,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            dim3(data->gridParam.tpb_x),                            \
                                            0,                                                      \
                                            rocfft_stream,                                          \
-                                           (PRECISION*)data->node->twiddles.data(),                \
+                                           (compute_t<PRECISION>*)data->node->twiddles.data(),     \
                                            data->node->length.size(),                              \
                                            data->node->devKernArg.data(),                          \
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
-                                           (real_type_t<PRECISION>*)data->bufIn[1]);               \
+                                           (real_type_t<PRECISION>*)data->bufIn[1],                \
+                                           data->batchPointers);                                   \
                     }                                                                              \
                 }                                                                                  \
                 else                                                                               \
@@ -166,13 +174,14 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            dim3(data->gridParam.tpb_x),                            \
                                            0,                                                      \
                                            rocfft_stream,                                          \
-                                           (PRECISION*)data->node->twiddles.data(),                \
+                                           (compute_t<PRECISION>*)data->node->twiddles.data(),     \
                                            data->node->length.size(),                              \
                                            data->node->devKernArg.data(),                          \
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
-                                           (PRECISION*)data->bufIn[0]);                            \
+                                           (PRECISION*)data->bufIn[0],                             \
+                                           data->batchPointers);                                   \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -185,14 +194,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                            dim3(data->gridParam.tpb_x),                            \
                                            0,                                                      \
                                            rocfft_stream,                                          \
-                                           (PRECISION*)data->node->twiddles.data(),                \
+                                           (compute_t<PRECISION>*)data->node->twiddles.data(),     \
                                            data->node->length.size(),                              \
                                            data->node->devKernArg.data(),                          \
                                            data->node->devKernArg.data()                           \
                                                + 1 * KERN_ARGS_ARRAY_WIDTH,                        \
                                            data->node->batch,                                      \
                                            (real_type_t<PRECISION>*)data->bufIn[0],                \
-                                           (real_type_t<PRECISION>*)data->bufIn[1]);               \
+                                           (real_type_t<PRECISION>*)data->bufIn[1],                \
+                                           data->batchPointers);                                   \
                     }                                                                              \
                 }                                                                                  \
             }                                                                                      \
@@ -212,12 +222,13 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
-                            (PRECISION*)data->bufIn[0]);                                           \
+                            (PRECISION*)data->bufIn[0],                                            \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -231,13 +242,14 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
-                            (real_type_t<PRECISION>*)data->bufIn[1]);                              \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                               \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
                 else                                                                               \
@@ -254,12 +266,13 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
-                            (PRECISION*)data->bufIn[0]);                                           \
+                            (PRECISION*)data->bufIn[0],                                            \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -273,13 +286,14 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
-                            (real_type_t<PRECISION>*)data->bufIn[1]);                              \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                               \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
             }                                                                                      \
@@ -302,14 +316,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_interleaved      \
                              || data->node->inArrayType                                            \
@@ -324,7 +339,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -332,7 +347,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -346,7 +362,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -354,7 +370,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -368,7 +385,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -377,7 +394,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
                 else                                                                               \
@@ -394,14 +412,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_interleaved      \
                              || data->node->inArrayType                                            \
@@ -416,7 +435,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -424,7 +443,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -438,7 +458,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -446,7 +466,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -460,7 +481,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -469,7 +490,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
             }                                                                                      \
@@ -489,14 +511,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_interleaved      \
                              || data->node->inArrayType                                            \
@@ -511,7 +534,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -519,7 +542,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -533,7 +557,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -541,7 +565,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -555,7 +580,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -564,7 +589,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
                 else                                                                               \
@@ -581,14 +607,15 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,             \
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_interleaved      \
                              || data->node->inArrayType                                            \
@@ -603,7 +630,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -611,7 +638,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (PRECISION*)data->bufIn[0],                                            \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -625,7 +653,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -633,7 +661,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             data->node->batch,                                                     \
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
-                            (PRECISION*)data->bufOut[0]);                                          \
+                            (PRECISION*)data->bufOut[0],                                           \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                     else if((data->node->inArrayType == rocfft_array_type_complex_planar           \
                              || data->node->inArrayType == rocfft_array_type_hermitian_planar)     \
@@ -647,7 +676,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                           \
                             0,                                                                     \
                             rocfft_stream,                                                         \
-                            (PRECISION*)data->node->twiddles.data(),                               \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                    \
                             data->node->length.size(),                                             \
                             data->node->devKernArg.data(),                                         \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,             \
@@ -656,7 +685,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             (real_type_t<PRECISION>*)data->bufIn[0],                               \
                             (real_type_t<PRECISION>*)data->bufIn[1],                               \
                             (real_type_t<PRECISION>*)data->bufOut[0],                              \
-                            (real_type_t<PRECISION>*)data->bufOut[1]);                             \
+                            (real_type_t<PRECISION>*)data->bufOut[1],                              \
+                            data->batchPointers);                                                  \
                     }                                                                              \
                 }                                                                                  \
             }                                                                                      \
@@ -674,11 +704,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
         DeviceCallIn* data          = (DeviceCallIn*)data_p;                                    \
         hipStream_t   rocfft_stream = data->rocfft_stream;                                      \
                                                                                                 \
-        /* The size of last dimension need to be counted into batch */                          \
-        /* Check how to config thread block in PlanPowX() for SBCC  */                          \
-        const size_t batch = (data->node->length.size() >= 3)                                   \
-                                 ? data->node->batch * data->node->length.back()                \
-                                 : data->node->batch;                                           \
+        /* The kernel walks every dimension above length[1], then the */                        \
+        /* batch at stride_in[dim]; see PlanPowX() for the grid      */                         \
+        const size_t batch = data->node->batch;                                                 \
                                                                                                 \
         if(data->node->placement == rocfft_placement_inplace)                                   \
         {                                                                                       \
@@ -689,7 +717,23 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                    && (data->node->outArrayType == rocfft_array_type_complex_interleaved        \
                        || data->node->outArrayType == rocfft_array_type_hermitian_interleaved)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(IP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0]);                                        \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(IP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -697,8 +741,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -713,8 +757,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -727,7 +771,24 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(IP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1]);                           \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(IP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -735,8 +796,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -752,8 +813,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -770,7 +831,23 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                    && (data->node->outArrayType == rocfft_array_type_complex_interleaved        \
                        || data->node->outArrayType == rocfft_array_type_hermitian_interleaved)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(IP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0]);                                        \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(IP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -778,8 +855,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -794,8 +871,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -808,7 +885,24 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(IP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1]);                           \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(IP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -816,8 +910,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -833,8 +927,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -854,7 +948,25 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                    && (data->node->outArrayType == rocfft_array_type_complex_interleaved        \
                        || data->node->outArrayType == rocfft_array_type_hermitian_interleaved)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0],                                         \
+                            (PRECISION*)data->bufOut[0]);                                       \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -862,8 +974,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -880,8 +992,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -896,7 +1008,26 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0],                                         \
+                            (real_type_t<PRECISION>*)data->bufOut[0],                           \
+                            (real_type_t<PRECISION>*)data->bufOut[1]);                          \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -904,8 +1035,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -923,8 +1054,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -941,7 +1072,26 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             || data->node->outArrayType                                         \
                                    == rocfft_array_type_hermitian_interleaved))                 \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                            \
+                            (PRECISION*)data->bufOut[0]);                                       \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -949,8 +1099,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -968,8 +1118,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -985,7 +1135,27 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true, true>),  \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                            \
+                            (real_type_t<PRECISION>*)data->bufOut[0],                           \
+                            (real_type_t<PRECISION>*)data->bufOut[1]);                          \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_FWD_KERN_NAME<PRECISION, SB_UNIT, true>),        \
@@ -993,8 +1163,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1013,8 +1183,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1034,7 +1204,25 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                    && (data->node->outArrayType == rocfft_array_type_complex_interleaved        \
                        || data->node->outArrayType == rocfft_array_type_hermitian_interleaved)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0],                                         \
+                            (PRECISION*)data->bufOut[0]);                                       \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -1042,8 +1230,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1060,8 +1248,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1076,7 +1264,26 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (PRECISION*)data->bufIn[0],                                         \
+                            (real_type_t<PRECISION>*)data->bufOut[0],                           \
+                            (real_type_t<PRECISION>*)data->bufOut[1]);                          \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -1084,8 +1291,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1103,8 +1310,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1121,7 +1328,26 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             || data->node->outArrayType                                         \
                                    == rocfft_array_type_hermitian_interleaved))                 \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                            \
+                            (PRECISION*)data->bufOut[0]);                                       \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -1129,8 +1355,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1148,8 +1374,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1165,7 +1391,27 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                         && (data->node->outArrayType == rocfft_array_type_complex_planar        \
                             || data->node->outArrayType == rocfft_array_type_hermitian_planar)) \
                 {                                                                               \
-                    if(data->node->large1D)                                                     \
+                    if(data->node->large1D && data->node->largeTwdSincos)                       \
+                    {                                                                           \
+                        hipLaunchKernelGGL(                                                     \
+                            HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true, true>), \
+                            dim3(data->gridParam.b_x),                                          \
+                            dim3(data->gridParam.tpb_x),                                        \
+                            0,                                                                  \
+                            rocfft_stream,                                                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
+                            data->node->length.size(),                                          \
+                            data->node->devKernArg.data(),                                      \
+                            data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
+                            data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,          \
+                            batch,                                                              \
+                            (real_type_t<PRECISION>*)data->bufIn[0],                            \
+                            (real_type_t<PRECISION>*)data->bufIn[1],                            \
+                            (real_type_t<PRECISION>*)data->bufOut[0],                           \
+                            (real_type_t<PRECISION>*)data->bufOut[1]);                          \
+                    }                                                                           \
+                    else if(data->node->large1D)                                                \
                     {                                                                           \
                         hipLaunchKernelGGL(                                                     \
                             HIP_KERNEL_NAME(OP_BACK_KERN_NAME<PRECISION, SB_UNIT, true>),       \
@@ -1173,8 +1419,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1193,8 +1439,8 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                             dim3(data->gridParam.tpb_x),                                        \
                             0,                                                                  \
                             rocfft_stream,                                                      \
-                            (PRECISION*)data->node->twiddles.data(),                            \
-                            (PRECISION*)data->node->twiddles_large.data(),                      \
+                            (compute_t<PRECISION>*)data->node->twiddles.data(),                 \
+                            (compute_t<PRECISION>*)data->node->twiddles_large.data(),           \
                             data->node->length.size(),                                          \
                             data->node->devKernArg.data(),                                      \
                             data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,          \
@@ -1216,11 +1462,9 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
         DeviceCallIn* data          = (DeviceCallIn*)data_p;                                     \
         hipStream_t   rocfft_stream = data->rocfft_stream;                                       \
                                                                                                  \
-        /* The size of last dimension need to be counted into batch */                           \
-        /* Check how to config thread block in PlanPowX() for SBRC  */                           \
-        const size_t batch = (data->node->length.size() >= 3)                                    \
-                                 ? data->node->batch * data->node->length.back()                 \
-                                 : data->node->batch;                                            \
+        /* The kernel walks every dimension above length[1], then the */                         \
+        /* batch at stride_in[dim]; see PlanPowX() for the grid      */                          \
+        const size_t batch = data->node->batch;                                                  \
                                                                                                  \
         if(data->node->direction == -1)                                                          \
         {                                                                                        \
@@ -1234,7 +1478,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1253,7 +1497,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1273,7 +1517,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1293,7 +1537,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1317,7 +1561,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1336,7 +1580,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1356,7 +1600,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1376,7 +1620,7 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
                                    dim3(data->gridParam.tpb_x),                                  \
                                    0,                                                            \
                                    rocfft_stream,                                                \
-                                   (PRECISION*)data->node->twiddles.data(),                      \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),           \
                                    data->node->length.size(),                                    \
                                    data->node->devKernArg.data(),                                \
                                    data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,    \
@@ -1390,4 +1634,96 @@ void rocfft_internal_transpose_var2(const void* data_p, void* back_p);
         }                                                                                        \
     }
 
+// Stockham kernels with the post-processing of even-length real forward
+// transforms fused into the last pass, or the pre-processing of inverse
+// ones fused into the first (CS_KERNEL_STOCKHAM_R_TO_CMPLX and
+// CS_KERNEL_CMPLX_TO_R_STOCKHAM).  The real side is interleaved, the
+// Hermitian side interleaved or planar, and the node's twiddles_large
+// holds the real twiddles.
+#define POWX_REAL_FUSED_GENERATOR(FUNCTION_NAME, FWD_KERN_NAME, BACK_KERN_NAME, PRECISION)     \
+    template <typename TH>                                                                     \
+    static void FUNCTION_NAME##_launch(const DeviceCallIn* data)                               \
+    {                                                                                          \
+        /* the stride of the real side picks the kernel */                                     \
+        if(data->node->direction == -1)                                                        \
+        {                                                                                      \
+            if(data->node->inStride[0] == 1)                                                   \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION, SB_UNIT, TH>),     \
+                                   dim3(data->gridParam.b_x),                                  \
+                                   dim3(data->gridParam.tpb_x),                                \
+                                   0,                                                          \
+                                   data->rocfft_stream,                                        \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),         \
+                                   (compute_t<PRECISION>*)data->node->twiddles_large.data(),   \
+                                   data->node->length.size(),                                  \
+                                   data->node->devKernArg.data(),                              \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->batch,                                          \
+                                   (PRECISION*)data->bufIn[0],                                 \
+                                   array_arg<TH>::make(data->bufOut));                         \
+            else                                                                               \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(FWD_KERN_NAME<PRECISION, SB_NONUNIT, TH>),  \
+                                   dim3(data->gridParam.b_x),                                  \
+                                   dim3(data->gridParam.tpb_x),                                \
+                                   0,                                                          \
+                                   data->rocfft_stream,                                        \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),         \
+                                   (compute_t<PRECISION>*)data->node->twiddles_large.data(),   \
+                                   data->node->length.size(),                                  \
+                                   data->node->devKernArg.data(),                              \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->batch,                                          \
+                                   (PRECISION*)data->bufIn[0],                                 \
+                                   array_arg<TH>::make(data->bufOut));                         \
+        }                                                                                      \
+        else                                                                                   \
+        {                                                                                      \
+            if(data->node->outStride[0] == 1)                                                  \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION, SB_UNIT, TH>),    \
+                                   dim3(data->gridParam.b_x),                                  \
+                                   dim3(data->gridParam.tpb_x),                                \
+                                   0,                                                          \
+                                   data->rocfft_stream,                                        \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),         \
+                                   (compute_t<PRECISION>*)data->node->twiddles_large.data(),   \
+                                   data->node->length.size(),                                  \
+                                   data->node->devKernArg.data(),                              \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->batch,                                          \
+                                   array_arg<TH>::make(data->bufIn),                           \
+                                   (PRECISION*)data->bufOut[0]);                               \
+            else                                                                               \
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(BACK_KERN_NAME<PRECISION, SB_NONUNIT, TH>), \
+                                   dim3(data->gridParam.b_x),                                  \
+                                   dim3(data->gridParam.tpb_x),                                \
+                                   0,                                                          \
+                                   data->rocfft_stream,                                        \
+                                   (compute_t<PRECISION>*)data->node->twiddles.data(),         \
+                                   (compute_t<PRECISION>*)data->node->twiddles_large.data(),   \
+                                   data->node->length.size(),                                  \
+                                   data->node->devKernArg.data(),                              \
+                                   data->node->devKernArg.data() + 1 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->devKernArg.data() + 2 * KERN_ARGS_ARRAY_WIDTH,  \
+                                   data->node->batch,                                          \
+                                   array_arg<TH>::make(data->bufIn),                           \
+                                   (PRECISION*)data->bufOut[0]);                               \
+        }                                                                                      \
+    }                                                                                          \
+                                                                                               \
+    void FUNCTION_NAME(const void* data_p, void* back_p)                                       \
+    {                                                                                          \
+        const DeviceCallIn* data = (const DeviceCallIn*)data_p;                                \
+                                                                                               \
+        const rocfft_array_type hermType = data->node->direction == -1                         \
+                                               ? data->node->outArrayType                      \
+                                               : data->node->inArrayType;                      \
+        if(is_complex_planar(hermType))                                                        \
+            FUNCTION_NAME##_launch<planar<PRECISION>>(data);                                   \
+        else                                                                                   \
+            FUNCTION_NAME##_launch<PRECISION>(data);                                           \
+    }
+
 #endif // KERNEL_LAUNCH_SINGLE
@@ -70,25 +70,23 @@ inline bool SupportedLength(rocfft_precision precision, size_t len)
         return true;
 
     // otherwise, see if there's a kernel for this specific length
+    return function_pool::has_function(precision, {len, CS_KERNEL_STOCKHAM});
+}
 
-    // function pool throws if the size was not found, so if no
-    // exception was observed, the size is supported
-    try
-    {
-        switch(precision)
-        {
-        case rocfft_precision_single:
-            function_pool::get_function_single({len, CS_KERNEL_STOCKHAM});
-            return true;
-        case rocfft_precision_double:
-            function_pool::get_function_double({len, CS_KERNEL_STOCKHAM});
-            return true;
-        }
-    }
-    catch(std::exception&)
-    {
-        return false;
-    }
+// Returns true if block column kernels (SBCC and SBRC) were generated
+// for this length
+inline bool SupportedBlockLength(rocfft_precision precision, size_t len)
+{
+    return function_pool::has_function(precision, {len, CS_KERNEL_STOCKHAM_BLOCK_CC})
+           && function_pool::has_function(precision, {len, CS_KERNEL_STOCKHAM_BLOCK_RC});
+}
+
+// Returns true if Stockham kernels with the even-length real
+// post/pre-processing fused in were generated for this length
+inline bool SupportedRealFusedLength(rocfft_precision precision, size_t len)
+{
+    return function_pool::has_function(precision, {len, CS_KERNEL_STOCKHAM_R_TO_CMPLX})
+           && function_pool::has_function(precision, {len, CS_KERNEL_CMPLX_TO_R_STOCKHAM});
 }
 
 inline size_t FindBlue(size_t len)
@@ -104,8 +102,8 @@ struct rocfft_plan_description_t
 
     rocfft_array_type inArrayType, outArrayType;
 
-    std::array<size_t, 3> inStrides;
-    std::array<size_t, 3> outStrides;
+    std::array<size_t, MAX_PLAN_RANK> inStrides;
+    std::array<size_t, MAX_PLAN_RANK> outStrides;
 
     size_t inDist;
     size_t outDist;
@@ -115,6 +113,10 @@ struct rocfft_plan_description_t
 
     double scale;
 
+    // never rocfft_backend_default: plans are built for a concrete backend
+    rocfft_execution_backend backend;
+    int                      padding; // it is only for 8 bytes alignment
+
     rocfft_plan_description_t()
     {
         inArrayType  = rocfft_array_type_complex_interleaved;
@@ -130,14 +132,17 @@ struct rocfft_plan_description_t
         outOffset.fill(0);
 
         scale = 1.0;
+
+        backend = rocfft_backend_device;
+        padding = 0;
     }
 };
 
 struct rocfft_plan_t
 {
-    size_t                rank;
-    std::array<size_t, 3> lengths;
-    size_t                batch;
+    size_t                            rank;
+    std::array<size_t, MAX_PLAN_RANK> lengths;
+    size_t                            batch;
 
     rocfft_result_placement placement;
     rocfft_transform_type   transformType;
@@ -46,6 +46,61 @@ DLL_PUBLIC rocfft_status rocfft_plan_create_internal(rocfft_plan             pla
 // plan allocation only
 DLL_PUBLIC rocfft_status rocfft_plan_allocate(rocfft_plan* plan);
 
+// rocfft_plan_create_internal in two steps: check and record the
+// plan's parameters, then build its tree and device resources
+DLL_PUBLIC rocfft_status rocfft_plan_describe_internal(rocfft_plan             plan,
+                                                       rocfft_result_placement placement,
+                                                       rocfft_transform_type   transform_type,
+                                                       rocfft_precision        precision,
+                                                       size_t                  dimensions,
+                                                       const size_t*           lengths,
+                                                       size_t                  number_of_transforms,
+                                                       const rocfft_plan_description description);
+DLL_PUBLIC rocfft_status rocfft_plan_build_internal(rocfft_plan plan);
+
+// work buffer size of a described plan, found from its tree alone,
+// without building it; rocfft_status_invalid_dimensions if the plan's
+// sizes have no tree
+DLL_PUBLIC rocfft_status
+    rocfft_plan_estimate_work_buffer_size_internal(const rocfft_plan plan, size_t* size_in_bytes);
+
+// fraction of the batch that a plan created for rocfft_backend_hybrid
+// gives to the host on its next execution; fails for plans that are
+// not split
+DLL_PUBLIC rocfft_status rocfft_plan_get_hybrid_share_internal(const rocfft_plan plan,
+                                                               double*           share);
+DLL_PUBLIC rocfft_status rocfft_plan_set_hybrid_share_internal(rocfft_plan plan, double share);
+
+// borrow the library's work buffer of at least 'size' bytes for
+// 'stream', as an execution without one would, until the lease is
+// returned; and the number of such buffers the library holds
+DLL_PUBLIC rocfft_status rocfft_workspace_pool_borrow_internal(void*  stream,
+                                                               size_t size,
+                                                               void** lease,
+                                                               void** data);
+DLL_PUBLIC rocfft_status rocfft_workspace_pool_return_internal(void* lease);
+DLL_PUBLIC rocfft_status rocfft_workspace_pool_get_count_internal(size_t* count);
+
+// transforms per thread block that a Stockham kernel of 'length' runs
+// 'count' transforms with, on a device with 'computeUnits' compute
+// units; rocfft_status_invalid_dimensions if the length has no
+// Stockham kernel, and rocfft_status_failure if the chosen variant
+// has none
+DLL_PUBLIC rocfft_status
+    rocfft_stockham_transforms_per_block_internal(rocfft_precision precision,
+                                                  size_t           length,
+                                                  size_t           count,
+                                                  size_t           computeUnits,
+                                                  size_t*          transformsPerBlock);
+
+// number of launches rocfft_execute_grouped makes for the plans, one
+// per kernel they share and one per plan run on its own, and the
+// number of streams it spreads them over
+DLL_PUBLIC rocfft_status rocfft_execute_grouped_schedule_internal(size_t            count,
+                                                                  const rocfft_plan plans[],
+                                                                  size_t*           launches,
+                                                                  size_t*           streams);
+
 DLL_PUBLIC rocfft_status rocfft_repo_get_unique_plan_count(size_t* count);
 DLL_PUBLIC rocfft_status rocfft_repo_get_total_plan_count(size_t* count);
 
@@ -24,19 +24,26 @@
 #if !defined(RADIX_TABLE_H)
 #define RADIX_TABLE_H
 
+#include <algorithm>
 #include <assert.h>
 #include <functional>
 #include <iostream>
+#include <tuple>
 #include <map>
 #include <vector>
 
 #include "rocfft.h"
 
-// Returns 1 for single-precision, 2 for double precision
+// Returns 1 for single-precision, 2 for double precision.  Half
+// precision shares the single-precision kernel set and thresholds:
+// kernels keep half-precision data in fp32 registers and LDS, and its
+// twiddle tables are fp32, so the LDS and register limits these
+// widths size kernels against are those of single precision.
 inline size_t PrecisionWidth(rocfft_precision precision)
 {
     switch(precision)
     {
+    case rocfft_precision_half:
     case rocfft_precision_single:
         return 1;
     case rocfft_precision_double:
@@ -47,11 +54,45 @@ inline size_t PrecisionWidth(rocfft_precision precision)
     }
 }
 
+// Returns the size in bytes of one real scalar of the given precision
+inline size_t RealTypeSize(rocfft_precision precision)
+{
+    switch(precision)
+    {
+    case rocfft_precision_half:
+        return 2;
+    case rocfft_precision_single:
+        return sizeof(float);
+    case rocfft_precision_double:
+        return sizeof(double);
+    default:
+        assert(false);
+        return sizeof(float);
+    }
+}
+
 inline size_t Large1DThreshold(rocfft_precision precision)
 {
     return 4096 / PrecisionWidth(precision);
 }
 
+// Decide whether large-1D twiddles (the extra twiddle multiply in
+// block column and transpose kernels) are computed in-kernel with
+// sincospi rather than read from a TwiddleTableLarge.
+//
+// The table costs one dependent 256-entry lookup and one complex
+// multiply per level, and needs three or more levels past 256*256.
+// Single-precision sincospi is a short polynomial on native hardware
+// and is also more accurate than three chained lookups; the
+// double-precision version is much slower than the table, so double
+// always keeps the table.
+inline bool LargeTwiddleSincos(rocfft_precision precision, size_t large1D)
+{
+    if(PrecisionWidth(precision) > 1)
+        return false;
+    return large1D > (size_t)256 * 256;
+}
+
 #define LARGE_1D_THRESHOLD 4096
 #define MAX_WORK_GROUP_SIZE 1024
 
@@ -62,6 +103,11 @@ inline size_t Large1DThreshold(rocfft_precision precision)
 //   __launch_bounds__.
 //   Further performance tuning might be done later.
 #define MAX_LAUNCH_BOUNDS_2D_SINGLE_KERNEL 256
+#define MAX_LAUNCH_BOUNDS_3D_SINGLE_KERNEL 512
+
+// Largest volume, in points, of a 3D_SINGLE kernel.  Larger volumes
+// leave too little LDS for more than one block per compute unit.
+#define MAX_3D_SINGLE_POINTS 2048
 
 /* radix table: tell the FFT algorithms for size <= 4096 ; required by twiddle,
  * passes, and kernel*/
@@ -101,49 +147,6 @@ inline const std::vector<SpecRecord>& GetRecord()
     return specRecord;
 }
 
-/* blockCompute table: used for large 1D kernels of size >= 8192 */
-inline void GetBlockComputeTable(size_t N, size_t& bwd, size_t& wgs, size_t& lds)
-{
-    switch(N)
-    {
-    case 256:
-        bwd = 8;
-        wgs = 256;
-        break;
-    case 128:
-        bwd = 8;
-        wgs = 128;
-        break;
-    case 64:
-        bwd = 16;
-        wgs = 128;
-        break;
-    case 32:
-        bwd = 32;
-        wgs = 64;
-        break;
-    case 16:
-        bwd = 64;
-        wgs = 64;
-        break;
-    case 8:
-        bwd = 128;
-        wgs = 64;
-        break;
-    case 81:
-        bwd = 9;
-        wgs = 81;
-        break;
-    case 100:
-        bwd = 5;
-        wgs = 50;
-        break;
-    default:
-        assert(0); // should not happen
-    }
-    lds = N * bwd;
-}
-
 /* =====================================================================
    Calculate grid and thread blocks (work groups, work items)
        in kernel generator if no predefined table
@@ -354,8 +357,107 @@ inline void DetermineSizes(const size_t& length, size_t& workGroupSize, size_t&
 std::vector<size_t> GetRadices(size_t length);
 void                GetWGSAndNT(size_t length, size_t& workGroupSize, size_t& numTransforms);
 
+// Radices the generator emits host butterflies for (rocfft_butterfly_host.h),
+// largest first.  The host backend factors each length greedily over this
+// list and handles any leftover prime factor with a direct DFT pass.
+inline const std::vector<size_t>& HostButterflyRadices()
+{
+    static const std::vector<size_t> radices = {10, 8, 7, 6, 5, 4, 3, 2};
+    return radices;
+}
+
+/* blockCompute table: used for SBCC/SBRC kernels in large 1D and 2D plans.
+   The listed sizes were tuned by hand, the rest are derived. */
+inline void GetBlockComputeTable(size_t N, size_t& bwd, size_t& wgs, size_t& lds)
+{
+    switch(N)
+    {
+    case 256:
+        bwd = 8;
+        wgs = 256;
+        break;
+    case 128:
+        bwd = 8;
+        wgs = 128;
+        break;
+    case 64:
+        bwd = 16;
+        wgs = 128;
+        break;
+    case 32:
+        bwd = 32;
+        wgs = 64;
+        break;
+    case 16:
+        bwd = 64;
+        wgs = 64;
+        break;
+    case 8:
+        bwd = 128;
+        wgs = 64;
+        break;
+    case 81:
+        bwd = 9;
+        wgs = 81;
+        break;
+    case 100:
+        bwd = 5;
+        wgs = 50;
+        break;
+    default:
+    {
+        // Derive the block for other sizes.  The block of N * bwd
+        // complex elements has to fit in 32KB of LDS for double2, and
+        // the work group runs (wgs / tpt) transforms side by side,
+        // where tpt is the number of threads the small kernel uses per
+        // transform.  The generated code needs those concurrent
+        // transforms to divide bwd, and bwd to divide wgs.
+        size_t tpt = 0;
+        for(const auto& r : GetRecord())
+        {
+            if(r.length == N)
+            {
+                tpt = r.workGroupSize / r.numTransforms;
+                break;
+            }
+        }
+        if(tpt == 0)
+        {
+            size_t smallWGS, smallNT;
+            DetermineSizes(N, smallWGS, smallNT);
+            tpt = smallWGS / smallNT;
+        }
+
+        // Prefer the largest work group, then the widest block.  Block
+        // widths dividing N make it likelier that the other dimension
+        // of a large 1D split is a multiple of bwd.
+        bwd = 0;
+        wgs = 0;
+        for(size_t w = std::min<size_t>(64, 2048 / N); w > 0; --w)
+        {
+            if(N % w != 0)
+                continue;
+            for(size_t k = w; k > 0; --k)
+            {
+                if(w % k == 0 && k * tpt <= 256 && tpt % (w / k) == 0)
+                {
+                    if(k * tpt > wgs)
+                    {
+                        bwd = w;
+                        wgs = k * tpt;
+                    }
+                    break;
+                }
+            }
+        }
+        assert(wgs != 0);
+    }
+    }
+    lds = N * bwd;
+}
+
 // Get the number of threads required for a 2D_SINGLE kernel
-static size_t Get2DSingleThreadCount(size_t                                        length0,
+inline size_t Get2DSingleThreadCount(size_t                                        length0,
                                      size_t                                        length1,
                                      std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
 {
@@ -375,7 +477,7 @@ static size_t Get2DSingleThreadCount(size_t
     return std::max(numThreads0, numThreads1);
 }
 
-static void Add2DSingleSize(size_t                                        i,
+inline void Add2DSingleSize(size_t                                        i,
                             size_t                                        j,
                             size_t                                        realSizeBytes,
                             size_t                                        elementSizeBytes,
@@ -404,7 +506,7 @@ static void Add2DSingleSize(size_t                                        i,
 // single kernels to generate code for.
 //
 // At runtime you would pass the actual LDS size for the device.
-static std::vector<std::pair<size_t, size_t>>
+inline std::vector<std::pair<size_t, size_t>>
     Single2DSizes(size_t                                        ldsSizeBytes,
                   rocfft_precision                              precision,
                   std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
@@ -418,8 +520,9 @@ static std::vector<std::pair<size_t, size_t>>
     else
         ldsSizeBytes = std::min(ldsSizeBytes, MAX_LDS_SIZE_BYTES);
 
-    // size of each real
-    size_t realSizeBytes = precision == rocfft_precision_single ? sizeof(float) : sizeof(double);
+    // size of each real; half-precision 2D kernels are instantiated
+    // from the single-precision size set, so size them as single
+    size_t realSizeBytes = precision == rocfft_precision_double ? sizeof(double) : sizeof(float);
     // assume each element is complex, since that's what we need to
     // store temporarily during the transform
     size_t elementSizeBytes = 2 * realSizeBytes;
@@ -500,4 +603,196 @@ static std::vector<std::pair<size_t, size_t>>
     return retval;
 }
 
+// Get the number of threads required for a 3D_SINGLE kernel
+inline size_t Get3DSingleThreadCount(size_t                                        length0,
+                                     size_t                                        length1,
+                                     size_t                                        length2,
+                                     std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    size_t complexNumsPerTransform = length0 * length1 * length2;
+    size_t numThreads              = 0;
+    for(auto len : {length0, length1, length2})
+    {
+        size_t workGroupSize;
+        size_t numTransforms;
+        _GetWGSAndNT(len, workGroupSize, numTransforms);
+        size_t cnPerWI = (numTransforms * len) / workGroupSize;
+        numThreads     = std::max(numThreads, complexNumsPerTransform / cnPerWI);
+    }
+    return numThreads;
+}
+
+inline void Add3DSingleSize(size_t                                           i,
+                            size_t                                           j,
+                            size_t                                           k,
+                            size_t                                           realSizeBytes,
+                            size_t                                           elementSizeBytes,
+                            size_t                                           ldsSizeBytes,
+                            std::function<void(size_t, size_t&, size_t&)>    _GetWGSAndNT,
+                            std::vector<std::tuple<size_t, size_t, size_t>>& retval)
+{
+    // Same LDS budget as the 2D single kernels: the whole volume is
+    // kept in LDS between passes, plus butterfly temp space in reals.
+    size_t N = i * j * k;
+    if(N > MAX_3D_SINGLE_POINTS)
+        return;
+    if((N * elementSizeBytes) + (N * realSizeBytes) <= ldsSizeBytes)
+        // The kernel is compiled with fixed launch bounds, so the
+        // largest of the three passes must fit in them
+        if(Get3DSingleThreadCount(i, j, k, _GetWGSAndNT) <= MAX_LAUNCH_BOUNDS_3D_SINGLE_KERNEL)
+            retval.push_back(std::make_tuple(i, j, k));
+}
+
+// Available sizes for 3D single kernels, for a given size of LDS.
+// Like Single2DSizes, specify 0 for LDS size to get the set of
+// kernels to generate code for.
+inline std::vector<std::tuple<size_t, size_t, size_t>>
+    Single3DSizes(size_t                                        ldsSizeBytes,
+                  rocfft_precision                              precision,
+                  std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    std::vector<std::tuple<size_t, size_t, size_t>> retval;
+    static const size_t MAX_LDS_SIZE_BYTES = 64 * 1024;
+    if(ldsSizeBytes == 0)
+        ldsSizeBytes = MAX_LDS_SIZE_BYTES;
+    else
+        ldsSizeBytes = std::min(ldsSizeBytes, MAX_LDS_SIZE_BYTES);
+
+    // half-precision 3D kernels are instantiated from the
+    // single-precision size set, so size them as single
+    size_t realSizeBytes    = precision == rocfft_precision_double ? sizeof(double) : sizeof(float);
+    size_t elementSizeBytes = 2 * realSizeBytes;
+
+    // only generate volumes whose dimensions share a radix; mixed
+    // volumes still get 2D_SINGLE + SBCC through CS_3D_RC
+    static const size_t MAX_3D_POW2 = 64;
+    static const size_t MIN_3D_POW2 = 4;
+    for(size_t i = MAX_3D_POW2; i >= MIN_3D_POW2; i /= 2)
+        for(size_t j = MAX_3D_POW2; j >= MIN_3D_POW2; j /= 2)
+            for(size_t k = MAX_3D_POW2; k >= MIN_3D_POW2; k /= 2)
+                Add3DSingleSize(
+                    i, j, k, realSizeBytes, elementSizeBytes, ldsSizeBytes, _GetWGSAndNT, retval);
+
+    static const size_t MAX_3D_POW3 = 81;
+    static const size_t MIN_3D_POW3 = 3;
+    for(size_t i = MAX_3D_POW3; i >= MIN_3D_POW3; i /= 3)
+        for(size_t j = MAX_3D_POW3; j >= MIN_3D_POW3; j /= 3)
+            for(size_t k = MAX_3D_POW3; k >= MIN_3D_POW3; k /= 3)
+                Add3DSingleSize(
+                    i, j, k, realSizeBytes, elementSizeBytes, ldsSizeBytes, _GetWGSAndNT, retval);
+
+    static const size_t MAX_3D_POW5 = 125;
+    static const size_t MIN_3D_POW5 = 5;
+    for(size_t i = MAX_3D_POW5; i >= MIN_3D_POW5; i /= 5)
+        for(size_t j = MAX_3D_POW5; j >= MIN_3D_POW5; j /= 5)
+            for(size_t k = MAX_3D_POW5; k >= MIN_3D_POW5; k /= 5)
+                Add3DSingleSize(
+                    i, j, k, realSizeBytes, elementSizeBytes, ldsSizeBytes, _GetWGSAndNT, retval);
+
+    return retval;
+}
+
+// Returns true if the Stockham kernel of this length also has variants
+// with the even-length real post-processing fused into its last pass
+// and the pre-processing fused into its first.  Those keep each row in
+// LDS a second time, as planar reals, to exchange elements k and
+// length - k between threads.  Like Single2DSizes, specify 0 for LDS
+// size to decide what to generate code for.
+inline bool RealFusedFitsLDS(size_t                                        length,
+                             size_t                                        ldsSizeBytes,
+                             rocfft_precision                              precision,
+                             std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    static const size_t MAX_LDS_SIZE_BYTES = 64 * 1024;
+    if(ldsSizeBytes == 0)
+        ldsSizeBytes = MAX_LDS_SIZE_BYTES;
+    else
+        ldsSizeBytes = std::min(ldsSizeBytes, MAX_LDS_SIZE_BYTES);
+
+    // half-precision kernels are instantiated for the single-precision
+    // lengths, so size them as single
+    size_t realSizeBytes = precision == rocfft_precision_double ? sizeof(double) : sizeof(float);
+
+    size_t workGroupSize;
+    size_t numTransforms;
+    _GetWGSAndNT(length, workGroupSize, numTransforms);
+
+    // the kernel's own LDS of one real per element, plus the planar row
+    return 3 * length * numTransforms * realSizeBytes <= ldsSizeBytes;
+}
+
+// Transforms per thread block of the CS_KERNEL_STOCKHAM kernels
+// generated for a length, the default from _GetWGSAndNT first.  The
+// others scale the work group by the same factor as the transforms,
+// so they run the same passes and differ only in how they tile a
+// batch over blocks:
+//
+// - fewer transforms per block, for batches too small to give every
+//   compute unit a block.  Blocks stay at least a wavefront wide,
+//   since narrower ones would add blocks but no parallelism.
+// - twice the transforms per block, for batches that keep every
+//   compute unit busy anyway, so that each block spreads its setup
+//   and twiddle loads over more transforms.  The block stays within
+//   256 threads, and its LDS within that of the longest
+//   single-kernel length of the precision.
+//
+// Double precision gets a subset of the single-precision variants.
+inline std::vector<size_t>
+    StockhamTransformsPerBlock(size_t                                        length,
+                               rocfft_precision                              precision,
+                               std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    size_t workGroupSize;
+    size_t numTransforms;
+    _GetWGSAndNT(length, workGroupSize, numTransforms);
+
+    std::vector<size_t> retval = {numTransforms};
+    if(workGroupSize % numTransforms != 0)
+        return retval;
+    const size_t threadsPerTransform = workGroupSize / numTransforms;
+
+    // a wavefront is 64 threads
+    const size_t fewer = (64 + threadsPerTransform - 1) / threadsPerTransform;
+    if(fewer < numTransforms)
+        retval.push_back(fewer);
+
+    if((2 * workGroupSize <= 256)
+       && (2 * numTransforms * length <= Large1DThreshold(precision)))
+        retval.push_back(2 * numTransforms);
+
+    return retval;
+}
+
+// Blocks per compute unit a batch must fill with the larger Stockham
+// blocks before it uses them
+#define STOCKHAM_BLOCKS_PER_CU 8
+
+// Choose among StockhamTransformsPerBlock for a Stockham kernel
+// running 'count' transforms, on a device with 'computeUnits' compute
+// units.  Give 0 compute units, if unknown, for the default.
+inline size_t
+    ChooseStockhamTransformsPerBlock(size_t                                        length,
+                                     rocfft_precision                              precision,
+                                     size_t                                        count,
+                                     size_t                                        computeUnits,
+                                     std::function<void(size_t, size_t&, size_t&)> _GetWGSAndNT)
+{
+    const auto variants = StockhamTransformsPerBlock(length, precision, _GetWGSAndNT);
+    size_t     chosen   = variants.front();
+    if(computeUnits == 0)
+        return chosen;
+
+    auto blocks = [count](size_t numTransforms) {
+        return (count + numTransforms - 1) / numTransforms;
+    };
+    for(auto numTransforms : variants)
+    {
+        if(blocks(variants.front()) < computeUnits)
+            chosen = std::min(chosen, numTransforms);
+        else if(blocks(numTransforms) >= STOCKHAM_BLOCKS_PER_CU * computeUnits)
+            chosen = std::max(chosen, numTransforms);
+    }
+    return chosen;
+}
+
 #endif // defined( RADIX_TABLE_H )
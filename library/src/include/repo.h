@@ -57,6 +57,14 @@ public:
     static size_t        GetUniquePlanCount();
     static size_t        GetTotalPlanCount();
 
+    // build the plan tree and device resources for a plan without
+    // storing them in the repo
+    static bool BuildExecPlan(const rocfft_plan_t& plan, ExecPlan& execPlan);
+
+    // build just the plan tree, which needs no device resources;
+    // false if the plan's sizes cannot be transformed
+    static bool BuildTree(const rocfft_plan_t& plan, ExecPlan& execPlan);
+
     // Repo is a singleton that should only be destroyed on static
     // deinitialization.  But it's possible for other things to want to
     // destroy plans at static deinitialization time.  So keep track of
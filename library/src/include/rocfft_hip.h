@@ -25,4 +25,19 @@
 
 #include <hip/hip_runtime.h>
 
+// Half-precision vector types, used as the complex (2-wide) and
+// 4-wide element types for rocfft_precision_half.
+typedef HIP_vector_type<_Float16, 2> rocfft_half2;
+typedef HIP_vector_type<_Float16, 4> rocfft_half4;
+
+// Buffers of a batch whose transforms are allocated separately: device
+// arrays, one per plane, of the address of each transform's data.
+// Small Stockham kernels index them by transform in place of adding
+// the batch distance to their buffer arguments, when in[0] is set.
+struct BatchPointers
+{
+    void* const* in[2];
+    void* const* out[2];
+};
+
 #endif // __ROCFFT_HIP_H__
@@ -30,6 +30,14 @@ struct rocfft_execution_info_t
     void*       workBuffer;
     size_t      workBufferSize;
     hipStream_t rocfft_stream = 0; // by default it is stream 0
+    // by default the backend the plan was created for
+    rocfft_execution_backend backend = rocfft_backend_default;
+    // coalescing window, off while coalesceCount is below 2
+    size_t coalesceCount  = 0;
+    size_t coalesceWaitUs = 0;
+    // pointer tables of rocfft_execute_pointer_array, for a plan whose
+    // kernel indexes them
+    BatchPointers batchPointers = {};
     rocfft_execution_info_t()
         : workBuffer(nullptr)
         , workBufferSize(0)
@@ -42,4 +50,12 @@ void TransformPowX(const ExecPlan&       execPlan,
                    void*                 out_buffer[],
                    rocfft_execution_info info);
 
+// TransformPowX, except that a plan that needs a work buffer, run
+// without one in 'info', borrows the library's buffer for the stream
+// of 'info' while its kernels are enqueued
+rocfft_status TransformPowXBorrowing(const ExecPlan&       execPlan,
+                                     void*                 in_buffer[],
+                                     void*                 out_buffer[],
+                                     rocfft_execution_info info);
+
 #endif // TRANSFORM_H
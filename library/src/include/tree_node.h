@@ -27,7 +27,7 @@
 #include <memory>
 #include <vector>
 
-#include "gpubuf.h"
+#include "device_runtime.h"
 #include "kargs.h"
 #include "rocfft_ostream.hpp"
 #include "twiddles.h"
@@ -63,6 +63,8 @@ enum ComputeScheme
     CS_KERNEL_R_TO_CMPLX_TRANSPOSE,
     CS_KERNEL_CMPLX_TO_R,
     CS_KERNEL_TRANSPOSE_CMPLX_TO_R,
+    CS_KERNEL_STOCKHAM_R_TO_CMPLX,
+    CS_KERNEL_CMPLX_TO_R_STOCKHAM,
     CS_REAL_2D_EVEN,
     CS_REAL_3D_EVEN,
 
@@ -91,7 +93,9 @@ enum ComputeScheme
     CS_3D_RTRT,
     CS_3D_RC,
     CS_KERNEL_3D_STOCKHAM_BLOCK_CC,
-    CS_KERNEL_3D_SINGLE
+    CS_KERNEL_3D_SINGLE,
+
+    CS_ND_RC
 };
 
 enum TransTileDir
@@ -110,6 +114,7 @@ private:
         , obIn(OB_UNINIT)
         , obOut(OB_UNINIT)
         , large1D(0)
+        , largeTwdSincos(false)
         , lengthBlue(0)
         , iDist(0)
         , oDist(0)
@@ -138,6 +143,16 @@ private:
     // transform sizes
     size_t div1DNoPo2(const size_t length0);
 
+    // Find a split of length0 that can use block column kernels.
+    // Returns CS_L1D_CC or CS_L1D_CRT and sets divLength1, or returns
+    // CS_NONE if no split is possible.
+    ComputeScheme div1DBlock(const size_t length0, size_t& divLength1);
+
+    // Find a split of length0 too large for div1DBlock: a block column
+    // pass and rows that are themselves a large 1D plan.  Returns
+    // CS_L1D_CRT and sets divLength1, or CS_NONE.
+    ComputeScheme div1DLarge(const size_t length0, size_t& divLength1);
+
 public:
     // Batch size
     size_t batch;
@@ -171,6 +186,9 @@ public:
 
     // Extra twiddle multiplication for large 1D
     size_t large1D;
+    // Compute the large 1D twiddles in-kernel instead of reading
+    // twiddles_large (see LargeTwiddleSincos)
+    bool largeTwdSincos;
 
     // Tree structure:
     // non-owning pointer to parent node, may be null
@@ -189,9 +207,9 @@ public:
     size_t lengthBlue;
 
     // Device pointers:
-    gpubuf           twiddles;
-    gpubuf           twiddles_large;
-    gpubuf_t<size_t> devKernArg;
+    devbuf           twiddles;
+    devbuf           twiddles_large;
+    devbuf_t<size_t> devKernArg;
 
 public:
     // Disallow copy constructor:
@@ -212,7 +230,11 @@ public:
     void RecursiveBuildTree();
 
     bool use_CS_2D_SINGLE(); // To determine using scheme CS_KERNEL_2D_SINGLE or not
+    bool use_CS_3D_SINGLE(); // To determine using scheme CS_KERNEL_3D_SINGLE or not
     bool use_CS_2D_RC(); // To determine using scheme CS_2D_RC or not
+    bool use_CS_3D_RC(); // To determine using scheme CS_3D_RC or not
+    // To determine doing the columns along dimension 'dim' with the SBCC kernel or not
+    bool use_block_columns(size_t dim);
 
     // Real-complex and complex-real node builders:
     void build_real();
@@ -222,6 +244,17 @@ public:
     void build_real_even_3D();
     void build_real_pair();
 
+    // How the half-length complex data of an even-length real
+    // transform is viewed in its real buffer: interleaved, or planar
+    // when a 1D transform's real side has a non-unit stride.
+    rocfft_array_type RealAsComplexType() const;
+
+    // Distance in reals from the real to the imaginary parts of the
+    // planar view of real data, for the nodes of an even-length or
+    // paired real transform that work on real data as complex; 0 for
+    // other nodes.
+    size_t RealViewOffset() const;
+
     // 1D node builders:
     void build_1D();
     void build_1DBluestein();
@@ -239,6 +272,9 @@ public:
     // 3D 6 node builder, T: transpose Z_XY, R: row FFTs, T: transpose Z_XY, R: row FFTs, T: transpose Z_XY, R: row FFTs
     void build_CS_3D_TRTRTR();
 
+    // Higher rank node builder, R: 3D FFTs or row FFTs, C: column FFTs along each other dimension
+    void build_CS_ND_RC();
+
     // State maintained while traversing the tree.
     //
     // Preparation and execution of the tree basically involves a
@@ -311,6 +347,10 @@ public:
                                      OperatingBuffer& flipIn,
                                      OperatingBuffer& flipOut,
                                      OperatingBuffer& obOutBuf);
+    void assign_buffers_CS_ND_RC(TraverseState&   state,
+                                 OperatingBuffer& flipIn,
+                                 OperatingBuffer& flipOut,
+                                 OperatingBuffer& obOutBuf);
 
     // Set placement variable and in/out array types
     void TraverseTreeAssignPlacementsLogicA(rocfft_array_type rootIn, rocfft_array_type rootOut);
@@ -331,6 +371,7 @@ public:
     void assign_params_CS_3D_RTRT();
     void assign_params_CS_3D_TRTRTR();
     void assign_params_CS_3D_RC_STRAIGHT();
+    void assign_params_CS_ND_RC();
 
     // Determine work memory requirements:
     void TraverseTreeCollectLeafsLogicA(std::vector<TreeNode*>& seq,
@@ -367,6 +408,18 @@ struct GridParam
     }
 };
 
+struct HybridState;
+
+// Two adjacent kernels of a plan that run as one, and the bytes of
+// global memory traffic that saves
+struct NodeFusion
+{
+    ComputeScheme producer;
+    ComputeScheme consumer;
+    ComputeScheme fused;
+    size_t        bytesSaved;
+};
+
 struct ExecPlan
 {
     // shared pointer allows for ExecPlans to be copyable
@@ -383,6 +436,16 @@ struct ExecPlan
     size_t                 copyWorkBufSize  = 0;
     size_t                 blueWorkBufSize  = 0;
     size_t                 chirpWorkBufSize = 0;
+
+    // kernels fused by OptimizePlan
+    std::vector<NodeFusion> fusions;
+
+    // host plans have no twiddles, kernel arguments or device functions
+    rocfft_execution_backend backend = rocfft_backend_device;
+
+    // batch split of a rocfft_backend_hybrid plan, shared by all
+    // copies of the ExecPlan
+    std::shared_ptr<HybridState> hybrid;
 };
 
 void ProcessNode(ExecPlan& execPlan);
@@ -6,7 +6,7 @@
 #if !defined(TWIDDLES_H)
 #define TWIDDLES_H
 
-#include "gpubuf.h"
+#include "device_runtime.h"
 #include "rocfft.h"
 #include <cassert>
 #include <math.h>
@@ -180,7 +180,8 @@ public:
     }
 };
 
-gpubuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices);
-gpubuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision);
+devbuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices);
+devbuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision);
+devbuf twiddles_create_3D(size_t N1, size_t N2, size_t N3, rocfft_precision precision);
 
 #endif // defined( TWIDDLES_H )
@@ -0,0 +1,59 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <memory>
+#include <mutex>
+
+#include "rocfft_hip.h"
+
+// Work buffers the library lends to executions that were given none,
+// one per device and stream.  An execution holds its stream's buffer
+// while it enqueues its kernels; executions that follow on the same
+// stream run after it on the device, so they can reuse the buffer,
+// which grows to the largest requirement seen on that stream.
+namespace WorkspacePool
+{
+    struct Workspace;
+
+    // a stream's buffer, locked for as long as the lease lives; the
+    // lease shares ownership of it, so the buffer outlives Release
+    // until the lease ends
+    struct Lease
+    {
+        std::shared_ptr<Workspace>   workspace;
+        std::unique_lock<std::mutex> lock; // released before 'workspace'
+        void*                        data = nullptr;
+    };
+
+    // borrow at least 'size' bytes for work enqueued on 'stream';
+    // data is null if the buffer could not grow
+    Lease Borrow(hipStream_t stream, size_t size);
+
+    // drop the pool's buffers; each is freed once no lease holds it
+    void Release();
+
+    // number of buffers in the pool
+    size_t Count();
+}
+
+#endif // WORKSPACE_H
@@ -24,13 +24,13 @@
 #include "rocfft_hip.h"
 
 // malloc device buffer; copy host buffer to device buffer
-gpubuf_t<size_t> kargs_create(std::vector<size_t> length,
+devbuf_t<size_t> kargs_create(std::vector<size_t> length,
                               std::vector<size_t> inStride,
                               std::vector<size_t> outStride,
                               size_t              iDist,
                               size_t              oDist)
 {
-    gpubuf_t<size_t> devk;
+    devbuf_t<size_t> devk;
     if(devk.alloc(3 * KERN_ARGS_ARRAY_WIDTH * sizeof(size_t)) != hipSuccess)
         return devk;
 
@@ -42,6 +42,7 @@ gpubuf_t<size_t> kargs_create(std::vector<size_t> length,
 
     assert(length.size() == inStride.size());
     assert(length.size() == outStride.size());
+    assert(length.size() < KERN_ARGS_ARRAY_WIDTH);
 
     i = 0;
     while(i < length.size())
@@ -55,7 +56,7 @@ gpubuf_t<size_t> kargs_create(std::vector<size_t> length,
     devkHost[i + 1 * KERN_ARGS_ARRAY_WIDTH] = iDist;
     devkHost[i + 2 * KERN_ARGS_ARRAY_WIDTH] = oDist;
 
-    if(hipMemcpy(
+    if(device_runtime().memcpy(
            devk.data(), devkHost, 3 * KERN_ARGS_ARRAY_WIDTH * sizeof(size_t), hipMemcpyHostToDevice)
        != hipSuccess)
         devk.free();
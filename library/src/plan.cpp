@@ -68,6 +68,8 @@ std::string PrintScheme(ComputeScheme cs)
            {ENUMSTR(CS_KERNEL_R_TO_CMPLX_TRANSPOSE)},
            {ENUMSTR(CS_KERNEL_CMPLX_TO_R)},
            {ENUMSTR(CS_KERNEL_TRANSPOSE_CMPLX_TO_R)},
+           {ENUMSTR(CS_KERNEL_STOCKHAM_R_TO_CMPLX)},
+           {ENUMSTR(CS_KERNEL_CMPLX_TO_R_STOCKHAM)},
            {ENUMSTR(CS_REAL_2D_EVEN)},
            {ENUMSTR(CS_REAL_3D_EVEN)},
 
@@ -96,7 +98,9 @@ std::string PrintScheme(ComputeScheme cs)
            {ENUMSTR(CS_3D_RTRT)},
            {ENUMSTR(CS_3D_RC)},
            {ENUMSTR(CS_KERNEL_3D_STOCKHAM_BLOCK_CC)},
-           {ENUMSTR(CS_KERNEL_3D_SINGLE)}};
+           {ENUMSTR(CS_KERNEL_3D_SINGLE)},
+
+           {ENUMSTR(CS_ND_RC)}};
 
     return ComputeSchemetoString.at(cs);
 }
@@ -199,7 +203,7 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
 
     if(in_strides != nullptr)
     {
-        for(size_t i = 0; i < std::min((size_t)3, in_strides_size); i++)
+        for(size_t i = 0; i < std::min((size_t)MAX_PLAN_RANK, in_strides_size); i++)
             description->inStrides[i] = in_strides[i];
     }
 
@@ -208,7 +212,7 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
 
     if(out_strides != nullptr)
     {
-        for(size_t i = 0; i < std::min((size_t)3, out_strides_size); i++)
+        for(size_t i = 0; i < std::min((size_t)MAX_PLAN_RANK, out_strides_size); i++)
             description->outStrides[i] = out_strides[i];
     }
 
@@ -218,6 +222,18 @@ rocfft_status rocfft_plan_description_set_data_layout(rocfft_plan_description de
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_plan_description_set_backend(rocfft_plan_description        description,
+                                                  const rocfft_execution_backend backend)
+{
+    log_trace(__func__, "description", description, "backend", backend);
+    if(backend != rocfft_backend_default && backend != rocfft_backend_device
+       && backend != rocfft_backend_host && backend != rocfft_backend_hybrid)
+        return rocfft_status_invalid_arg_value;
+    description->backend
+        = (backend == rocfft_backend_default) ? rocfft_backend_device : backend;
+    return rocfft_status_success;
+}
+
 rocfft_status rocfft_plan_description_create(rocfft_plan_description* description)
 {
     rocfft_plan_description desc = new rocfft_plan_description_t;
@@ -234,14 +250,14 @@ rocfft_status rocfft_plan_description_destroy(rocfft_plan_description descriptio
     return rocfft_status_success;
 }
 
-rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
-                                          const rocfft_result_placement placement,
-                                          const rocfft_transform_type   transform_type,
-                                          const rocfft_precision        precision,
-                                          const size_t                  dimensions,
-                                          const size_t*                 lengths,
-                                          const size_t                  number_of_transforms,
-                                          const rocfft_plan_description description)
+rocfft_status rocfft_plan_describe_internal(rocfft_plan                   plan,
+                                            const rocfft_result_placement placement,
+                                            const rocfft_transform_type   transform_type,
+                                            const rocfft_precision        precision,
+                                            const size_t                  dimensions,
+                                            const size_t*                 lengths,
+                                            const size_t                  number_of_transforms,
+                                            const rocfft_plan_description description)
 {
     // Check plan validity
     if(description != nullptr)
@@ -295,14 +311,12 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
         }
     }
 
-    if(dimensions > 3)
+    if(dimensions > MAX_PLAN_RANK)
         return rocfft_status_invalid_dimensions;
 
     rocfft_plan p = plan;
     p->rank       = dimensions;
-    p->lengths[0] = 1;
-    p->lengths[1] = 1;
-    p->lengths[2] = 1;
+    p->lengths.fill(1);
     for(size_t ilength = 0; ilength < dimensions; ++ilength)
     {
         p->lengths[ilength] = lengths[ilength];
@@ -310,7 +324,7 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
     p->batch          = number_of_transforms;
     p->placement      = placement;
     p->precision      = precision;
-    p->base_type_size = (precision == rocfft_precision_double) ? sizeof(double) : sizeof(float);
+    p->base_type_size = RealTypeSize(precision);
     p->transformType  = transform_type;
 
     if(description != nullptr)
@@ -444,8 +458,46 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
     //     return rocfft_status_invalid_dimensions;
     // }
 
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_plan_build_internal(rocfft_plan plan)
+{
     // add this plan into repo, incurs computation, see repo.cpp
-    return Repo::GetRepo().CreatePlan(p);
+    return Repo::GetRepo().CreatePlan(plan);
+}
+
+rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
+                                          const rocfft_result_placement placement,
+                                          const rocfft_transform_type   transform_type,
+                                          const rocfft_precision        precision,
+                                          const size_t                  dimensions,
+                                          const size_t*                 lengths,
+                                          const size_t                  number_of_transforms,
+                                          const rocfft_plan_description description)
+{
+    const rocfft_status status = rocfft_plan_describe_internal(plan,
+                                                               placement,
+                                                               transform_type,
+                                                               precision,
+                                                               dimensions,
+                                                               lengths,
+                                                               number_of_transforms,
+                                                               description);
+    if(status != rocfft_status_success)
+        return status;
+    return rocfft_plan_build_internal(plan);
+}
+
+rocfft_status rocfft_plan_estimate_work_buffer_size_internal(const rocfft_plan plan,
+                                                             size_t*           size_in_bytes)
+{
+    ExecPlan execPlan;
+    if(!Repo::BuildTree(*plan, execPlan))
+        return rocfft_status_invalid_dimensions;
+    *size_in_bytes = execPlan.workBufSize * 2 * plan->base_type_size;
+    log_trace(__func__, "plan", plan, "size_in_bytes ptr", size_in_bytes, "val", *size_in_bytes);
+    return rocfft_status_success;
 }
 
 rocfft_status rocfft_plan_allocate(rocfft_plan* plan)
@@ -499,6 +551,8 @@ rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
         ss << " -o ";
     if(precision == rocfft_precision_double)
         ss << " --double ";
+    else if(precision == rocfft_precision_half)
+        ss << " --half ";
     if(description != NULL)
         ss << " --isX " << description->inStrides[0] << " --isY " << description->inStrides[1]
            << " --isZ " << description->inStrides[2] << " --osX " << description->outStrides[0]
@@ -548,9 +602,7 @@ rocfft_status rocfft_plan_get_print(const rocfft_plan plan)
 {
     log_trace(__func__, "plan", plan);
     rocfft_cout << std::endl;
-    rocfft_cout << "precision: "
-                << ((plan->precision == rocfft_precision_single) ? "single" : "double")
-                << std::endl;
+    rocfft_cout << "precision: " << plan->precision << std::endl;
 
     rocfft_cout << "transform type: ";
     switch(plan->transformType)
@@ -709,10 +761,6 @@ ROCFFT_EXPORT rocfft_status rocfft_repo_get_total_plan_count(size_t* count)
 
 void TreeNode::RecursiveBuildTree()
 {
-    // this flag can be enabled when generator can do block column fft in
-    // multi-dimension cases and small 2d, 3d within one kernel
-    bool MultiDimFuseKernelsAvailable = false;
-
     if((parent == nullptr)
        && ((inArrayType == rocfft_array_type_real) || (outArrayType == rocfft_array_type_real)))
     {
@@ -755,15 +803,16 @@ void TreeNode::RecursiveBuildTree()
 
     case 3:
     {
-        if(MultiDimFuseKernelsAvailable)
+        // First choice is 3D_SINGLE kernel, if the problem will fit into LDS.
+        // Next best is CS_3D_RC.  Otherwise RTRT or TRTRTR.
+        if(use_CS_3D_SINGLE())
         {
-            // conditions to choose which scheme
-            if((length[0] * length[1] * length[2]) <= 2048)
-                scheme = CS_KERNEL_3D_SINGLE;
-            else if(length[2] <= 256)
-                scheme = CS_3D_RC;
-            else
-                scheme = CS_3D_RTRT;
+            scheme = CS_KERNEL_3D_SINGLE; // the node has all build info
+            return;
+        }
+        else if(use_CS_3D_RC())
+        {
+            scheme = CS_3D_RC;
         }
         else
         {
@@ -825,14 +874,12 @@ void TreeNode::RecursiveBuildTree()
                 zPlan->length.push_back(length[index]);
             }
 
-            zPlan->scheme = CS_KERNEL_3D_STOCKHAM_BLOCK_CC;
+            // reuse the SBCC kernel along z, as CS_2D_RC does for columns
+            zPlan->large1D = 0; // No twiddle factor in sbcc kernel
+            zPlan->scheme  = CS_KERNEL_STOCKHAM_BLOCK_CC;
             childNodes.emplace_back(std::move(zPlan));
         }
         break;
-        case CS_KERNEL_3D_SINGLE:
-        {
-        }
-        break;
 
         default:
             assert(false);
@@ -841,39 +888,50 @@ void TreeNode::RecursiveBuildTree()
     break;
 
     default:
-        assert(false);
+    {
+        // Higher ranks are decomposed into a 3D transform and columns
+        // along each higher dimension.
+        scheme = CS_ND_RC;
+        build_CS_ND_RC();
+    }
     }
 }
 
-bool TreeNode::use_CS_2D_SINGLE()
+// Get actual LDS size, to check if we can run a 2D_SINGLE or
+// 3D_SINGLE kernel that will fit the problem into LDS.
+//
+// NOTE: This is potentially problematic in a heterogeneous
+// multi-device environment.  The device we query now could
+// differ from the device we run the plan on.  That said,
+// it's vastly more common to have multiples of the same
+// device in the real world.
+static int DeviceLDSSize(const char* caller)
 {
-    // Get actual LDS size, to check if we can run a 2D_SINGLE
-    // kernel that will fit the problem into LDS.
-    //
-    // NOTE: This is potentially problematic in a heterogeneous
-    // multi-device environment.  The device we query now could
-    // differ from the device we run the plan on.  That said,
-    // it's vastly more common to have multiples of the same
-    // device in the real world.
     int ldsSize;
     int deviceid;
     // if this fails, device 0 is a reasonable default
-    if(hipGetDevice(&deviceid) != hipSuccess)
+    if(device_runtime().get_device(&deviceid) != hipSuccess)
     {
-        log_trace(__func__, "warning", "hipGetDevice failed - using device 0");
+        log_trace(caller, "warning", "hipGetDevice failed - using device 0");
         deviceid = 0;
     }
-    // if this fails, giving 0 to Single2DSizes will assume
-    // normal size for contemporary hardware
-    if(hipDeviceGetAttribute(&ldsSize, hipDeviceAttributeMaxSharedMemoryPerMultiprocessor, deviceid)
+    // if this fails, giving 0 to Single2DSizes/Single3DSizes will
+    // assume normal size for contemporary hardware
+    if(device_runtime().device_attribute(
+           &ldsSize, hipDeviceAttributeMaxSharedMemoryPerMultiprocessor, deviceid)
        != hipSuccess)
     {
-        log_trace(__func__,
+        log_trace(caller,
                   "warning",
                   "hipDeviceGetAttribute failed - assuming normal LDS size for current hardware");
         ldsSize = 0;
     }
-    const auto single2DSizes = Single2DSizes(ldsSize, precision, GetWGSAndNT);
+    return ldsSize;
+}
+
+bool TreeNode::use_CS_2D_SINGLE()
+{
+    const auto single2DSizes = Single2DSizes(DeviceLDSSize(__func__), precision, GetWGSAndNT);
     if(std::find(single2DSizes.begin(), single2DSizes.end(), std::make_pair(length[0], length[1]))
        != single2DSizes.end())
         return true;
@@ -881,14 +939,25 @@ bool TreeNode::use_CS_2D_SINGLE()
     return false;
 }
 
+bool TreeNode::use_CS_3D_SINGLE()
+{
+    const auto single3DSizes = Single3DSizes(DeviceLDSSize(__func__), precision, GetWGSAndNT);
+    if(std::find(single3DSizes.begin(),
+                 single3DSizes.end(),
+                 std::make_tuple(length[0], length[1], length[2]))
+       != single3DSizes.end())
+        return true;
+
+    return false;
+}
+
 bool TreeNode::use_CS_2D_RC()
 {
-    //   For CS_2D_RC, we are reusing SBCC kernel for 1D middle size. The
-    //   current implementation of 1D SBCC supports only 64, 128, and 256.
-    //   However, technically no LDS limitation along the fast dimension
-    //   on upper bound for 2D SBCC cases, and even should not limit to pow
-    //   of 2.
-    if((length[1] == 256 || length[1] == 128 || length[1] == 64) && (length[0] >= 64))
+    //   For CS_2D_RC, we are reusing SBCC kernel for 1D middle size, so
+    //   length[1] must be one of the generated block sizes.  Technically
+    //   there is no LDS limitation along the fast dimension on upper bound
+    //   for 2D SBCC cases.
+    if(SupportedBlockLength(precision, length[1]) && (length[0] >= 64))
     {
         size_t bwd, wgs, lds;
         GetBlockComputeTable(length[1], bwd, wgs, lds);
@@ -901,9 +970,42 @@ bool TreeNode::use_CS_2D_RC()
     return false;
 }
 
+bool TreeNode::use_CS_3D_RC()
+{
+    return use_block_columns(2);
+}
+
+bool TreeNode::use_block_columns(size_t dim)
+{
+    //   Same constraints as CS_2D_RC: the columns along dimension 'dim'
+    //   are done by the SBCC kernel, which blocks along length[0].
+    if(SupportedBlockLength(precision, length[dim]) && (length[0] >= 64))
+    {
+        size_t bwd, wgs, lds;
+        GetBlockComputeTable(length[dim], bwd, wgs, lds);
+        if(length[0] % bwd == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void TreeNode::build_real()
 {
-    if(length[0] % 2 == 0 && inStride[0] == 1 && outStride[0] == 1)
+    // 1D transforms out-of-place can have any innermost strides.  A
+    // strided real buffer is read by the half-length complex transform
+    // as planar data, which only a single kernel can do.
+    const size_t realStride = (direction == -1) ? inStride[0] : outStride[0];
+    const bool   unitStride = inStride[0] == 1 && outStride[0] == 1;
+    const bool   stridedOK  = dimension == 1 && placement == rocfft_placement_notinplace
+                           && (realStride == 1
+                               || (SupportedLength(precision, length[0] / 2)
+                                   && length[0] / 2 <= Large1DThreshold(precision)));
+    // Ranks above 3 pair or embed their real transforms, and do the
+    // higher dimensions as complex transforms.
+    if(length[0] % 2 == 0 && dimension <= 3 && (unitStride || stridedOK))
     {
         switch(dimension)
         {
@@ -922,15 +1024,20 @@ void TreeNode::build_real()
         }
     }
 
-    // TODO: use otherdims for non-batched paired transform.
+    // Otherwise, pairs of real transforms run as the real and imaginary
+    // parts of one complex transform, so that each complex transform does
+    // the work of two real ones without embedding them in full-length
+    // complex buffers.  The pairs are over an even higher dimension, or
+    // over an even batch.  In-place, the complex transform of a forward
+    // transform leaves its result in the work buffer, and that of an
+    // inverse transform reads it from there, so it must be a single
+    // kernel.
     // Recall that the lengths are column-major.
-    // const size_t otherdims
-    //     = std::accumulate(length.begin() + 1, length.end(), 1, std::multiplies<size_t>());
-
-    // NB: currently only works with single-kernel c2c sub-transform
-    // TODO: enable for 2D/3D transforms.
-    if(dimension == 1 && direction == -1 && SupportedLength(precision, length[0])
-       && length[0] < Large1DThreshold(precision) && (batch % 2 == 0)) // || (otherdims % 2 == 0))
+    const size_t otherdims
+        = std::accumulate(length.begin() + 1, length.end(), 1, std::multiplies<size_t>());
+    const bool singleKernel = length[0] <= Large1DThreshold(precision);
+    if(SupportedLength(precision, length[0]) && (batch % 2 == 0 || otherdims % 2 == 0)
+       && (placement == rocfft_placement_notinplace || singleKernel))
     {
         // Paired algorithm
         build_real_pair();
@@ -1035,6 +1142,40 @@ void TreeNode::build_real_even_1D()
     }
 }
 
+rocfft_array_type TreeNode::RealAsComplexType() const
+{
+    // Only a root 1D transform has its user's strides when buffers are
+    // assigned; the strides of the nodes below multi-dimensional
+    // transforms are filled in later, and are unit for the real data.
+    if(parent == nullptr && scheme == CS_REAL_TRANSFORM_EVEN && dimension == 1)
+    {
+        const size_t realStride = (direction == -1) ? inStride[0] : outStride[0];
+        if(realStride != 1)
+            return rocfft_array_type_complex_planar;
+    }
+    return rocfft_array_type_complex_interleaved;
+}
+
+size_t TreeNode::RealViewOffset() const
+{
+    for(const TreeNode* node = this; node->parent != nullptr; node = node->parent)
+    {
+        const TreeNode* up = node->parent;
+        if(up->scheme == CS_REAL_TRANSFORM_EVEN
+           && up->RealAsComplexType() == rocfft_array_type_complex_planar)
+        {
+            return (up->direction == -1) ? up->inStride[0] : up->outStride[0];
+        }
+        const auto& cplan = (up->direction == -1) ? up->childNodes.front() : up->childNodes.back();
+        if(up->scheme == CS_REAL_TRANSFORM_PAIR && node == cplan.get())
+        {
+            // the c2c plan of a paired transform
+            return (node->pairdim == 0) ? node->iDist / 2 : node->inStride[node->pairdim] / 2;
+        }
+    }
+    return 0;
+}
+
 void TreeNode::build_real_even_2D()
 {
     // Fastest moving dimension must be even:
@@ -1314,7 +1455,8 @@ void TreeNode::build_real_pair()
 
     const size_t dim = length.size();
 
-    // Lengths and batch size for the paired c2c in-place transform
+    // Lengths and batch size for the paired c2c in-place transform.  A pairdim of 0 means
+    // pairing over the batch.
     auto   pairlength  = length;
     size_t c2c_pairdim = 0;
     if(evendims)
@@ -1335,6 +1477,26 @@ void TreeNode::build_real_pair()
 
     const size_t pairbatch = evendims ? batch : batch / 2;
 
+    // Complex transforms along each higher dimension of the Hermitian
+    // data, in-place, with the other dimensions as rows.  They follow the
+    // unpack plan, or precede the pack plan.
+    auto add_higher_dims = [this]() {
+        for(size_t d = 1; d < length.size(); ++d)
+        {
+            auto hplan       = TreeNode::CreateNode(this);
+            hplan->length    = {length[d], length[0] / 2 + 1};
+            hplan->dimension = 1;
+            hplan->placement = rocfft_placement_inplace;
+            for(size_t other = 1; other < length.size(); ++other)
+            {
+                if(other != d)
+                    hplan->length.push_back(length[other]);
+            }
+            hplan->RecursiveBuildTree();
+            childNodes.emplace_back(std::move(hplan));
+        }
+    };
+
     if(direction == -1)
     {
         // Direct
@@ -1365,14 +1527,42 @@ void TreeNode::build_real_pair()
             childNodes.emplace_back(std::move(unpack));
         }
 
-        // TODO: if dimension > 1, then we need to launch a sub-dimensional c2c transform
+        add_higher_dims();
     }
     else
     {
         // Inverse
 
-        // TODO: implement
-        assert(false);
+        add_higher_dims();
+
+        // Pack the two Hermitian-symmetric arrays into the full-length
+        // spectrum of x + iy, stored as planar reals in the layout of
+        // the real output
+        {
+            auto pack          = TreeNode::CreateNode(this);
+            pack->scheme       = CS_KERNEL_PAIR_PACK;
+            pack->dimension    = 1;
+            pack->length       = pairlength;
+            pack->batch        = pairbatch;
+            pack->pairdim      = c2c_pairdim;
+            pack->inArrayType  = inArrayType;
+            pack->outArrayType = rocfft_array_type_complex_planar;
+            childNodes.emplace_back(std::move(pack));
+        }
+
+        // Second stage: a c2c FFT leaves the two real outputs in the
+        // real and imaginary parts
+        {
+            auto cplan          = TreeNode::CreateNode(this);
+            cplan->length       = pairlength;
+            cplan->batch        = pairbatch;
+            cplan->pairdim      = c2c_pairdim;
+            cplan->dimension    = 1;
+            cplan->inArrayType  = rocfft_array_type_complex_planar;
+            cplan->outArrayType = rocfft_array_type_complex_planar;
+            cplan->RecursiveBuildTree();
+            childNodes.emplace_back(std::move(cplan));
+        }
     }
 }
 
@@ -1421,6 +1611,74 @@ size_t TreeNode::div1DNoPo2(const size_t length0)
     return length0 / supported[idx];
 }
 
+ComputeScheme TreeNode::div1DBlock(const size_t length0, size_t& divLength1)
+{
+    // SBCC runs divLength1-point columns, so divLength0 has to be a
+    // multiple of its block width.  CS_L1D_CC also runs divLength0-point
+    // SBRC rows, while CS_L1D_CRT runs them with a single kernel and
+    // transposes afterwards.  Prefer CS_L1D_CC, then the most square
+    // split.
+    ComputeScheme best     = CS_NONE;
+    size_t        bestDiff = 0;
+    for(size_t d1 = 2; d1 <= 512 && d1 < length0; d1++)
+    {
+        if(length0 % d1 != 0 || !SupportedBlockLength(precision, d1))
+            continue;
+
+        size_t d0 = length0 / d1;
+        size_t bwd, wgs, lds;
+        GetBlockComputeTable(d1, bwd, wgs, lds);
+        if(d0 % bwd != 0)
+            continue;
+
+        ComputeScheme candidate = CS_NONE;
+        if(SupportedBlockLength(precision, d0))
+        {
+            GetBlockComputeTable(d0, bwd, wgs, lds);
+            if(d1 % bwd == 0)
+                candidate = CS_L1D_CC;
+        }
+        if(candidate == CS_NONE && d0 <= Large1DThreshold(precision)
+           && SupportedLength(precision, d0))
+            candidate = CS_L1D_CRT;
+        if(candidate == CS_NONE)
+            continue;
+
+        size_t diff = d0 > d1 ? d0 - d1 : d1 - d0;
+        if(best == CS_NONE || (candidate == CS_L1D_CC && best == CS_L1D_CRT)
+           || (candidate == best && diff < bestDiff))
+        {
+            best       = candidate;
+            bestDiff   = diff;
+            divLength1 = d1;
+        }
+    }
+    return best;
+}
+
+ComputeScheme TreeNode::div1DLarge(const size_t length0, size_t& divLength1)
+{
+    // Each level runs SBCC columns with the large twiddles fused in, and
+    // leaves rows of length0 / d1 to a large 1D plan of their own, so
+    // the largest column length gives the fewest levels.  Only one
+    // transpose per level remains, instead of the three of CS_L1D_TRTRT.
+    for(size_t d1 = 512; d1 >= 2; d1--)
+    {
+        if(length0 % d1 != 0 || !SupportedBlockLength(precision, d1))
+            continue;
+
+        size_t d0 = length0 / d1;
+        size_t bwd, wgs, lds;
+        GetBlockComputeTable(d1, bwd, wgs, lds);
+        if(d0 <= Large1DThreshold(precision) || d0 % bwd != 0)
+            continue;
+
+        divLength1 = d1;
+        return CS_L1D_CRT;
+    }
+    return CS_NONE;
+}
+
 void TreeNode::build_1D()
 {
     // Build a node for a 1D FFT
@@ -1439,78 +1697,66 @@ void TreeNode::build_1D()
 
     size_t divLength1 = 1;
 
-    if(IsPo2(length[0])) // multiple kernels involving transpose
+    if(IsPo2(length[0]) && length[0] <= 262144 / PrecisionWidth(precision))
     {
         // TODO: wrap the below into a function and check with LDS size
-        if(length[0] <= 262144 / PrecisionWidth(precision))
+        // Enable block compute under these conditions
+        if(1 == PrecisionWidth(precision))
         {
-            // Enable block compute under these conditions
-            if(1 == PrecisionWidth(precision))
+            if(map1DLengthSingle.find(length[0]) != map1DLengthSingle.end())
             {
-                if(map1DLengthSingle.find(length[0]) != map1DLengthSingle.end())
-                {
-                    divLength1 = map1DLengthSingle.at(length[0]);
-                }
-                else
-                {
-                    assert(0); // should not happen
-                }
+                divLength1 = map1DLengthSingle.at(length[0]);
             }
             else
             {
-                if(map1DLengthDouble.find(length[0]) != map1DLengthDouble.end())
-                {
-                    divLength1 = map1DLengthDouble.at(length[0]);
-                }
-                else
-                {
-                    assert(0); // should not happen
-                }
+                assert(0); // should not happen
             }
-            scheme = (length[0] <= 65536 / PrecisionWidth(precision)) ? CS_L1D_CC : CS_L1D_CRT;
         }
         else
         {
-            if(length[0] > (Large1DThreshold(precision) * Large1DThreshold(precision)))
+            if(map1DLengthDouble.find(length[0]) != map1DLengthDouble.end())
             {
-                divLength1 = length[0] / Large1DThreshold(precision);
+                divLength1 = map1DLengthDouble.at(length[0]);
             }
             else
             {
-                size_t in_x = 0;
-                size_t len  = length[0];
-                while(len != 1)
-                {
-                    len >>= 1;
-                    in_x++;
-                }
-                in_x /= 2;
-                divLength1 = (size_t)1 << in_x;
+                assert(0); // should not happen
             }
-            scheme = CS_L1D_TRTRT;
         }
+        scheme = (length[0] <= 65536 / PrecisionWidth(precision)) ? CS_L1D_CC : CS_L1D_CRT;
     }
-    else // if not Pow2
+    else
     {
-        divLength1 = div1DNoPo2(length[0]);
-        scheme     = CS_L1D_TRTRT;
+        // Block column kernels first, in one level if the rows fit in a
+        // single kernel, else in as many levels as the length needs
+        scheme = div1DBlock(length[0], divLength1);
+        if(scheme == CS_NONE)
+            scheme = div1DLarge(length[0], divLength1);
+    }
 
-        if(precision == rocfft_precision_single)
+    if(scheme == CS_NONE) // multiple kernels involving transpose
+    {
+        if(!IsPo2(length[0]))
         {
-            if(map1DLengthSingle.find(length[0]) != map1DLengthSingle.end())
-            {
-                divLength1 = map1DLengthSingle.at(length[0]);
-                scheme     = CS_L1D_CC;
-            }
+            divLength1 = div1DNoPo2(length[0]);
         }
-        else if(precision == rocfft_precision_double)
+        else if(length[0] > (Large1DThreshold(precision) * Large1DThreshold(precision)))
         {
-            if(map1DLengthDouble.find(length[0]) != map1DLengthDouble.end())
+            divLength1 = length[0] / Large1DThreshold(precision);
+        }
+        else
+        {
+            size_t in_x = 0;
+            size_t len  = length[0];
+            while(len != 1)
             {
-                divLength1 = map1DLengthDouble.at(length[0]);
-                scheme     = CS_L1D_CC;
+                len >>= 1;
+                in_x++;
             }
+            in_x /= 2;
+            divLength1 = (size_t)1 << in_x;
         }
+        scheme = CS_L1D_TRTRT;
     }
 
     size_t divLength0 = length[0] / divLength1;
@@ -1669,7 +1915,8 @@ void TreeNode::build_1DCS_L1D_TRTRT(const size_t divLength0, const size_t divLen
     trans2Plan->scheme    = CS_KERNEL_TRANSPOSE;
     trans2Plan->dimension = 2;
 
-    trans2Plan->large1D = length[0];
+    trans2Plan->large1D        = length[0];
+    trans2Plan->largeTwdSincos = LargeTwiddleSincos(precision, length[0]);
 
     for(size_t index = 1; index < length.size(); index++)
     {
@@ -1725,7 +1972,8 @@ void TreeNode::build_1DCS_L1D_CC(const size_t divLength0, const size_t divLength
     auto col2colPlan = TreeNode::CreateNode(this);
 
     // large1D flag to confirm we need multiply twiddle factor
-    col2colPlan->large1D = length[0];
+    col2colPlan->large1D        = length[0];
+    col2colPlan->largeTwdSincos = LargeTwiddleSincos(precision, length[0]);
 
     col2colPlan->length.push_back(divLength1);
     col2colPlan->length.push_back(divLength0);
@@ -1763,7 +2011,8 @@ void TreeNode::build_1DCS_L1D_CRT(const size_t divLength0, const size_t divLengt
     auto col2colPlan = TreeNode::CreateNode(this);
 
     // large1D flag to confirm we need multiply twiddle factor
-    col2colPlan->large1D = length[0];
+    col2colPlan->large1D        = length[0];
+    col2colPlan->largeTwdSincos = LargeTwiddleSincos(precision, length[0]);
 
     col2colPlan->length.push_back(divLength1);
     col2colPlan->length.push_back(divLength0);
@@ -1792,6 +2041,9 @@ void TreeNode::build_1DCS_L1D_CRT(const size_t divLength0, const size_t divLengt
         row2rowPlan->length.push_back(length[index]);
     }
 
+    // rows longer than a single kernel are a large 1D plan in place,
+    // see div1DLarge
+    row2rowPlan->RecursiveBuildTree();
     childNodes.emplace_back(std::move(row2rowPlan));
 
     // third plan, transpose
@@ -1943,6 +2195,75 @@ void TreeNode::build_CS_3D_RTRT()
     childNodes.emplace_back(std::move(trans2Plan));
 }
 
+void TreeNode::build_CS_ND_RC()
+{
+    assert(length.size() == dimension);
+
+    // A 3D plan does the lowest 3 dimensions, with the higher ones as
+    // its batch when each of them spans the whole of the one below, as
+    // in packed data.  Otherwise the rows and the columns along the
+    // lowest dimensions are done like those along the higher ones.
+    // Nodes below the root work on packed buffers.
+    auto spans = [this](const std::vector<size_t>& stride, size_t dist) {
+        for(size_t index = 3; index < dimension; index++)
+        {
+            const size_t next = (index + 1 < dimension) ? stride[index + 1] : dist;
+            if(next != length[index] * stride[index])
+                return false;
+        }
+        return true;
+    };
+    const bool batched
+        = parent != nullptr || (spans(inStride, iDist) && spans(outStride, oDist));
+
+    size_t firstCol = 3;
+    if(batched)
+    {
+        auto lowPlan       = TreeNode::CreateNode(this);
+        lowPlan->length    = {length[0], length[1], length[2]};
+        lowPlan->dimension = 3;
+        lowPlan->batch     = std::accumulate(
+            length.begin() + 3, length.end(), batch, std::multiplies<size_t>());
+        lowPlan->RecursiveBuildTree();
+        childNodes.emplace_back(std::move(lowPlan));
+    }
+    else
+    {
+        auto rowPlan       = TreeNode::CreateNode(this);
+        rowPlan->length    = length;
+        rowPlan->dimension = 1;
+        rowPlan->RecursiveBuildTree();
+        childNodes.emplace_back(std::move(rowPlan));
+        firstCol = 1;
+    }
+
+    // columns along each higher dimension, in-place, with the SBCC
+    // kernel where CS_3D_RC would use it
+    for(size_t dim = firstCol; dim < dimension; dim++)
+    {
+        auto colPlan = TreeNode::CreateNode(this);
+
+        colPlan->length.push_back(length[dim]);
+        colPlan->dimension = 1;
+        for(size_t index = 0; index < length.size(); index++)
+        {
+            if(index != dim)
+                colPlan->length.push_back(length[index]);
+        }
+
+        if(use_block_columns(dim))
+        {
+            colPlan->large1D = 0; // No twiddle factor in sbcc kernel
+            colPlan->scheme  = CS_KERNEL_STOCKHAM_BLOCK_CC;
+        }
+        else
+        {
+            colPlan->RecursiveBuildTree();
+        }
+        childNodes.emplace_back(std::move(colPlan));
+    }
+}
+
 void TreeNode::build_CS_3D_TRTRTR()
 {
     scheme                         = CS_3D_TRTRTR;
@@ -2125,12 +2446,15 @@ void TreeNode::TraverseTreeAssignBuffersLogicA(TraverseState&   state,
         assign_buffers_CS_RTRT(state, flipIn, flipOut, obOutBuf);
         break;
     case CS_2D_RC:
-    case CS_3D_RC:
         assign_buffers_CS_RC(state, flipIn, flipOut, obOutBuf);
         break;
     case CS_3D_TRTRTR:
         assign_buffers_CS_3D_TRTRTR(state, flipIn, flipOut, obOutBuf);
         break;
+    case CS_3D_RC:
+    case CS_ND_RC:
+        assign_buffers_CS_ND_RC(state, flipIn, flipOut, obOutBuf);
+        break;
     default:
         if(parent == nullptr)
         {
@@ -2231,8 +2555,8 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
         // complex FFT kernel
         childNodes[0]->SetInputBuffer(state);
         childNodes[0]->obOut        = obIn;
-        childNodes[0]->inArrayType  = rocfft_array_type_complex_interleaved;
-        childNodes[0]->outArrayType = rocfft_array_type_complex_interleaved;
+        childNodes[0]->inArrayType  = RealAsComplexType();
+        childNodes[0]->outArrayType = RealAsComplexType();
         flipIn                      = obIn;
         obOutBuf                    = obIn;
         childNodes[0]->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
@@ -2240,7 +2564,7 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
         // real-to-complex post kernel
         childNodes[1]->SetInputBuffer(state);
         childNodes[1]->obOut        = obOut;
-        childNodes[1]->inArrayType  = rocfft_array_type_complex_interleaved;
+        childNodes[1]->inArrayType  = RealAsComplexType();
         childNodes[1]->outArrayType = outArrayType;
     }
     else
@@ -2252,7 +2576,7 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
         childNodes[0]->obOut = obOut;
 
         childNodes[0]->inArrayType  = inArrayType;
-        childNodes[0]->outArrayType = rocfft_array_type_complex_interleaved;
+        childNodes[0]->outArrayType = RealAsComplexType();
 
         // NB: The case here indicates parent's input buffer is not
         //     complex_planar or hermitian_planar, so the child must
@@ -2267,8 +2591,8 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_EVEN(TraverseState&   state,
         childNodes[1]->obOut = obOut;
         flipIn               = placement == rocfft_placement_inplace ? OB_USER_IN : OB_USER_OUT;
         flipOut              = OB_TEMP;
-        childNodes[1]->inArrayType  = rocfft_array_type_complex_interleaved;
-        childNodes[1]->outArrayType = rocfft_array_type_complex_interleaved;
+        childNodes[1]->inArrayType  = RealAsComplexType();
+        childNodes[1]->outArrayType = RealAsComplexType();
         childNodes[1]->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
     }
 }
@@ -2480,6 +2804,28 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_PAIR(TraverseState&   state,
                                                      OperatingBuffer& flipOut,
                                                      OperatingBuffer& obOutBuf)
 {
+    // The transforms along the higher dimensions work in-place on the
+    // Hermitian data, which is complex data of the same format.
+    const auto hermType    = (direction == -1) ? outArrayType : inArrayType;
+    const auto hermAsCmplx = (hermType == rocfft_array_type_hermitian_planar)
+                                 ? rocfft_array_type_complex_planar
+                                 : rocfft_array_type_complex_interleaved;
+    auto       assign_higher_dims
+        = [&](size_t first, size_t last, OperatingBuffer hermBuf) {
+              for(size_t i = first; i < last; ++i)
+              {
+                  auto& hplan = childNodes[i];
+                  hplan->SetInputBuffer(state);
+                  hplan->obOut        = hermBuf;
+                  hplan->inArrayType  = hermAsCmplx;
+                  hplan->outArrayType = hermAsCmplx;
+                  flipIn              = hermBuf;
+                  flipOut             = OB_TEMP;
+                  obOutBuf            = hermBuf;
+                  hplan->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOutBuf);
+              }
+          };
+
     if(direction == -1)
     {
         auto& cplan = childNodes[0];
@@ -2496,13 +2842,26 @@ void TreeNode::assign_buffers_CS_REAL_TRANSFORM_PAIR(TraverseState&   state,
         unpack->SetInputBuffer(state);
         unpack->obOut = obOut;
 
-        assert(dimension == 1);
-        // TODO: implment multi-dimensional transforms
+        assign_higher_dims(2, childNodes.size(), obOut);
     }
     else
     {
-        assert(false);
-        // TODO: implement
+        // The transforms along the higher dimensions overwrite the input
+        assign_higher_dims(0, childNodes.size() - 2, obIn);
+
+        auto& pack = childNodes[childNodes.size() - 2];
+        assert(pack->scheme == CS_KERNEL_PAIR_PACK);
+        // The pack plan cannot be in-place, since the Hermitian input
+        // is laid out differently from the real output
+        pack->SetInputBuffer(state);
+        pack->obOut = (placement == rocfft_placement_inplace) ? OB_TEMP : obOut;
+
+        auto& cplan = childNodes.back();
+        cplan->SetInputBuffer(state);
+        cplan->obOut = obOut;
+        flipIn       = pack->obOut;
+        flipOut      = OB_TEMP;
+        cplan->TraverseTreeAssignBuffersLogicA(state, flipIn, flipOut, obOut);
     }
 }
 
@@ -2734,6 +3093,16 @@ void TreeNode::assign_buffers_CS_L1D_CRT(TraverseState&   state,
         childNodes[2]->SetInputBuffer(state);
         childNodes[2]->obOut = flipIn;
     }
+
+    // Rows that are a large 1D plan run in place in the buffer the
+    // columns wrote, and flip through the one the transpose writes
+    if(childNodes[1]->childNodes.size())
+    {
+        OperatingBuffer rowFlipIn  = childNodes[1]->obOut;
+        OperatingBuffer rowFlipOut = childNodes[2]->obOut;
+        childNodes[1]->TraverseTreeAssignBuffersLogicA(state, rowFlipIn, rowFlipOut, obOutBuf);
+        childNodes[2]->SetInputBuffer(state);
+    }
 }
 
 void TreeNode::assign_buffers_CS_RTRT(TraverseState&   state,
@@ -2822,6 +3191,29 @@ void TreeNode::assign_buffers_CS_3D_TRTRTR(TraverseState&   state,
     obOut = childNodes[childNodes.size() - 1]->obOut;
 }
 
+void TreeNode::assign_buffers_CS_ND_RC(TraverseState&   state,
+                                       OperatingBuffer& flipIn,
+                                       OperatingBuffer& flipOut,
+                                       OperatingBuffer& obOutBuf)
+{
+    assert(scheme == CS_3D_RC || scheme == CS_ND_RC);
+
+    obOut = obOutBuf;
+
+    // The 2D, 3D or row FFTs write the output, and the columns transform
+    // it in-place.  Multi-kernel children flip through the temp buffer.
+    for(auto& child : childNodes)
+    {
+        auto childFlipIn  = (child == childNodes.front()) ? flipIn : obOutBuf;
+        auto childFlipOut = (child == childNodes.front()) ? flipOut : OB_TEMP;
+
+        child->SetInputBuffer(state);
+        child->obOut = obOutBuf;
+        if(!child->childNodes.empty())
+            child->TraverseTreeAssignBuffersLogicA(state, childFlipIn, childFlipOut, obOutBuf);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Set placement variable and in/out array types, if not already set.
 void TreeNode::TraverseTreeAssignPlacementsLogicA(const rocfft_array_type rootIn,
@@ -2918,6 +3310,17 @@ void TreeNode::TraverseTreeAssignPlacementsLogicA(const rocfft_array_type rootIn
 
 // Set strides and distances
 
+// Elements of padding for a leading dimension of 'ld' elements in a
+// transposed intermediate in OB_TEMP.  Packed rows that are a large
+// multiple of 64 elements put the columns a transpose or column pass
+// walks on the same memory channels; 64 more elements per row stagger
+// them.  Shorter rows are left packed, where padding would cost more
+// memory than it saves.  The padded distances size the temp buffer.
+static size_t TempPadding(size_t ld)
+{
+    return (ld % 64 == 0) && (ld >= 512) ? 64 : 0;
+}
+
 void TreeNode::TraverseTreeAssignParamsLogicA()
 {
 #if 0
@@ -2995,6 +3398,9 @@ void TreeNode::TraverseTreeAssignParamsLogicA()
     case CS_3D_STRAIGHT:
         assign_params_CS_3D_RC_STRAIGHT();
         break;
+    case CS_ND_RC:
+        assign_params_CS_ND_RC();
+        break;
     default:
         return;
     }
@@ -3036,25 +3442,36 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
 {
     assert(childNodes.size() == 2);
 
+    // The half-length complex data lives in the real buffer.  Its
+    // strides and distance are normally in complexes, so those of the
+    // real side are halved, apart from the unit innermost stride.  A
+    // planar view of a strided real buffer instead takes every other
+    // real, with strides and distance still in reals.
+    const bool planarView = RealAsComplexType() == rocfft_array_type_complex_planar;
+    auto       halfStride = (direction == -1) ? inStride : outStride;
+    size_t     halfDist   = (direction == -1) ? iDist : oDist;
+    if(planarView)
+    {
+        halfStride[0] *= 2;
+    }
+    else
+    {
+        for(int i = 1; i < halfStride.size(); ++i)
+        {
+            halfStride[i] /= 2;
+        }
+        halfDist /= 2;
+    }
+
     if(direction == -1)
     {
         // forward transform, r2c
 
-        // iDist is in reals, subplan->iDist is in complexes
-
-        auto& fftPlan     = childNodes[0];
-        fftPlan->inStride = inStride;
-        for(int i = 1; i < fftPlan->inStride.size(); ++i)
-        {
-            fftPlan->inStride[i] /= 2;
-        }
-        fftPlan->iDist     = iDist / 2;
-        fftPlan->outStride = inStride;
-        for(int i = 1; i < fftPlan->outStride.size(); ++i)
-        {
-            fftPlan->outStride[i] /= 2;
-        }
-        fftPlan->oDist = iDist / 2;
+        auto& fftPlan      = childNodes[0];
+        fftPlan->inStride  = halfStride;
+        fftPlan->iDist     = halfDist;
+        fftPlan->outStride = halfStride;
+        fftPlan->oDist     = halfDist;
         fftPlan->TraverseTreeAssignParamsLogicA();
         assert(fftPlan->length.size() == fftPlan->inStride.size());
         assert(fftPlan->length.size() == fftPlan->outStride.size());
@@ -3062,12 +3479,8 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
         auto& postPlan = childNodes[1];
         assert(postPlan->scheme == CS_KERNEL_R_TO_CMPLX
                || postPlan->scheme == CS_KERNEL_R_TO_CMPLX_TRANSPOSE);
-        postPlan->inStride = inStride;
-        for(int i = 1; i < postPlan->inStride.size(); ++i)
-        {
-            postPlan->inStride[i] /= 2;
-        }
-        postPlan->iDist     = iDist / 2;
+        postPlan->inStride  = halfStride;
+        postPlan->iDist     = halfDist;
         postPlan->outStride = outStride;
         postPlan->oDist     = oDist;
 
@@ -3078,38 +3491,21 @@ void TreeNode::assign_params_CS_REAL_TRANSFORM_EVEN()
     {
         // backward transform, c2r
 
-        // oDist is in reals, subplan->oDist is in complexes
-
         auto& prePlan = childNodes[0];
         assert(prePlan->scheme == CS_KERNEL_CMPLX_TO_R);
 
-        prePlan->iDist = iDist;
-        prePlan->oDist = oDist / 2;
-
         // Strides are actually distances for multimensional transforms.
         // Only the first value is used, but we require dimension values.
         prePlan->inStride  = inStride;
-        prePlan->outStride = outStride;
-        // Strides are in complex types
-        for(int i = 1; i < prePlan->outStride.size(); ++i)
-        {
-            prePlan->outStride[i] /= 2;
-        }
-
-        auto& fftPlan = childNodes[1];
-        // Transform the strides from real to complex.
-
-        fftPlan->inStride  = outStride;
-        fftPlan->iDist     = oDist / 2;
-        fftPlan->outStride = outStride;
-        fftPlan->oDist     = fftPlan->iDist;
-        // The strides must be translated from real to complex.
-        for(int i = 1; i < fftPlan->inStride.size(); ++i)
-        {
-            fftPlan->inStride[i] /= 2;
-            fftPlan->outStride[i] /= 2;
-        }
-
+        prePlan->iDist     = iDist;
+        prePlan->outStride = halfStride;
+        prePlan->oDist     = halfDist;
+
+        auto& fftPlan      = childNodes[1];
+        fftPlan->inStride  = halfStride;
+        fftPlan->iDist     = halfDist;
+        fftPlan->outStride = halfStride;
+        fftPlan->oDist     = halfDist;
         fftPlan->TraverseTreeAssignParamsLogicA();
         assert(fftPlan->length.size() == fftPlan->inStride.size());
         assert(fftPlan->length.size() == fftPlan->outStride.size());
@@ -3248,7 +3644,9 @@ void TreeNode::assign_params_CS_L1D_CRT()
     if(parent != NULL)
         assert(obIn == obOut);
 
-    if((obOut == OB_USER_OUT) || (obOut == OB_TEMP_CMPLX_FOR_REAL))
+    // The rows of a CS_L1D_CRT are given their strides by it
+    if((obOut == OB_USER_OUT) || (obOut == OB_TEMP_CMPLX_FOR_REAL)
+       || (parent->scheme == CS_L1D_CRT))
     {
         // B -> T
         col2colPlan->inStride.push_back(inStride[0] * col2colPlan->length[1]);
@@ -3373,6 +3771,8 @@ void TreeNode::assign_params_CS_L1D_CRT()
         for(size_t index = 1; index < length.size(); index++)
             transPlan->outStride.push_back(outStride[index]);
     }
+
+    row2rowPlan->TraverseTreeAssignParamsLogicA();
 }
 
 void TreeNode::assign_params_CS_BLUESTEIN()
@@ -3435,11 +3835,6 @@ void TreeNode::assign_params_CS_BLUESTEIN()
 
 void TreeNode::assign_params_CS_L1D_TRTRT()
 {
-    const size_t biggerDim  = std::max(childNodes[0]->length[0], childNodes[0]->length[1]);
-    const size_t smallerDim = std::min(childNodes[0]->length[0], childNodes[0]->length[1]);
-    const size_t padding
-        = ((smallerDim % 64 == 0) || (biggerDim % 64 == 0)) && (biggerDim >= 512) ? 64 : 0;
-
     auto& trans1Plan = childNodes[0];
     auto& row1Plan   = childNodes[1];
     auto& trans2Plan = childNodes[2];
@@ -3455,7 +3850,7 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     if(trans1Plan->obOut == OB_TEMP)
     {
         trans1Plan->outStride.push_back(1);
-        trans1Plan->outStride.push_back(trans1Plan->length[1] + padding);
+        trans1Plan->outStride.push_back(trans1Plan->length[1] + TempPadding(trans1Plan->length[1]));
         trans1Plan->oDist = trans1Plan->length[0] * trans1Plan->outStride[1];
 
         for(size_t index = 1; index < length.size(); index++)
@@ -3532,7 +3927,7 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     if(trans2Plan->obOut == OB_TEMP)
     {
         trans2Plan->outStride.push_back(1);
-        trans2Plan->outStride.push_back(trans2Plan->length[1] + padding);
+        trans2Plan->outStride.push_back(trans2Plan->length[1] + TempPadding(trans2Plan->length[1]));
         trans2Plan->oDist = trans2Plan->length[0] * trans2Plan->outStride[1];
 
         for(size_t index = 1; index < length.size(); index++)
@@ -3581,7 +3976,7 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
     else if(row2Plan->obOut == OB_TEMP)
     {
         row2Plan->outStride.push_back(1);
-        row2Plan->outStride.push_back(row2Plan->length[0] + padding);
+        row2Plan->outStride.push_back(row2Plan->length[0] + TempPadding(row2Plan->length[0]));
         row2Plan->oDist = row2Plan->length[1] * row2Plan->outStride[1];
 
         for(size_t index = 1; index < length.size(); index++)
@@ -3633,11 +4028,6 @@ void TreeNode::assign_params_CS_L1D_TRTRT()
 
 void TreeNode::assign_params_CS_2D_RTRT()
 {
-    const size_t biggerDim  = std::max(length[0], length[1]);
-    const size_t smallerDim = std::min(length[0], length[1]);
-    const size_t padding
-        = ((smallerDim % 64 == 0) || (biggerDim % 64 == 0)) && (biggerDim >= 512) ? 64 : 0;
-
     auto& row1Plan      = childNodes[0];
     row1Plan->inStride  = inStride;
     row1Plan->iDist     = iDist;
@@ -3649,7 +4039,7 @@ void TreeNode::assign_params_CS_2D_RTRT()
     trans1Plan->inStride = row1Plan->outStride;
     trans1Plan->iDist    = row1Plan->oDist;
     trans1Plan->outStride.push_back(1);
-    trans1Plan->outStride.push_back(trans1Plan->length[1] + padding);
+    trans1Plan->outStride.push_back(trans1Plan->length[1] + TempPadding(trans1Plan->length[1]));
     trans1Plan->oDist = trans1Plan->length[0] * trans1Plan->outStride[1];
     for(size_t index = 2; index < length.size(); index++)
     {
@@ -3673,11 +4063,6 @@ void TreeNode::assign_params_CS_2D_RTRT()
 
 void TreeNode::assign_params_CS_REAL_2D_EVEN()
 {
-    const size_t biggerDim  = std::max(length[0], length[1]);
-    const size_t smallerDim = std::min(length[0], length[1]);
-    const size_t padding
-        = (((smallerDim % 64 == 0) || (biggerDim % 64 == 0)) && (biggerDim >= 512)) ? 64 : 0;
-
     const bool forward = inArrayType == rocfft_array_type_real;
     if(forward)
     {
@@ -3700,7 +4085,8 @@ void TreeNode::assign_params_CS_REAL_2D_EVEN()
             trans1Plan->iDist    = row1Plan->oDist;
 
             trans1Plan->outStride.push_back(1);
-            trans1Plan->outStride.push_back(trans1Plan->length[1] + padding);
+            trans1Plan->outStride.push_back(trans1Plan->length[1]
+                                            + TempPadding(trans1Plan->length[1]));
             trans1Plan->oDist = trans1Plan->length[0] * trans1Plan->outStride[1];
         }
 
@@ -3734,7 +4120,8 @@ void TreeNode::assign_params_CS_REAL_2D_EVEN()
             trans1Plan->iDist    = iDist;
 
             trans1Plan->outStride.push_back(1);
-            trans1Plan->outStride.push_back(trans1Plan->length[1] + padding);
+            trans1Plan->outStride.push_back(trans1Plan->length[1]
+                                            + TempPadding(trans1Plan->length[1]));
             trans1Plan->oDist = trans1Plan->length[0] * trans1Plan->outStride[1];
         }
         auto& c2cPlan = childNodes[1];
@@ -3900,31 +4287,77 @@ void TreeNode::assign_params_CS_REAL_3D_EVEN()
 
 void TreeNode::assign_params_CS_REAL_TRANSFORM_PAIR()
 {
+    // The c2c, pack and unpack plans see every other transform of the
+    // batch, or every other index along the pairing dimension, so that
+    // distance or stride doubles.  The c2c plan is planar-to-planar on the
+    // real data, so its strides and distances are real-value sized.
+    const size_t pairdim    = childNodes[direction == -1 ? 0 : childNodes.size() - 1]->pairdim;
+    auto         pairStride = [pairdim](std::vector<size_t> stride) {
+        if(pairdim != 0)
+            stride[pairdim] *= 2;
+        return stride;
+    };
+    auto pairDist = [pairdim](size_t dist) { return pairdim == 0 ? 2 * dist : dist; };
+
+    // The transform along dimension d of the Hermitian data has the
+    // other dimensions as rows, in the order they were built.
+    auto assign_higher_dims
+        = [this](size_t first, const std::vector<size_t>& stride, size_t dist) {
+              for(size_t d = 1; d < length.size(); ++d)
+              {
+                  auto& hplan     = childNodes[first + d - 1];
+                  hplan->inStride = {stride[d], stride[0]};
+                  for(size_t other = 1; other < length.size(); ++other)
+                  {
+                      if(other != d)
+                          hplan->inStride.push_back(stride[other]);
+                  }
+                  hplan->iDist     = dist;
+                  hplan->outStride = hplan->inStride;
+                  hplan->oDist     = dist;
+                  hplan->TraverseTreeAssignParamsLogicA();
+              }
+          };
+
     if(direction == -1)
     {
-        // TODO: deal with non-batch and 2D/3D cases.
-
-        // A planar-to-planar c2c node, where we use the next batch (or dimension) as the imaginary
-        // part.  Thus, strides and distances are real-value sized.
         auto& cplan      = childNodes[0];
-        cplan->inStride  = inStride;
-        cplan->iDist     = 2 * iDist;
-        cplan->outStride = inStride;
-        cplan->oDist     = 2 * iDist;
+        cplan->inStride  = pairStride(inStride);
+        cplan->iDist     = pairDist(iDist);
+        cplan->outStride = cplan->inStride;
+        cplan->oDist     = cplan->iDist;
         cplan->TraverseTreeAssignParamsLogicA();
 
         // The unpack plan is real-to-complex.
         auto& unpack = childNodes[1];
         assert(unpack->scheme == CS_KERNEL_PAIR_UNPACK);
-        unpack->inStride  = inStride;
-        unpack->iDist     = 2 * iDist;
-        unpack->outStride = outStride;
-        unpack->oDist     = 2 * oDist;
+        unpack->inStride  = pairStride(inStride);
+        unpack->iDist     = pairDist(iDist);
+        unpack->outStride = pairStride(outStride);
+        unpack->oDist     = pairDist(oDist);
+
+        assign_higher_dims(2, outStride, oDist);
     }
     else
     {
-        // TODO: implement
-        assert(false);
+        assign_higher_dims(0, inStride, iDist);
+
+        // The pack plan is complex-to-real, and writes the spectrum in
+        // the layout of the real output, whether that is the user's
+        // buffer or the temp buffer.
+        auto& pack = childNodes[childNodes.size() - 2];
+        assert(pack->scheme == CS_KERNEL_PAIR_PACK);
+        pack->inStride  = pairStride(inStride);
+        pack->iDist     = pairDist(iDist);
+        pack->outStride = pairStride(outStride);
+        pack->oDist     = pairDist(oDist);
+
+        auto& cplan      = childNodes.back();
+        cplan->inStride  = pairStride(outStride);
+        cplan->iDist     = pairDist(oDist);
+        cplan->outStride = cplan->inStride;
+        cplan->oDist     = cplan->iDist;
+        cplan->TraverseTreeAssignParamsLogicA();
     }
 }
 
@@ -3962,11 +4395,6 @@ void TreeNode::assign_params_CS_3D_RTRT()
 {
     assert(childNodes.size() == 4);
 
-    const size_t biggerDim  = std::max(length[0] * length[1], length[2]);
-    const size_t smallerDim = std::min(length[0] * length[1], length[2]);
-    const size_t padding
-        = ((smallerDim % 64 == 0) || (biggerDim % 64 == 0)) && (biggerDim >= 512) ? 64 : 0;
-
     // B -> B
     auto& xyPlan = childNodes[0];
     assert((xyPlan->obOut == OB_USER_OUT) || (xyPlan->obOut == OB_TEMP_CMPLX_FOR_REAL)
@@ -3986,7 +4414,7 @@ void TreeNode::assign_params_CS_3D_RTRT()
     trans1Plan->iDist    = xyPlan->oDist;
 
     trans1Plan->outStride.push_back(1);
-    trans1Plan->outStride.push_back(trans1Plan->length[2] + padding);
+    trans1Plan->outStride.push_back(trans1Plan->length[2] + TempPadding(trans1Plan->length[2]));
     trans1Plan->outStride.push_back(trans1Plan->length[0] * trans1Plan->outStride[1]);
     trans1Plan->oDist = trans1Plan->length[1] * trans1Plan->outStride[2];
 
@@ -4037,9 +4465,12 @@ void TreeNode::assign_params_CS_3D_TRTRTR()
             trans_plan->iDist    = childNodes[i - 1]->oDist;
         }
 
+        // The transpose writes OB_TEMP, so its planes can be padded apart
+        const size_t padding = TempPadding(trans_plan->length[1] * trans_plan->length[2]);
         trans_plan->outStride.push_back(1);
         trans_plan->outStride.push_back(trans_plan->outStride[0] * trans_plan->length[1]);
-        trans_plan->outStride.push_back(trans_plan->outStride[1] * trans_plan->length[2]);
+        trans_plan->outStride.push_back(trans_plan->outStride[1] * trans_plan->length[2]
+                                        + padding);
         trans_plan->oDist = trans_plan->outStride[2] * trans_plan->length[0];
 
         auto& row_plan     = childNodes[i + 1];
@@ -4093,6 +4524,53 @@ void TreeNode::assign_params_CS_3D_RC_STRAIGHT()
     zPlan->oDist     = zPlan->iDist;
 }
 
+void TreeNode::assign_params_CS_ND_RC()
+{
+    // B -> B
+    auto& lowPlan = childNodes[0];
+    assert((lowPlan->obOut == OB_USER_OUT) || (lowPlan->obOut == OB_TEMP_CMPLX_FOR_REAL)
+           || (lowPlan->obOut == OB_TEMP_BLUESTEIN));
+    if(lowPlan->dimension == 3)
+    {
+        // the higher dimensions are the batch of the 3D plan
+        lowPlan->inStride.assign(inStride.begin(), inStride.begin() + 3);
+        lowPlan->iDist = inStride[3];
+
+        lowPlan->outStride.assign(outStride.begin(), outStride.begin() + 3);
+        lowPlan->oDist = outStride[3];
+    }
+    else
+    {
+        lowPlan->inStride = inStride;
+        lowPlan->iDist    = iDist;
+
+        lowPlan->outStride = outStride;
+        lowPlan->oDist     = oDist;
+    }
+
+    lowPlan->TraverseTreeAssignParamsLogicA();
+
+    // B -> B, columns along the highest dimensions, which are last
+    for(size_t i = 1; i < childNodes.size(); i++)
+    {
+        auto&        colPlan = childNodes[i];
+        const size_t dim     = dimension - (childNodes.size() - i);
+
+        colPlan->inStride.push_back(outStride[dim]);
+        for(size_t index = 0; index < length.size(); index++)
+        {
+            if(index != dim)
+                colPlan->inStride.push_back(outStride[index]);
+        }
+        colPlan->iDist = oDist;
+
+        colPlan->outStride = colPlan->inStride;
+        colPlan->oDist     = colPlan->iDist;
+
+        colPlan->TraverseTreeAssignParamsLogicA();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Collect leaf node and calculate work memory requirements
 
@@ -4181,7 +4659,9 @@ void TreeNode::Print(rocfft_ostream& os, const int indent) const
 
     os << "\n" << indentStr.c_str();
 
-    os << ((precision == rocfft_precision_single) ? "single-precision" : "double-precision");
+    os << ((precision == rocfft_precision_single)
+               ? "single-precision"
+               : (precision == rocfft_precision_double) ? "double-precision" : "half-precision");
 
     os << std::endl << indentStr.c_str();
     os << "array type: ";
@@ -4230,6 +4710,8 @@ void TreeNode::Print(rocfft_ostream& os, const int indent) const
     }
     os << "\n" << indentStr.c_str() << "TTD: " << transTileDir;
     os << "\n" << indentStr.c_str() << "large1D: " << large1D;
+    if(large1D)
+        os << "\n" << indentStr.c_str() << "largeTwdSincos: " << largeTwdSincos;
     os << "\n" << indentStr.c_str() << "lengthBlue: " << lengthBlue << "\n";
 
     os << indentStr << PrintOperatingBuffer(obIn) << " -> " << PrintOperatingBuffer(obOut) << "\n";
@@ -4285,74 +4767,191 @@ static rocfft_result_placement EffectivePlacement(OperatingBuffer         obIn,
     return obIn == obOut ? rocfft_placement_inplace : rocfft_placement_notinplace;
 }
 
-static void OptimizePlan(ExecPlan& execPlan)
+// Fusions of adjacent kernels in execSeq.  Each takes the nodes
+// execSeq[i] (the producer) and execSeq[i + 1] (the consumer), checks
+// that they can run as one kernel and, if so, sets up the node that
+// is kept to do the work of both and returns it.  Nothing is changed
+// if the pair cannot be fused, and nullptr is returned.
+
+// R_TO_CMPLX followed by a transpose that makes dimension 0 the last:
+// the post-processing writes its rows transposed
+static TreeNode* FuseRealPostTranspose(ExecPlan& execPlan, size_t i)
 {
-    auto& execSeq = execPlan.execSeq;
-    // combine R_TO_CMPLX and following transpose
-    auto r_to_cmplx = std::find_if(execSeq.begin(), execSeq.end(), [](TreeNode* n) {
-        return n->scheme == CS_KERNEL_R_TO_CMPLX;
-    });
-    if(r_to_cmplx != execSeq.end())
-    {
-        auto transpose = r_to_cmplx + 1;
-        if(transpose != execSeq.end()
-           && ((*transpose)->scheme == CS_KERNEL_TRANSPOSE
-               || (*transpose)->scheme == CS_KERNEL_TRANSPOSE_Z_XY))
-        {
-            (*r_to_cmplx)->obOut        = (*transpose)->obOut;
-            (*r_to_cmplx)->scheme       = CS_KERNEL_R_TO_CMPLX_TRANSPOSE;
-            (*r_to_cmplx)->outArrayType = (*transpose)->outArrayType;
-            (*r_to_cmplx)->placement    = EffectivePlacement(
-                (*r_to_cmplx)->obIn, (*r_to_cmplx)->obOut, execPlan.rootPlan->placement);
-            // transpose must be out-of-place
-            assert((*r_to_cmplx)->placement == rocfft_placement_notinplace);
-            (*r_to_cmplx)->outStride = (*transpose)->outStride;
-            (*r_to_cmplx)->oDist     = (*transpose)->oDist;
-            RemoveNode(execPlan, *transpose);
-        }
-    }
-    // combine CMPLX_TO_R with preceding transpose
-    auto cmplx_to_r = std::find_if(execSeq.rbegin(), execSeq.rend(), [](TreeNode* n) {
-        return n->scheme == CS_KERNEL_CMPLX_TO_R;
-    });
+    TreeNode* r_to_cmplx = execPlan.execSeq[i];
+    TreeNode* transpose  = execPlan.execSeq[i + 1];
+    if(transpose->large1D != 0 || r_to_cmplx->obOut != transpose->obIn)
+        return nullptr;
+    // transpose must be out-of-place
+    if(EffectivePlacement(r_to_cmplx->obIn, transpose->obOut, execPlan.rootPlan->placement)
+       == rocfft_placement_inplace)
+        return nullptr;
+
+    r_to_cmplx->obOut        = transpose->obOut;
+    r_to_cmplx->outArrayType = transpose->outArrayType;
+    r_to_cmplx->placement    = rocfft_placement_notinplace;
+    r_to_cmplx->outStride    = transpose->outStride;
+    r_to_cmplx->oDist        = transpose->oDist;
+    return r_to_cmplx;
+}
+
+// A transpose that makes the last dimension 0, followed by CMPLX_TO_R:
+// the pre-processing reads its rows transposed
+static TreeNode* FuseTransposeRealPre(ExecPlan& execPlan, size_t i)
+{
+    auto&     execSeq    = execPlan.execSeq;
+    TreeNode* transpose  = execSeq[i];
+    TreeNode* cmplx_to_r = execSeq[i + 1];
+    if(transpose->large1D != 0 || transpose->obOut != cmplx_to_r->obIn)
+        return nullptr;
+
     // should be a stockham or bluestein kernel following the CMPLX_TO_R, so
     // CMPLX_TO_R can't be the last node either
-    if(cmplx_to_r != execSeq.rend() && cmplx_to_r != execSeq.rbegin())
-    {
-        auto following = cmplx_to_r - 1;
-        if((*following)->scheme == CS_KERNEL_CHIRP)
-            following = following - 1; // skip CHIRP
-        auto transpose = cmplx_to_r + 1;
-        if(transpose != execSeq.rend()
-           && ((*transpose)->scheme == CS_KERNEL_TRANSPOSE
-               || (*transpose)->scheme == CS_KERNEL_TRANSPOSE_XY_Z)
-           && cmplx_to_r != execSeq.rbegin())
-        {
-            // connect the transpose operation to the following
-            // transform by default
-            (*cmplx_to_r)->obIn  = (*transpose)->obIn;
-            (*cmplx_to_r)->obOut = (*following)->obIn;
-
-            // but transpose needs to be out-of-place, so bring the
-            // temp buffer in if the operation would be effectively
-            // in-place.
-            if(EffectivePlacement(
-                   (*cmplx_to_r)->obIn, (*cmplx_to_r)->obOut, execPlan.rootPlan->placement)
-               == rocfft_placement_inplace)
+    size_t next = i + 2;
+    if(next < execSeq.size() && execSeq[next]->scheme == CS_KERNEL_CHIRP)
+        ++next; // skip CHIRP
+    if(next >= execSeq.size())
+        return nullptr;
+    TreeNode* following = execSeq[next];
+
+    // connect the transpose operation to the following
+    // transform by default
+    cmplx_to_r->obIn  = transpose->obIn;
+    cmplx_to_r->obOut = following->obIn;
+
+    // but transpose needs to be out-of-place, so bring the
+    // temp buffer in if the operation would be effectively
+    // in-place.
+    if(EffectivePlacement(cmplx_to_r->obIn, cmplx_to_r->obOut, execPlan.rootPlan->placement)
+       == rocfft_placement_inplace)
+    {
+        cmplx_to_r->obOut    = OB_TEMP;
+        following->obIn      = OB_TEMP;
+        following->placement = EffectivePlacement(
+            following->obIn, following->obOut, execPlan.rootPlan->placement);
+    }
+    cmplx_to_r->placement = rocfft_placement_notinplace;
+
+    cmplx_to_r->inArrayType = transpose->inArrayType;
+    cmplx_to_r->inStride    = transpose->inStride;
+    cmplx_to_r->length      = transpose->length;
+    cmplx_to_r->iDist       = transpose->iDist;
+    return cmplx_to_r;
+}
+
+// STOCKHAM followed by R_TO_CMPLX, or CMPLX_TO_R followed by STOCKHAM,
+// of one even-length real transform: the Stockham kernel does the
+// real processing in LDS
+static TreeNode* FuseRealStockham(ExecPlan& execPlan, size_t i)
+{
+    TreeNode* first  = execPlan.execSeq[i];
+    TreeNode* second = execPlan.execSeq[i + 1];
+
+    // both must be the whole of one even-length real transform
+    if(first->parent != second->parent || first->parent->scheme != CS_REAL_TRANSFORM_EVEN)
+        return nullptr;
+    if(first->length != second->length || first->large1D != 0 || second->large1D != 0)
+        return nullptr;
+
+    // the fused kernels read and write the Hermitian side planar or
+    // interleaved, but everything else interleaved, and not the planar
+    // view of a strided real buffer
+    const bool fwd = first->scheme == CS_KERNEL_STOCKHAM;
+    for(auto type : {fwd ? first->inArrayType : second->outArrayType,
+                     first->outArrayType,
+                     second->inArrayType})
+    {
+        if(type == rocfft_array_type_complex_planar || type == rocfft_array_type_hermitian_planar)
+            return nullptr;
+    }
+    if(first->RealViewOffset() != 0)
+        return nullptr;
+
+    if(!SupportedRealFusedLength(first->precision, first->length[0]))
+        return nullptr;
+    if(!RealFusedFitsLDS(first->length[0], DeviceLDSSize(__func__), first->precision, GetWGSAndNT))
+        return nullptr;
+
+    first->obOut        = second->obOut;
+    first->outArrayType = second->outArrayType;
+    first->outStride    = second->outStride;
+    first->oDist        = second->oDist;
+    first->oOffset      = second->oOffset;
+    first->placement = EffectivePlacement(first->obIn, first->obOut, execPlan.rootPlan->placement);
+    return first;
+}
+
+struct NodeFusionRule
+{
+    ComputeScheme producer;
+    ComputeScheme consumer;
+    ComputeScheme fused;
+    TreeNode* (*fuse)(ExecPlan& execPlan, size_t i);
+};
+
+// Legal fusions, in order of preference where a node could take part
+// in more than one
+static const NodeFusionRule nodeFusionRules[] = {
+    {CS_KERNEL_R_TO_CMPLX,
+     CS_KERNEL_TRANSPOSE,
+     CS_KERNEL_R_TO_CMPLX_TRANSPOSE,
+     FuseRealPostTranspose},
+    {CS_KERNEL_R_TO_CMPLX,
+     CS_KERNEL_TRANSPOSE_Z_XY,
+     CS_KERNEL_R_TO_CMPLX_TRANSPOSE,
+     FuseRealPostTranspose},
+    {CS_KERNEL_TRANSPOSE,
+     CS_KERNEL_CMPLX_TO_R,
+     CS_KERNEL_TRANSPOSE_CMPLX_TO_R,
+     FuseTransposeRealPre},
+    {CS_KERNEL_TRANSPOSE_XY_Z,
+     CS_KERNEL_CMPLX_TO_R,
+     CS_KERNEL_TRANSPOSE_CMPLX_TO_R,
+     FuseTransposeRealPre},
+    {CS_KERNEL_STOCKHAM, CS_KERNEL_R_TO_CMPLX, CS_KERNEL_STOCKHAM_R_TO_CMPLX, FuseRealStockham},
+    {CS_KERNEL_CMPLX_TO_R, CS_KERNEL_STOCKHAM, CS_KERNEL_CMPLX_TO_R_STOCKHAM, FuseRealStockham},
+};
+
+// Bytes a kernel writes for the next one to read, which a fusion
+// keeps out of global memory
+static size_t IntermediateBytes(const TreeNode& producer)
+{
+    size_t elems = std::accumulate(producer.length.begin() + 1,
+                                   producer.length.end(),
+                                   producer.batch,
+                                   std::multiplies<size_t>());
+    // the Hermitian rows of real post-processing have one more element
+    elems *= producer.length[0] + (producer.scheme == CS_KERNEL_R_TO_CMPLX ? 1 : 0);
+    return elems * 2 * RealTypeSize(producer.precision);
+}
+
+// Apply the fusion rules over execSeq until no more pairs fuse
+static void OptimizePlan(ExecPlan& execPlan)
+{
+    auto& execSeq = execPlan.execSeq;
+    bool  fused   = true;
+    while(fused)
+    {
+        fused = false;
+        for(const auto& rule : nodeFusionRules)
+        {
+            for(size_t i = 0; i + 1 < execSeq.size(); ++i)
             {
-                (*cmplx_to_r)->obOut    = OB_TEMP;
-                (*following)->obIn      = OB_TEMP;
-                (*following)->placement = EffectivePlacement(
-                    (*following)->obIn, (*following)->obOut, execPlan.rootPlan->placement);
+                TreeNode* producer = execSeq[i];
+                TreeNode* consumer = execSeq[i + 1];
+                if(producer->scheme != rule.producer || consumer->scheme != rule.consumer)
+                    continue;
+
+                const size_t bytes = IntermediateBytes(*producer);
+                TreeNode*    kept  = rule.fuse(execPlan, i);
+                if(kept == nullptr)
+                    continue;
+
+                kept->scheme = rule.fused;
+                RemoveNode(execPlan, kept == producer ? consumer : producer);
+                // written once and read once
+                execPlan.fusions.push_back({rule.producer, rule.consumer, rule.fused, 2 * bytes});
+                fused = true;
             }
-            (*cmplx_to_r)->placement = rocfft_placement_notinplace;
-
-            (*cmplx_to_r)->scheme      = CS_KERNEL_TRANSPOSE_CMPLX_TO_R;
-            (*cmplx_to_r)->inArrayType = (*transpose)->inArrayType;
-            (*cmplx_to_r)->inStride    = (*transpose)->inStride;
-            (*cmplx_to_r)->length      = (*transpose)->length;
-            (*cmplx_to_r)->iDist       = (*transpose)->iDist;
-            RemoveNode(execPlan, *transpose);
         }
     }
 }
@@ -4410,6 +5009,20 @@ void PrintNode(rocfft_ostream& os, const ExecPlan& execPlan)
     os << "Work buffer size: " << execPlan.workBufSize << std::endl;
     os << "Work buffer ratio: " << (double)execPlan.workBufSize / (double)N << std::endl;
 
+    if(!execPlan.fusions.empty())
+    {
+        size_t bytesSaved = 0;
+        for(const auto& f : execPlan.fusions)
+        {
+            os << "Fused " << PrintScheme(f.producer) << " + " << PrintScheme(f.consumer)
+               << " -> " << PrintScheme(f.fused) << ", " << f.bytesSaved << " bytes saved"
+               << std::endl;
+            bytesSaved += f.bytesSaved;
+        }
+        os << "Kernels removed: " << execPlan.fusions.size() << ", " << bytesSaved
+           << " bytes saved" << std::endl;
+    }
+
     if(execPlan.execSeq.size() > 1)
     {
         std::vector<TreeNode*>::const_iterator prev_p = execPlan.execSeq.begin();
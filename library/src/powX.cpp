@@ -18,6 +18,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
@@ -37,7 +38,10 @@
 
 #include "kernel_launch.h"
 
+#include "device_runtime.h"
 #include "function_pool.h"
+#include "host_kernels.h"
+#include "private.h"
 #include "ref_cpu.h"
 
 #include "real2complex.h"
@@ -51,11 +55,59 @@
 
 std::atomic<bool> fn_checked(false);
 
+// Number of compute units of the current device, to size Stockham
+// blocks for the batch, or 0 if it can't be queried
+static size_t DeviceComputeUnits()
+{
+    int deviceid = 0;
+    if(device_runtime().get_device(&deviceid) != hipSuccess)
+        deviceid = 0;
+    int computeUnits = 0;
+    if(device_runtime().device_attribute(
+           &computeUnits, hipDeviceAttributeMultiprocessorCount, deviceid)
+       != hipSuccess)
+        return 0;
+    return std::max(computeUnits, 0);
+}
+
+rocfft_status rocfft_stockham_transforms_per_block_internal(rocfft_precision precision,
+                                                            size_t           length,
+                                                            size_t           count,
+                                                            size_t           computeUnits,
+                                                            size_t*          transformsPerBlock)
+{
+    if(!function_pool::has_function(precision, std::make_pair(length, CS_KERNEL_STOCKHAM)))
+        return rocfft_status_invalid_dimensions;
+
+    size_t workGroupSize;
+    size_t numTransforms;
+    GetWGSAndNT(length, workGroupSize, numTransforms);
+    *transformsPerBlock
+        = ChooseStockhamTransformsPerBlock(length, precision, count, computeUnits, GetWGSAndNT);
+    if(*transformsPerBlock != numTransforms
+       && !function_pool::has_function_nt(
+           precision, std::make_tuple(length, *transformsPerBlock, CS_KERNEL_STOCKHAM)))
+        return rocfft_status_failure;
+    return rocfft_status_success;
+}
+
 // This function is called during creation of plan: enqueue the HIP kernels by function
 // pointers. Return true if everything goes well. Any internal device memory allocation
 // failure returns false right away.
 bool PlanPowX(ExecPlan& execPlan)
 {
+    // host plans compute their twiddles as they run and need no device
+    // resources
+    if(execPlan.backend == rocfft_backend_host)
+    {
+        for(const auto& node : execPlan.execSeq)
+        {
+            execPlan.devFnCall.push_back(host_function(node->scheme));
+            execPlan.gridParam.push_back(GridParam());
+        }
+        return true;
+    }
+
     for(const auto& node : execPlan.execSeq)
     {
         if((node->scheme == CS_KERNEL_STOCKHAM) || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
@@ -82,13 +134,30 @@ bool PlanPowX(ExecPlan& execPlan)
             if(node->twiddles == nullptr)
                 return false;
         }
+        // the Stockham twiddles, then those of the fused real processing
+        else if((node->scheme == CS_KERNEL_STOCKHAM_R_TO_CMPLX)
+                || (node->scheme == CS_KERNEL_CMPLX_TO_R_STOCKHAM))
+        {
+            node->twiddles = twiddles_create(node->length[0], node->precision, false, false);
+            if(node->twiddles == nullptr)
+                return false;
+            node->twiddles_large
+                = twiddles_create(2 * node->length[0], node->precision, false, true);
+            if(node->twiddles_large == nullptr)
+                return false;
+        }
         else if(node->scheme == CS_KERNEL_2D_SINGLE)
         {
             // create one set of twiddles for each dimension
             node->twiddles = twiddles_create_2D(node->length[0], node->length[1], node->precision);
         }
+        else if(node->scheme == CS_KERNEL_3D_SINGLE)
+        {
+            node->twiddles = twiddles_create_3D(
+                node->length[0], node->length[1], node->length[2], node->precision);
+        }
 
-        if(node->large1D != 0)
+        if(node->large1D != 0 && !node->largeTwdSincos)
         {
             node->twiddles_large = twiddles_create(node->large1D, node->precision, true, false);
             if(node->twiddles_large == nullptr)
@@ -113,6 +182,8 @@ bool PlanPowX(ExecPlan& execPlan)
         function_pool::verify_no_null_functions();
     }
 
+    const size_t computeUnits = DeviceComputeUnits();
+
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
         DevFnCall ptr = nullptr;
@@ -122,30 +193,51 @@ bool PlanPowX(ExecPlan& execPlan)
         switch(execPlan.execSeq[i]->scheme)
         {
         case CS_KERNEL_STOCKHAM:
+        case CS_KERNEL_STOCKHAM_R_TO_CMPLX:
+        case CS_KERNEL_CMPLX_TO_R_STOCKHAM:
         {
             // get working group size and number of transforms
             size_t workGroupSize;
             size_t numTransforms;
             GetWGSAndNT(execPlan.execSeq[i]->length[0], workGroupSize, numTransforms);
-            ptr          = (execPlan.execSeq[0]->precision == rocfft_precision_single)
-                               ? function_pool::get_function_single(
-                          std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM))
-                               : function_pool::get_function_double(
-                          std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM));
             size_t batch = execPlan.execSeq[i]->batch;
             for(size_t j = 1; j < execPlan.execSeq[i]->length.size(); j++)
                 batch *= execPlan.execSeq[i]->length[j];
+
+            // plain Stockham kernels come in variants that tile the
+            // batch over more or fewer blocks
+            size_t transformsPerBlock = numTransforms;
+            if(execPlan.execSeq[i]->scheme == CS_KERNEL_STOCKHAM)
+                transformsPerBlock
+                    = ChooseStockhamTransformsPerBlock(execPlan.execSeq[i]->length[0],
+                                                       execPlan.execSeq[i]->precision,
+                                                       batch,
+                                                       computeUnits,
+                                                       GetWGSAndNT);
+            if(transformsPerBlock != numTransforms)
+            {
+                ptr = function_pool::get_function_nt(
+                    execPlan.execSeq[0]->precision,
+                    std::make_tuple(
+                        execPlan.execSeq[i]->length[0], transformsPerBlock, CS_KERNEL_STOCKHAM));
+                workGroupSize = workGroupSize / numTransforms * transformsPerBlock;
+                numTransforms = transformsPerBlock;
+            }
+            else
+            {
+                ptr = function_pool::get_function(
+                    execPlan.execSeq[0]->precision,
+                    std::make_pair(execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->scheme));
+            }
             gp.b_x
                 = (batch % numTransforms) ? 1 + (batch / numTransforms) : (batch / numTransforms);
             gp.tpb_x = workGroupSize;
         }
         break;
         case CS_KERNEL_STOCKHAM_BLOCK_CC:
-            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
-                      ? function_pool::get_function_single(std::make_pair(
-                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC))
-                      : function_pool::get_function_double(std::make_pair(
-                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC));
+            ptr = function_pool::get_function(
+                execPlan.execSeq[0]->precision,
+                std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_CC));
             GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
             gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd;
             // repeat for higher dimensions + batch
@@ -156,11 +248,9 @@ bool PlanPowX(ExecPlan& execPlan)
             gp.tpb_x = wgs;
             break;
         case CS_KERNEL_STOCKHAM_BLOCK_RC:
-            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
-                      ? function_pool::get_function_single(std::make_pair(
-                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC))
-                      : function_pool::get_function_double(std::make_pair(
-                          execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC));
+            ptr = function_pool::get_function(
+                execPlan.execSeq[0]->precision,
+                std::make_pair(execPlan.execSeq[i]->length[0], CS_KERNEL_STOCKHAM_BLOCK_RC));
             GetBlockComputeTable(execPlan.execSeq[i]->length[0], bwd, wgs, lds);
             gp.b_x = (execPlan.execSeq[i]->length[1]) / bwd;
             // repeat for higher dimensions + batch
@@ -174,8 +264,8 @@ bool PlanPowX(ExecPlan& execPlan)
         case CS_KERNEL_TRANSPOSE_XY_Z:
         case CS_KERNEL_TRANSPOSE_Z_XY:
             ptr      = &FN_PRFX(transpose_var2);
-            gp.tpb_x = (execPlan.execSeq[0]->precision == rocfft_precision_single) ? 32 : 64;
-            gp.tpb_y = (execPlan.execSeq[0]->precision == rocfft_precision_single) ? 32 : 16;
+            gp.tpb_x = (execPlan.execSeq[0]->precision == rocfft_precision_double) ? 64 : 32;
+            gp.tpb_y = (execPlan.execSeq[0]->precision == rocfft_precision_double) ? 16 : 32;
             break;
         case CS_KERNEL_COPY_R_TO_CMPLX:
             ptr      = &real2complex;
@@ -241,15 +331,10 @@ bool PlanPowX(ExecPlan& execPlan)
             break;
         case CS_KERNEL_2D_SINGLE:
         {
-            ptr = (execPlan.execSeq[0]->precision == rocfft_precision_single)
-                      ? function_pool::get_function_single_2D(
-                          std::make_tuple(execPlan.execSeq[i]->length[0],
-                                          execPlan.execSeq[i]->length[1],
-                                          CS_KERNEL_2D_SINGLE))
-                      : function_pool::get_function_double_2D(
-                          std::make_tuple(execPlan.execSeq[i]->length[0],
-                                          execPlan.execSeq[i]->length[1],
-                                          CS_KERNEL_2D_SINGLE));
+            ptr = function_pool::get_function_2D(execPlan.execSeq[0]->precision,
+                                                 std::make_tuple(execPlan.execSeq[i]->length[0],
+                                                                 execPlan.execSeq[i]->length[1],
+                                                                 CS_KERNEL_2D_SINGLE));
             // Run one threadblock per transform, since we're
             // combining a row transform and a column transform in
             // one kernel.  The transform must not cross threadblock
@@ -265,6 +350,21 @@ bool PlanPowX(ExecPlan& execPlan)
                 execPlan.execSeq[i]->length[0], execPlan.execSeq[i]->length[1], GetWGSAndNT);
             break;
         }
+        case CS_KERNEL_3D_SINGLE:
+        {
+            ptr = function_pool::get_function_3D(execPlan.execSeq[0]->precision,
+                                                 std::make_tuple(execPlan.execSeq[i]->length[0],
+                                                                 execPlan.execSeq[i]->length[1],
+                                                                 execPlan.execSeq[i]->length[2],
+                                                                 CS_KERNEL_3D_SINGLE));
+            // As with 2D_SINGLE, one threadblock does a whole transform
+            gp.b_x   = execPlan.execSeq[i]->batch;
+            gp.tpb_x = Get3DSingleThreadCount(execPlan.execSeq[i]->length[0],
+                                              execPlan.execSeq[i]->length[1],
+                                              execPlan.execSeq[i]->length[2],
+                                              GetWGSAndNT);
+            break;
+        }
         default:
             rocfft_cout << "should not be in this case" << std::endl;
             rocfft_cout << "scheme: " << PrintScheme(execPlan.execSeq[i]->scheme) << std::endl;
@@ -285,7 +385,7 @@ static size_t data_size_bytes(const std::vector<size_t>& lengths,
     // first compute the raw number of elements
     size_t elems = std::accumulate(lengths.begin(), lengths.end(), 1, std::multiplies<size_t>());
     // size of each element
-    size_t elemsize = (precision == rocfft_precision_single ? sizeof(float) : sizeof(double));
+    size_t elemsize = RealTypeSize(precision);
     switch(type)
     {
     case rocfft_array_type_complex_interleaved:
@@ -321,12 +421,13 @@ static float execution_bandwidth_GB_per_s(size_t data_size_bytes, float duration
 // might also return 0.0 if the bandwidth can't be queried.
 static float max_memory_bandwidth_GB_per_s()
 {
-    int deviceid = 0;
-    hipGetDevice(&deviceid);
+    auto& runtime  = device_runtime();
+    int   deviceid = 0;
+    runtime.get_device(&deviceid);
     int max_memory_clock_kHz = 0;
     int memory_bus_width     = 0;
-    hipDeviceGetAttribute(&max_memory_clock_kHz, hipDeviceAttributeMemoryClockRate, deviceid);
-    hipDeviceGetAttribute(&memory_bus_width, hipDeviceAttributeMemoryBusWidth, deviceid);
+    runtime.device_attribute(&max_memory_clock_kHz, hipDeviceAttributeMemoryClockRate, deviceid);
+    runtime.device_attribute(&memory_bus_width, hipDeviceAttributeMemoryBusWidth, deviceid);
     auto max_memory_clock_MHz = static_cast<float>(max_memory_clock_kHz) / 1024.0;
     // multiply by 2.0 because transfer is bidirectional
     // divide by 8.0 because bus width is in bits and we want bytes
@@ -345,15 +446,21 @@ void TransformPowX(const ExecPlan&       execPlan,
     assert(execPlan.execSeq.size() == execPlan.devFnCall.size());
     assert(execPlan.execSeq.size() == execPlan.gridParam.size());
 
+    // the execution info may override the backend the plan was made for
+    const bool use_host = (info != nullptr && info->backend != rocfft_backend_default)
+                              ? info->backend == rocfft_backend_host
+                              : execPlan.backend == rocfft_backend_host;
+
     // we can log profile information if we're on the null stream,
     // since we will be able to wait for the transform to finish
-    bool       emit_profile_log = LOG_PROFILE_ENABLED() && !info->rocfft_stream;
+    bool       emit_profile_log = LOG_PROFILE_ENABLED() && !use_host && !info->rocfft_stream;
     float      max_memory_bw    = 0.0;
+    auto&      runtime          = device_runtime();
     hipEvent_t start, stop;
     if(emit_profile_log)
     {
-        hipEventCreate(&start);
-        hipEventCreate(&stop);
+        runtime.event_create(&start);
+        runtime.event_create(&stop);
         max_memory_bw = max_memory_bandwidth_GB_per_s();
     }
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
@@ -361,31 +468,36 @@ void TransformPowX(const ExecPlan&       execPlan,
         DeviceCallIn data;
         data.node          = execPlan.execSeq[i];
         data.rocfft_stream = (info == nullptr) ? 0 : info->rocfft_stream;
+        if(info != nullptr && data.node->scheme == CS_KERNEL_STOCKHAM)
+            data.batchPointers = info->batchPointers;
 
         // Size of complex type
-        const size_t complexTSize = (data.node->precision == rocfft_precision_single)
-                                        ? sizeof(float) * 2
-                                        : sizeof(double) * 2;
+        const size_t complexTSize = RealTypeSize(data.node->precision) * 2;
 
-        if(data.node->parent != NULL && data.node->parent->scheme == CS_REAL_TRANSFORM_PAIR)
+        if(data.node->scheme == CS_KERNEL_PAIR_PACK || data.node->scheme == CS_KERNEL_PAIR_UNPACK)
         {
             // We conclude that we are performing real/complex paired transform, where the real
             // values are treated as the real and complex parts of a complex/complex transform in
             // planar format.
 
-            // We have only implemented forward transforms: TODO: enable inverse.
-            assert(data.node->direction == -1);
-
-            if(data.node->scheme == CS_KERNEL_PAIR_UNPACK)
+            if(data.node->scheme == CS_KERNEL_PAIR_PACK)
             {
-                // Tthis node is the unpack plan.
+                // This node is the pack plan of an inverse transform.
                 switch(data.node->obIn)
                 {
                 case OB_USER_IN:
                     data.bufIn[0] = in_buffer[0];
+                    if(data.node->inArrayType == rocfft_array_type_hermitian_planar)
+                    {
+                        data.bufIn[1] = in_buffer[1];
+                    }
                     break;
-                case OB_TEMP:
-                    data.bufIn[0] = info->workBuffer;
+                case OB_USER_OUT:
+                    data.bufIn[0] = out_buffer[0];
+                    if(data.node->inArrayType == rocfft_array_type_hermitian_planar)
+                    {
+                        data.bufIn[1] = out_buffer[1];
+                    }
                     break;
                 default:
                     rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
@@ -396,97 +508,95 @@ void TransformPowX(const ExecPlan&       execPlan,
                 {
                 case OB_USER_OUT:
                     data.bufOut[0] = out_buffer[0];
-                    if(data.node->outArrayType == rocfft_array_type_hermitian_planar)
-                    {
-                        data.bufOut[1] = out_buffer[1];
-                    }
+                    break;
+                case OB_TEMP:
+                    data.bufOut[0] = info->workBuffer;
                     break;
                 default:
                     rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
                     assert(false);
                 }
             }
-            else
+            else if(data.node->scheme == CS_KERNEL_PAIR_UNPACK)
             {
-                // We infer that this node is the real-as-planar c2c transform.
-
-                // TODO: deal with multiple kernels.
-
-                assert(data.node->scheme != CS_KERNEL_PAIR_UNPACK);
-
-                // Size of real type
-                const size_t realTSize = (data.node->precision == rocfft_precision_single)
-                                             ? sizeof(float)
-                                             : sizeof(double);
-
-                // Calculate the pointer to the planar format when using the paired
-                // real/complex method.
-                const ptrdiff_t ioffset
-                    = (execPlan.rootPlan->batch % 2 == 0)
-                          ? realTSize * data.node->iDist / 2
-                          : realTSize * execPlan.rootPlan->inStride[data.node->pairdim];
-                assert(ioffset != 0);
-                // std::cout << "ioffset: " << ioffset << std::endl;
-
+                // Tthis node is the unpack plan.
                 switch(data.node->obIn)
                 {
                 case OB_USER_IN:
                     data.bufIn[0] = in_buffer[0];
                     break;
-                case OB_USER_OUT:
-                    data.bufIn[0] = out_buffer[0];
+                case OB_TEMP:
+                    data.bufIn[0] = info->workBuffer;
                     break;
                 default:
                     rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
                     assert(false);
                 }
-                data.bufIn[1] = (void*)((char*)data.bufIn[0] + ioffset);
 
                 switch(data.node->obOut)
                 {
                 case OB_USER_IN:
-                    data.bufOut[0] = data.bufIn[0];
-                    data.bufOut[1] = data.bufIn[1];
+                    data.bufOut[0] = in_buffer[0];
+                    if(data.node->outArrayType == rocfft_array_type_hermitian_planar)
+                    {
+                        data.bufOut[1] = in_buffer[1];
+                    }
                     break;
                 case OB_USER_OUT:
                     data.bufOut[0] = out_buffer[0];
-                    break;
-                case OB_TEMP:
-                    data.bufOut[0] = info->workBuffer;
+                    if(data.node->outArrayType == rocfft_array_type_hermitian_planar)
+                    {
+                        data.bufOut[1] = out_buffer[1];
+                    }
                     break;
                 default:
                     rocfft_cerr << "Error: operating buffer not specified for kernel!\n";
                     assert(false);
                 }
-                data.bufOut[1] = (void*)((char*)data.bufOut[0] + ioffset);
             }
         }
         else
         {
             // Typical case.
 
+            // Real data read or written as complex, by the half-length
+            // transform of an even-length real transform or the c2c plan of
+            // a paired one, is viewed as planar data with the imaginary
+            // parts a fixed distance after the real parts.  The view has no
+            // second user pointer of its own.
+            const size_t viewOffset = data.node->RealViewOffset();
+            const bool   inRealView
+                = viewOffset != 0 && data.node->inArrayType == rocfft_array_type_complex_planar;
+            const bool outRealView
+                = viewOffset != 0 && data.node->outArrayType == rocfft_array_type_complex_planar;
+            const bool inPlanar
+                = !inRealView
+                  && (data.node->inArrayType == rocfft_array_type_complex_planar
+                      || data.node->inArrayType == rocfft_array_type_hermitian_planar);
+            const bool outPlanar
+                = !outRealView
+                  && (data.node->outArrayType == rocfft_array_type_complex_planar
+                      || data.node->outArrayType == rocfft_array_type_hermitian_planar);
+
             switch(data.node->obIn)
             {
             case OB_USER_IN:
                 data.bufIn[0] = in_buffer[0];
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
+                if(inPlanar)
                 {
                     data.bufIn[1] = in_buffer[1];
                 }
                 break;
             case OB_USER_OUT:
                 data.bufIn[0] = out_buffer[0];
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
+                if(inPlanar)
                 {
                     data.bufIn[1] = out_buffer[1];
                 }
                 break;
             case OB_TEMP:
                 data.bufIn[0] = info->workBuffer;
-                if(data.node->inArrayType == rocfft_array_type_complex_planar
-                   || data.node->inArrayType == rocfft_array_type_hermitian_planar)
+                if(inPlanar)
                 {
                     // Assume planar using the same extra size of memory as
                     // interleaved format, and we just need to split it for
@@ -517,24 +627,21 @@ void TransformPowX(const ExecPlan&       execPlan,
             {
             case OB_USER_IN:
                 data.bufOut[0] = in_buffer[0];
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
+                if(outPlanar)
                 {
                     data.bufOut[1] = in_buffer[1];
                 }
                 break;
             case OB_USER_OUT:
                 data.bufOut[0] = out_buffer[0];
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
+                if(outPlanar)
                 {
                     data.bufOut[1] = out_buffer[1];
                 }
                 break;
             case OB_TEMP:
                 data.bufOut[0] = info->workBuffer;
-                if(data.node->outArrayType == rocfft_array_type_complex_planar
-                   || data.node->outArrayType == rocfft_array_type_hermitian_planar)
+                if(outPlanar)
                 {
                     // assume planar using the same extra size of memory as
                     // interleaved format, and we just need to split it for
@@ -556,6 +663,16 @@ void TransformPowX(const ExecPlan&       execPlan,
             default:
                 assert(false);
             }
+
+            const size_t imOffset = RealTypeSize(data.node->precision) * viewOffset;
+            if(inRealView)
+            {
+                data.bufIn[1] = (void*)((char*)data.bufIn[0] + imOffset);
+            }
+            if(outRealView)
+            {
+                data.bufOut[1] = (void*)((char*)data.bufOut[0] + imOffset);
+            }
         }
 
         data.gridParam = execPlan.gridParam[i];
@@ -568,8 +685,7 @@ void TransformPowX(const ExecPlan&       execPlan,
         rocfft_cout << "--- --- scheme " << PrintScheme(data.node->scheme) << std::endl;
 
         const size_t in_size = data.node->iDist * data.node->batch;
-        size_t       base_type_size
-            = (data.node->precision == rocfft_precision_double) ? sizeof(double) : sizeof(float);
+        size_t       base_type_size = RealTypeSize(data.node->precision);
         base_type_size *= 2;
 
         size_t in_size_bytes = in_size * base_type_size;
@@ -626,7 +742,7 @@ void TransformPowX(const ExecPlan&       execPlan,
         rocfft_cout << "attempting kernel: " << i << std::endl;
 #endif
 
-        DevFnCall fn = execPlan.devFnCall[i];
+        DevFnCall fn = use_host ? host_function(data.node->scheme) : execPlan.devFnCall[i];
         if(fn)
         {
 #ifdef REF_DEBUG
@@ -662,11 +778,14 @@ void TransformPowX(const ExecPlan&       execPlan,
 
             // execution kernel:
             if(emit_profile_log)
-                hipEventRecord(start);
+                runtime.event_record(start, info->rocfft_stream);
             DeviceCallOut back;
-            fn(&data, &back);
+            if(use_host)
+                fn(&data, &back);
+            else
+                runtime.launch(fn, data, back);
             if(emit_profile_log)
-                hipEventRecord(stop);
+                runtime.event_record(stop, info->rocfft_stream);
 
             // If we were on the null stream, measure elapsed time
             // and emit profile logging.  If a stream was given, we
@@ -674,7 +793,7 @@ void TransformPowX(const ExecPlan&       execPlan,
             // emit any information.
             if(emit_profile_log)
             {
-                hipEventSynchronize(stop);
+                runtime.event_synchronize(stop);
                 size_t in_size_bytes = data_size_bytes(
                     data.node->length, data.node->precision, data.node->inArrayType);
                 size_t out_size_bytes = data_size_bytes(
@@ -682,7 +801,7 @@ void TransformPowX(const ExecPlan&       execPlan,
                 size_t total_size_bytes = (in_size_bytes + out_size_bytes) * data.node->batch;
 
                 float duration_ms = 0.0f;
-                hipEventElapsedTime(&duration_ms, start, stop);
+                runtime.event_elapsed_time(&duration_ms, start, stop);
                 auto exec_bw        = execution_bandwidth_GB_per_s(total_size_bytes, duration_ms);
                 auto efficiency_pct = 0.0;
                 if(max_memory_bw != 0.0)
@@ -778,7 +897,7 @@ void TransformPowX(const ExecPlan&       execPlan,
     }
     if(emit_profile_log)
     {
-        hipEventDestroy(start);
-        hipEventDestroy(stop);
+        runtime.event_destroy(start);
+        runtime.event_destroy(stop);
     }
 }
@@ -24,6 +24,7 @@
 #include <iostream>
 #include <vector>
 
+#include "hybrid.h"
 #include "logging.h"
 #include "plan.h"
 #include "repo.h"
@@ -34,6 +35,80 @@
 std::mutex        Repo::mtx;
 std::atomic<bool> Repo::repoDestroyed(false);
 
+bool Repo::BuildTree(const rocfft_plan_t& plan, ExecPlan& execPlan)
+{
+    // a zero length has no decomposition and would never finish one
+    for(size_t i = 0; i < plan.rank; i++)
+    {
+        if(plan.lengths[i] == 0)
+            return false;
+    }
+
+    auto rootPlan = TreeNode::CreateNode();
+
+    rootPlan->dimension = plan.rank;
+    rootPlan->batch     = plan.batch;
+    for(size_t i = 0; i < plan.rank; i++)
+    {
+        rootPlan->length.push_back(plan.lengths[i]);
+
+        rootPlan->inStride.push_back(plan.desc.inStrides[i]);
+        rootPlan->outStride.push_back(plan.desc.outStrides[i]);
+    }
+    rootPlan->iDist = plan.desc.inDist;
+    rootPlan->oDist = plan.desc.outDist;
+
+    rootPlan->placement = plan.placement;
+    rootPlan->precision = plan.precision;
+    if((plan.transformType == rocfft_transform_type_complex_forward)
+       || (plan.transformType == rocfft_transform_type_real_forward))
+        rootPlan->direction = -1;
+    else
+        rootPlan->direction = 1;
+
+    rootPlan->inArrayType  = plan.desc.inArrayType;
+    rootPlan->outArrayType = plan.desc.outArrayType;
+
+    execPlan.rootPlan = std::move(rootPlan);
+    execPlan.backend  = plan.desc.backend;
+    try
+    {
+        ProcessNode(execPlan); // TODO: more descriptions are needed
+    }
+    catch(std::exception&)
+    {
+        return false;
+    }
+    if(execPlan.execSeq.empty())
+        return false;
+
+    // device kernels are looked up when the plan is built; check the
+    // Stockham ones here, so that sizes without a kernel fail before
+    // any device resources are allocated
+    if(execPlan.backend == rocfft_backend_host)
+        return true;
+    for(const auto& node : execPlan.execSeq)
+    {
+        if(((node->scheme == CS_KERNEL_STOCKHAM) || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+            || (node->scheme == CS_KERNEL_STOCKHAM_BLOCK_RC))
+           && !function_pool::has_function(node->precision, {node->length[0], node->scheme}))
+            return false;
+    }
+    return true;
+}
+
+bool Repo::BuildExecPlan(const rocfft_plan_t& plan, ExecPlan& execPlan)
+{
+    if(!BuildTree(plan, execPlan))
+        return false;
+    if(LOG_TRACE_ENABLED())
+        PrintNode(*LogSingleton::GetInstance().GetTraceOS(), execPlan);
+
+    // PlanPowX enqueues the GPU kernels by function pointers but
+    // does not execute kernels
+    return PlanPowX(execPlan);
+}
+
 rocfft_status Repo::CreatePlan(rocfft_plan plan)
 {
     std::lock_guard<std::mutex> lck(mtx);
@@ -46,43 +121,11 @@ rocfft_status Repo::CreatePlan(rocfft_plan plan)
     auto it = repo.planUnique.find(*plan);
     if(it == repo.planUnique.end()) // if not found
     {
-        auto rootPlan = TreeNode::CreateNode();
-
-        rootPlan->dimension = plan->rank;
-        rootPlan->batch     = plan->batch;
-        for(size_t i = 0; i < plan->rank; i++)
-        {
-            rootPlan->length.push_back(plan->lengths[i]);
-
-            rootPlan->inStride.push_back(plan->desc.inStrides[i]);
-            rootPlan->outStride.push_back(plan->desc.outStrides[i]);
-        }
-        rootPlan->iDist = plan->desc.inDist;
-        rootPlan->oDist = plan->desc.outDist;
-
-        rootPlan->placement = plan->placement;
-        rootPlan->precision = plan->precision;
-        if((plan->transformType == rocfft_transform_type_complex_forward)
-           || (plan->transformType == rocfft_transform_type_real_forward))
-            rootPlan->direction = -1;
-        else
-            rootPlan->direction = 1;
-
-        rootPlan->inArrayType  = plan->desc.inArrayType;
-        rootPlan->outArrayType = plan->desc.outArrayType;
-
         ExecPlan execPlan;
-        execPlan.rootPlan = std::move(rootPlan);
-        ProcessNode(execPlan); // TODO: more descriptions are needed
-        if(LOG_TRACE_ENABLED())
-            PrintNode(*LogSingleton::GetInstance().GetTraceOS(), execPlan);
-
-        if(!PlanPowX(execPlan)) // PlanPowX enqueues the GPU kernels by function
-        {
+        if(!BuildExecPlan(*plan, execPlan))
             return rocfft_status_failure;
-        }
-
-        // pointers but does not execute kernels
+        if(plan->desc.backend == rocfft_backend_hybrid && plan->batch > 1)
+            execPlan.hybrid = std::make_shared<HybridState>(*plan);
 
         // add this plan into member planUnique (type of map)
         repo.planUnique[*plan] = std::make_pair(execPlan, 1);
@@ -119,10 +162,11 @@ void Repo::DeletePlan(rocfft_plan plan)
 
     Repo& repo = Repo::GetRepo();
     auto  it   = repo.execLookup.find(plan);
-    if(it != repo.execLookup.end())
-    {
-        repo.execLookup.erase(it);
-    }
+    // a plan that was never built holds no reference, even if an
+    // equal plan was built
+    if(it == repo.execLookup.end())
+        return;
+    repo.execLookup.erase(it);
 
     auto it_u = repo.planUnique.find(*plan);
     if(it_u != repo.planUnique.end())
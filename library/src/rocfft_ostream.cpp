@@ -368,6 +368,9 @@ rocfft_ostream& operator<<(rocfft_ostream& os, rocfft_precision precision)
     case rocfft_precision_double:
         os << "double";
         break;
+    case rocfft_precision_half:
+        os << "half";
+        break;
     }
     return os;
 }
@@ -25,11 +25,16 @@
 #include <iostream>
 #include <vector>
 
+#include "coalesce.h"
+#include "grouped.h"
+#include "hybrid.h"
 #include "logging.h"
 #include "plan.h"
+#include "radix_table.h"
 #include "repo.h"
 #include "rocfft.h"
 #include "transform.h"
+#include "workspace.h"
 
 rocfft_status rocfft_execution_info_create(rocfft_execution_info* info)
 {
@@ -68,6 +73,27 @@ rocfft_status rocfft_execution_info_set_stream(rocfft_execution_info info, void*
     return rocfft_status_success;
 }
 
+rocfft_status rocfft_execution_info_set_backend(rocfft_execution_info          info,
+                                                const rocfft_execution_backend backend)
+{
+    log_trace(__func__, "info", info, "backend", backend);
+    if(backend != rocfft_backend_default && backend != rocfft_backend_device
+       && backend != rocfft_backend_host && backend != rocfft_backend_hybrid)
+        return rocfft_status_invalid_arg_value;
+    info->backend = backend;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_execution_info_set_coalescing(rocfft_execution_info info,
+                                                   size_t                max_count,
+                                                   size_t                max_wait_us)
+{
+    log_trace(__func__, "info", info, "max_count", max_count, "max_wait_us", max_wait_us);
+    info->coalesceCount  = max_count;
+    info->coalesceWaitUs = max_wait_us;
+    return rocfft_status_success;
+}
+
 rocfft_status rocfft_execute(const rocfft_plan     plan,
                              void*                 in_buffer[],
                              void*                 out_buffer[],
@@ -84,18 +110,124 @@ rocfft_status rocfft_execute(const rocfft_plan     plan,
     PrintNode(rocfft_cout, execPlan);
 #endif
 
-    if(execPlan.workBufSize > 0)
+    const rocfft_execution_backend backend
+        = (info != nullptr && info->backend != rocfft_backend_default) ? info->backend
+                                                                       : execPlan.backend;
+
+    // a host plan has nothing to launch on the device
+    if(execPlan.backend == rocfft_backend_host && backend != rocfft_backend_host)
+        return rocfft_status_failure;
+
+    rocfft_execution_info_t localInfo;
+    if(info == nullptr)
+        info = &localInfo;
+
+    void** out = (plan->placement == rocfft_placement_inplace) ? in_buffer : out_buffer;
+
+    // only hybrid plans with a batch to split have the state for it;
+    // anything else asked to run hybrid runs on the device.  Both
+    // paths find work buffers for their own plans.
+    if(backend == rocfft_backend_hybrid && execPlan.hybrid)
+        return TransformHybrid(execPlan, in_buffer, out, info);
+    if(backend == rocfft_backend_device && info->coalesceCount > 1)
+        return TransformCoalesced(*plan, execPlan, in_buffer, out, info);
+
+    // without a work buffer from the caller, running on the host uses
+    // host memory
+    const size_t workBytes = execPlan.workBufSize * 2 * plan->base_type_size;
+    if(backend == rocfft_backend_host && workBytes > 0 && info->workBuffer == nullptr)
     {
-#ifndef __NVCC__
-        assert(info != nullptr);
-#endif
-        assert(info->workBufferSize >= (execPlan.workBufSize * 2 * plan->base_type_size));
+        static thread_local std::vector<char> hostWork;
+        if(hostWork.size() < workBytes)
+            hostWork.resize(workBytes);
+        localInfo                = *info;
+        localInfo.workBuffer     = hostWork.data();
+        localInfo.workBufferSize = workBytes;
+        info                     = &localInfo;
+    }
+
+    return TransformPowXBorrowing(execPlan, in_buffer, out, info);
+}
+
+rocfft_status TransformPowXBorrowing(const ExecPlan&       execPlan,
+                                     void*                 in_buffer[],
+                                     void*                 out_buffer[],
+                                     rocfft_execution_info info)
+{
+    const size_t workBytes
+        = execPlan.workBufSize * 2 * RealTypeSize(execPlan.rootPlan->precision);
+    if(workBytes == 0 || info->workBuffer != nullptr)
+    {
+        assert(info->workBufferSize >= workBytes);
+        TransformPowX(execPlan, in_buffer, out_buffer, info);
+        return rocfft_status_success;
     }
 
-    TransformPowX(execPlan,
-                  in_buffer,
-                  (plan->placement == rocfft_placement_inplace) ? in_buffer : out_buffer,
-                  info);
+    // the buffer is locked only while the kernels are enqueued; work
+    // enqueued later on the stream runs after them on the device
+    WorkspacePool::Lease lease = WorkspacePool::Borrow(info->rocfft_stream, workBytes);
+    if(lease.data == nullptr)
+        return rocfft_status_failure;
 
+    rocfft_execution_info_t leaseInfo = *info;
+    leaseInfo.workBuffer              = lease.data;
+    leaseInfo.workBufferSize          = workBytes;
+    TransformPowX(execPlan, in_buffer, out_buffer, &leaseInfo);
     return rocfft_status_success;
 }
+
+rocfft_status rocfft_execute_pointer_array(const rocfft_plan     plan,
+                                           void**                in_buffer[],
+                                           void**                out_buffer[],
+                                           rocfft_execution_info info)
+{
+    log_trace(
+        __func__, "plan", plan, "in_buffer", in_buffer, "out_buffer", out_buffer, "info", info);
+
+    const rocfft_execution_backend backend
+        = (info != nullptr && info->backend != rocfft_backend_default) ? info->backend
+                                                                       : plan->desc.backend;
+    if(backend == rocfft_backend_host)
+        return rocfft_status_invalid_arg_value;
+
+    // the library provides the work buffer for the staged batch
+    rocfft_execution_info_t defaultInfo;
+    if(info == nullptr)
+        info = &defaultInfo;
+
+    Repo&    repo = Repo::GetRepo();
+    ExecPlan execPlan;
+    repo.GetPlan(plan, execPlan);
+
+    void*** out = (plan->placement == rocfft_placement_inplace) ? in_buffer : out_buffer;
+    return TransformPointerArray(*plan, execPlan, in_buffer, out, info);
+}
+
+rocfft_status rocfft_execute_grouped(size_t                count,
+                                     const rocfft_plan     plans[],
+                                     void**                in_buffers[],
+                                     void**                out_buffers[],
+                                     rocfft_execution_info info)
+{
+    log_trace(__func__,
+              "count",
+              count,
+              "plans",
+              plans,
+              "in_buffers",
+              in_buffers,
+              "out_buffers",
+              out_buffers,
+              "info",
+              info);
+
+    if(count == 0)
+        return rocfft_status_success;
+
+    // the library provides the plans' work buffers
+    rocfft_execution_info_t defaultInfo;
+    if(info == nullptr)
+        info = &defaultInfo;
+
+    return TransformGrouped(count, plans, in_buffers, out_buffers, info);
+}
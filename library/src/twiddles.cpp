@@ -21,13 +21,14 @@
 *******************************************************************************/
 
 #include "twiddles.h"
+#include "device_runtime.h"
 #include "radix_table.h"
 #include "rocfft_hip.h"
 
 template <typename T>
-gpubuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radices)
+devbuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radices)
 {
-    gpubuf twts; // device side
+    devbuf twts; // device side
     void*  twtc; // host side
     size_t ns = 0; // table size
 
@@ -46,7 +47,8 @@ gpubuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radice
         }
 
         if(twts.alloc(N * sizeof(T)) != hipSuccess
-           || hipMemcpy(twts.data(), twtc, N * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+           || device_runtime().memcpy(twts.data(), twtc, N * sizeof(T), hipMemcpyHostToDevice)
+                  != hipSuccess)
             twts.free();
     }
     else
@@ -56,7 +58,8 @@ gpubuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radice
             TwiddleTable<T> twTable(N);
             twtc = twTable.GenerateTwiddleTable();
             if(twts.alloc(N * sizeof(T)) != hipSuccess
-               || hipMemcpy(twts.data(), twtc, N * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+               || device_runtime().memcpy(twts.data(), twtc, N * sizeof(T), hipMemcpyHostToDevice)
+                      != hipSuccess)
                 twts.free();
         }
         else
@@ -65,7 +68,8 @@ gpubuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radice
             std::tie(ns, twtc) = twTable.GenerateTwiddleTable(); // calculate twiddles on host side
 
             if(twts.alloc(ns * sizeof(T)) != hipSuccess
-               || hipMemcpy(twts.data(), twtc, ns * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+               || device_runtime().memcpy(twts.data(), twtc, ns * sizeof(T), hipMemcpyHostToDevice)
+                      != hipSuccess)
                 twts.free();
         }
     }
@@ -73,12 +77,14 @@ gpubuf twiddles_create_pr(size_t N, size_t threshold, bool large, bool no_radice
     return twts;
 }
 
-gpubuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices)
+devbuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no_radices)
 {
     if(precision == rocfft_precision_single)
         return twiddles_create_pr<float2>(N, Large1DThreshold(precision), large, no_radices);
     else if(precision == rocfft_precision_double)
         return twiddles_create_pr<double2>(N, Large1DThreshold(precision), large, no_radices);
+    else if(precision == rocfft_precision_half) // kernels compute half in fp32
+        return twiddles_create_pr<float2>(N, Large1DThreshold(precision), large, no_radices);
     else
     {
         assert(false);
@@ -87,7 +93,7 @@ gpubuf twiddles_create(size_t N, rocfft_precision precision, bool large, bool no
 }
 
 template <typename T>
-gpubuf twiddles_create_2D_pr(size_t N1, size_t N2)
+devbuf twiddles_create_2D_pr(size_t N1, size_t N2)
 {
     // create just one twiddle table if we can get away with it
     if(N1 == N2)
@@ -108,22 +114,67 @@ gpubuf twiddles_create_2D_pr(size_t N1, size_t N2)
 
     // glue those two twiddle tables together in one malloc that we
     // give to the kernel
-    gpubuf twts;
+    devbuf twts;
     if(twts.alloc((N1 + N2) * sizeof(T)) != hipSuccess)
         return twts;
     auto twts_ptr = static_cast<T*>(twts.data());
-    if(hipMemcpy(twts_ptr, twtc1, N1 * sizeof(T), hipMemcpyHostToDevice) != hipSuccess
-       || hipMemcpy(twts_ptr + N1, twtc2, N2 * sizeof(T), hipMemcpyHostToDevice) != hipSuccess)
+    if(device_runtime().memcpy(twts_ptr, twtc1, N1 * sizeof(T), hipMemcpyHostToDevice)
+           != hipSuccess
+       || device_runtime().memcpy(twts_ptr + N1, twtc2, N2 * sizeof(T), hipMemcpyHostToDevice)
+              != hipSuccess)
         twts.free();
     return twts;
 }
 
-gpubuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision)
+devbuf twiddles_create_2D(size_t N1, size_t N2, rocfft_precision precision)
 {
     if(precision == rocfft_precision_single)
         return twiddles_create_2D_pr<float2>(N1, N2);
     else if(precision == rocfft_precision_double)
         return twiddles_create_2D_pr<double2>(N1, N2);
+    else if(precision == rocfft_precision_half)
+        return twiddles_create_2D_pr<float2>(N1, N2);
+    else
+    {
+        assert(false);
+        return {};
+    }
+}
+
+template <typename T>
+devbuf twiddles_create_3D_pr(size_t N1, size_t N2, size_t N3)
+{
+    // one table per dimension, glued together back to back in the
+    // order the 3D_SINGLE kernel walks them
+    const size_t lengths[] = {N1, N2, N3};
+
+    devbuf twts;
+    if(twts.alloc((N1 + N2 + N3) * sizeof(T)) != hipSuccess)
+        return twts;
+    auto twts_ptr = static_cast<T*>(twts.data());
+    for(auto N : lengths)
+    {
+        TwiddleTable<T> twTable(N);
+        auto            twtc = twTable.GenerateTwiddleTable(GetRadices(N));
+        if(device_runtime().memcpy(twts_ptr, twtc, N * sizeof(T), hipMemcpyHostToDevice)
+           != hipSuccess)
+        {
+            twts.free();
+            return twts;
+        }
+        twts_ptr += N;
+    }
+    return twts;
+}
+
+devbuf twiddles_create_3D(size_t N1, size_t N2, size_t N3, rocfft_precision precision)
+{
+    if(precision == rocfft_precision_single)
+        return twiddles_create_3D_pr<float2>(N1, N2, N3);
+    else if(precision == rocfft_precision_double)
+        return twiddles_create_3D_pr<double2>(N1, N2, N3);
+    else if(precision == rocfft_precision_half)
+        return twiddles_create_3D_pr<float2>(N1, N2, N3);
     else
     {
         assert(false);
@@ -0,0 +1,111 @@
+// Copyright (c) 2016 - present Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "device_runtime.h"
+#include "logging.h"
+#include "private.h"
+#include "workspace.h"
+
+struct WorkspacePool::Workspace
+{
+    std::mutex mutex;
+    devbuf     buf;
+    size_t     size = 0;
+};
+
+namespace
+{
+    using WorkspacePool::Workspace;
+
+    std::mutex                                                        pool_mutex;
+    std::map<std::pair<int, hipStream_t>, std::shared_ptr<Workspace>> pool;
+}
+
+WorkspacePool::Lease WorkspacePool::Borrow(hipStream_t stream, size_t size)
+{
+    auto& runtime = device_runtime();
+    int   device  = 0;
+    runtime.get_device(&device);
+
+    Lease lease;
+    {
+        std::lock_guard<std::mutex> lck(pool_mutex);
+        auto&                       entry = pool[std::make_pair(device, stream)];
+        if(!entry)
+            entry = std::make_shared<Workspace>();
+        lease.workspace = entry;
+    }
+
+    Workspace* workspace = lease.workspace.get();
+    lease.lock           = std::unique_lock<std::mutex>(workspace->mutex);
+    if(workspace->size < size)
+    {
+        log_trace(__func__, "stream", stream, "size", size);
+
+        // earlier work on the stream may still be using the old buffer
+        runtime.stream_synchronize(stream);
+        workspace->size = 0;
+        if(workspace->buf.alloc(size) != hipSuccess)
+            return lease;
+        workspace->size = size;
+    }
+    lease.data = workspace->buf.data();
+    return lease;
+}
+
+void WorkspacePool::Release()
+{
+    std::lock_guard<std::mutex> lck(pool_mutex);
+    pool.clear();
+}
+
+size_t WorkspacePool::Count()
+{
+    std::lock_guard<std::mutex> lck(pool_mutex);
+    return pool.size();
+}
+
+rocfft_status
+    rocfft_workspace_pool_borrow_internal(void* stream, size_t size, void** lease, void** data)
+{
+    std::unique_ptr<WorkspacePool::Lease> held(new WorkspacePool::Lease(
+        WorkspacePool::Borrow(static_cast<hipStream_t>(stream), size)));
+    if(held->data == nullptr)
+        return rocfft_status_failure;
+    *data  = held->data;
+    *lease = held.release();
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_workspace_pool_return_internal(void* lease)
+{
+    delete static_cast<WorkspacePool::Lease*>(lease);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_workspace_pool_get_count_internal(size_t* count)
+{
+    *count = WorkspacePool::Count();
+    return rocfft_status_success;
+}